@@ -34,14 +34,17 @@
 #include <vector>
 #include <ostream>
 #include <filesystem>
+#include <optional>
 
 #include <warn/push>
 #include <warn/ignore/all>
 #include <gdcmPixelFormat.h>
+#include <gdcmPhotometricInterpretation.h>
 #include <warn/pop>
 
 namespace gdcm {
 class DataSet;
+class File;
 class ImageReader;
 }  // namespace gdcm
 
@@ -79,6 +82,13 @@ struct IVW_MODULE_DICOM_API Image {
      * @param reader     reader used to load the image
      */
     void updateInfo(const gdcm::ImageReader& reader);
+    /**
+     * update the image info from corresponding tags in the gdcm \p file. Only the header of the
+     * file is required, i.e. the pixel data does not need to be read.
+     *
+     * @param file     file associated with the image
+     */
+    void updateInfo(const gdcm::File& file);
 
     /**
      * compute z coordinate of the image slice
@@ -87,6 +97,30 @@ struct IVW_MODULE_DICOM_API Image {
     void updateZpos();
 };
 
+/**
+ * Header of a single DICOM image file. Contains everything needed to assign the image to a series
+ * and to set up the volume without decoding the pixel data.
+ */
+struct IVW_MODULE_DICOM_API ImageHeader {
+    Image image;
+    std::string seriesUID;
+    std::string instanceUID;
+    std::string seriesDesc;
+    std::string modality;
+    gdcm::PixelFormat pixelformat;
+    gdcm::PhotometricInterpretation photometric;
+    double intercept = 0.0;
+    double slope = 1.0;
+
+    /**
+     * read all tags of the DICOM file \p path up to the pixel data, which is skipped
+     *
+     * @param path   DICOM image file
+     * @return the image header or std::nullopt if \p path cannot be opened or is not a DICOM file
+     */
+    static std::optional<ImageHeader> read(const std::filesystem::path& path);
+};
+
 struct IVW_MODULE_DICOM_API Series {
     Series() = default;
     Series(const std::string& description);
@@ -113,6 +147,19 @@ struct IVW_MODULE_DICOM_API Series {
      */
     void updateImageInformation(const std::filesystem::path& dicompath = std::filesystem::path{});
 
+    /**
+     * replace the images of the series with the ones given by \p headers and update the series
+     * properties accordingly. Applies the same sanity checks as updateImageInformation(), but no
+     * files are read.
+     *
+     * @param headers    headers of all images of the series, e.g. from a directory scan
+     * @param dicompath  used only in case of an error and should refer to the main DICOM dataset
+     * @throws DataReaderException if sanity check fails.
+     * @see ImageHeader
+     */
+    void updateImageInformation(const std::vector<ImageHeader>& headers,
+                                const std::filesystem::path& dicompath = std::filesystem::path{});
+
     /**
      * sort images by slice position in patient coords (zPos)
      *
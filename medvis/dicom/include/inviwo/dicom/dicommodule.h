@@ -31,12 +31,15 @@
 
 #include <inviwo/core/common/inviwomodule.h>
 #include <inviwo/dicom/dicommoduledefine.h>
+#include <inviwo/dicom/utils/dicomsettings.h>
 
 namespace inviwo {
 
 class IVW_MODULE_DICOM_API DICOMModule : public InviwoModule {
 public:
     DICOMModule(InviwoApplication* app);
+
+    DICOMSettings settings;
 };
 
 }  // namespace inviwo
@@ -0,0 +1,115 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+#pragma once
+
+#include <inviwo/dicom/dicommoduledefine.h>
+#include <inviwo/core/common/inviwo.h>
+
+#include <inviwo/dicom/datastructures/dicomdirtypes.h>
+
+#include <functional>
+
+namespace inviwo {
+
+namespace dicomdir {
+
+struct IVW_MODULE_DICOM_API DecodeOptions {
+    size_t threads = 0;  //!< number of parallel decoders, 0 uses the thread pool default
+    /**
+     * called with the fraction of decoded images, always from the calling thread
+     */
+    std::function<void(float)> progress;
+    /**
+     * return true to cancel decoding, might be called from any of the worker threads
+     */
+    std::function<bool()> stop;
+};
+
+/**
+ * A box of voxels of a series, optionally keeping only every k-th slice
+ */
+struct IVW_MODULE_DICOM_API SeriesRegion {
+    size3_t offset{0};       //!< first voxel, z refers to the sorted slices of the series
+    size3_t extent{0};       //!< size of the box, 0 extends the box to the end of the series
+    size_t sliceStride = 1;  //!< keep every k-th slice of the box, starting with the first
+
+    /**
+     * dimensions of the region clamped to \p series, including the slice stride
+     */
+    size3_t dims(const Series& series) const;
+    /**
+     * true if the region covers all voxels of \p series
+     */
+    bool isComplete(const Series& series) const;
+};
+
+/**
+ * Decode the pixel data of all images of \p series in parallel on the thread pool. Every image is
+ * decoded by gdcm, including JPEG, JPEG 2000, and RLE compressed ones, straight into its slices of
+ * \p dest. The location of an image is given by its position in the sorted image list and the
+ * number of slices of the preceding images.
+ *
+ * @param series   series with up to date image information, see Series::updateImageInformation
+ * @param dest     preallocated buffer for series.dims voxels of series.pixelformat
+ * @param options  number of threads, progress and cancellation
+ * @return false if decoding was canceled, in which case \p dest is only partially filled
+ * @throws DataReaderException if an image cannot be read or does not match the series
+ */
+IVW_MODULE_DICOM_API bool decodeSeries(const Series& series, void* dest,
+                                       const DecodeOptions& options = {});
+
+/**
+ * Decode only the voxels of \p region of \p series. Only images containing slices of the region
+ * are read, each one is decoded once and the voxels of the region are copied into \p dest.
+ *
+ * @param series   series with up to date image information, see Series::updateImageInformation
+ * @param region   box and slice stride, see SeriesRegion::dims for the resulting dimensions
+ * @param dest     preallocated buffer for region.dims(series) voxels of series.pixelformat
+ * @param options  number of threads, progress and cancellation
+ * @return false if decoding was canceled, in which case \p dest is only partially filled
+ * @throws DataReaderException if an image cannot be read or does not match the series
+ */
+IVW_MODULE_DICOM_API bool decodeSeries(const Series& series, const SeriesRegion& region,
+                                       void* dest, const DecodeOptions& options = {});
+
+/**
+ * Decode the voxels of \p region of \p series, except for the region slices for which \p skip
+ * returns true, e.g. since they are already available from a preview. Skipped slices of \p dest
+ * are left untouched and images only containing skipped slices are not read.
+ *
+ * @param skip  called with the index of each slice of the region, i.e. in [0, dims.z)
+ * @see decodeSeries(const Series&, const SeriesRegion&, void*, const DecodeOptions&)
+ */
+IVW_MODULE_DICOM_API bool decodeSeries(const Series& series, const SeriesRegion& region,
+                                       void* dest, const std::function<bool(size_t)>& skip,
+                                       const DecodeOptions& options = {});
+
+}  // namespace dicomdir
+
+}  // namespace inviwo
@@ -0,0 +1,123 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+#pragma once
+
+#include <inviwo/dicom/dicommoduledefine.h>
+#include <inviwo/core/common/inviwo.h>
+
+#include <inviwo/dicom/datastructures/dicomdirtypes.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <map>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace inviwo {
+
+namespace dicomdir {
+
+/**
+ * On-disk index of the image headers of all files in a single directory. Each entry is stamped
+ * with the size and modification time of its file, an entry is only used while both match. Files
+ * which are not DICOM images are recorded as well, such that they are not parsed again either.
+ *
+ * Index files are stored in a common index directory, named by a hash of the indexed directory.
+ */
+class IVW_MODULE_DICOM_API DirectoryIndex {
+public:
+    struct IVW_MODULE_DICOM_API Stamp {
+        std::uintmax_t size = 0;
+        std::int64_t mtime = 0;
+
+        /**
+         * size and modification time of \p file, std::nullopt if they cannot be determined
+         */
+        static std::optional<Stamp> get(const std::filesystem::path& file);
+
+        friend bool operator==(const Stamp&, const Stamp&) = default;
+    };
+
+    struct IVW_MODULE_DICOM_API Entry {
+        Stamp stamp;
+        std::optional<ImageHeader> header;  //!< std::nullopt for files which are no DICOM images
+    };
+
+    /**
+     * Load the index of \p directory from \p indexDirectory. The index is empty if there is none
+     * or if it cannot be read.
+     */
+    DirectoryIndex(const std::filesystem::path& indexDirectory,
+                   const std::filesystem::path& directory);
+
+    /**
+     * find the entry of the file \p name if its stamp matches \p stamp. The image path of the
+     * returned header refers to the indexed directory.
+     */
+    const Entry* find(const std::string& name, const Stamp& stamp) const;
+
+    void insert(const std::string& name, Entry entry);
+
+    /**
+     * remove all entries which are not in \p sortedNames, i.e. deleted files
+     */
+    void retain(const std::vector<std::string>& sortedNames);
+
+    /**
+     * write the index if it has been modified since it was loaded
+     * @return false if the index file could not be written
+     */
+    bool save();
+
+    size_t size() const { return entries_.size(); }
+    bool isModified() const { return modified_; }
+
+    /**
+     * path of the index file of \p directory within \p indexDirectory
+     */
+    static std::filesystem::path indexFile(const std::filesystem::path& indexDirectory,
+                                           const std::filesystem::path& directory);
+
+    /**
+     * remove all index files from \p indexDirectory
+     */
+    static void clear(const std::filesystem::path& indexDirectory);
+
+private:
+    std::filesystem::path file_;
+    std::string key_;  //!< canonical path of the indexed directory
+    std::filesystem::path directory_;
+    std::map<std::string, Entry, std::less<>> entries_;
+    bool modified_ = false;
+};
+
+}  // namespace dicomdir
+
+}  // namespace inviwo
@@ -0,0 +1,104 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+#pragma once
+
+#include <inviwo/dicom/dicommoduledefine.h>
+#include <inviwo/core/common/inviwo.h>
+
+#include <inviwo/dicom/datastructures/dicomdirtypes.h>
+
+#include <filesystem>
+#include <functional>
+#include <optional>
+#include <vector>
+
+namespace inviwo {
+
+namespace dicomdir {
+
+struct IVW_MODULE_DICOM_API ScanOptions {
+    bool recursive = true;  //!< include all subdirectories
+    size_t threads = 0;     //!< number of parallel readers, 0 uses the thread pool default
+    /**
+     * location of the series index, see DirectoryIndex. If set, headers of unchanged files are
+     * taken from the index and only new or modified files are read. No index is used if empty.
+     */
+    std::filesystem::path indexDirectory;
+    /**
+     * called with the fraction of scanned files, always from the calling thread
+     */
+    std::function<void(float)> progress;
+    /**
+     * return true to cancel the scan, might be called from any of the worker threads
+     */
+    std::function<bool()> stop;
+};
+
+struct IVW_MODULE_DICOM_API ScannedSeries {
+    std::filesystem::path directory;  //!< directory containing the images of the series
+    Series series;
+};
+
+struct IVW_MODULE_DICOM_API ScanResult {
+    std::vector<ScannedSeries> series;
+    size_t files = 0;      //!< number of files considered
+    size_t images = 0;     //!< number of files with a readable DICOM image header
+    size_t indexed = 0;    //!< number of files taken from the series index
+    bool stopped = false;  //!< true if the scan was canceled, series will be empty
+};
+
+/**
+ * Read the headers of all \p files in parallel on the thread pool. Only the tags in front of the
+ * pixel data are read, i.e. no pixel data is decoded.
+ *
+ * @param files    files to read
+ * @param options  number of threads, progress and cancellation. The recursive flag is ignored.
+ * @return one entry per file, std::nullopt for files which are not DICOM images. The result is
+ *         empty if the scan was canceled.
+ */
+IVW_MODULE_DICOM_API std::vector<std::optional<ImageHeader>> readHeaders(
+    const std::vector<std::filesystem::path>& files, const ScanOptions& options = {});
+
+/**
+ * Scan \p directory for DICOM images and group them into series in a single pass. Images are
+ * grouped by their series UID per directory. The image information of each series is filled in
+ * and checked, see Series::updateImageInformation, and the images are sorted by slice position.
+ * Series are ordered by directory, with subdirectories following their parent, and by UID.
+ *
+ * @param directory  directory to scan
+ * @param options    recursion, number of threads, progress and cancellation
+ * @throws DataReaderException if a DICOM image lacks a series UID or the sanity checks of a series
+ *         fail
+ */
+IVW_MODULE_DICOM_API ScanResult scan(const std::filesystem::path& directory,
+                                     const ScanOptions& options = {});
+
+}  // namespace dicomdir
+
+}  // namespace inviwo
@@ -41,6 +41,7 @@
 #include <inviwo/core/io/datareaderexception.h>
 
 #include <inviwo/dicom/datastructures/dicomdirtypes.h>
+#include <inviwo/dicom/io/dicomdecoder.h>
 
 namespace gdcm {
 class DataSet;
@@ -71,6 +72,20 @@ public:
     virtual std::shared_ptr<VolumeSequence> readData(
         const std::filesystem::path& filePath) override;
 
+    /**
+     * Creates inviwo volume handle from DICOM series on disk.
+     * Only metadata, no actual voxels are returned. The image information of the series has to be
+     * up to date, see dicomdir::Series::updateImageInformation. The images of the series are
+     * sorted by slice position.
+     *
+     * @param series  the DICOM series
+     * @param path    used for error messages
+     * @param region  dimensions and placement of the volume are those of this part of the series
+     */
+    static std::shared_ptr<Volume> getVolumeDescription(
+        dicomdir::Series& series, const std::filesystem::path& path = {},
+        const dicomdir::SeriesRegion& region = {});
+
 private:
     /**
      * Try to read all volumes contained in given path using standard  format
@@ -79,10 +94,11 @@ private:
         const std::filesystem::path& dicomdirPath);
 
     /**
-     * Non-recursive version of tryReadDICOMsequenceRecursive
+     * Tries to read all volumes contained in given directory path, including subdirectories only
+     * if \p recursive is set. Files are scanned in parallel, see dicomdir::scan.
      */
     static std::shared_ptr<VolumeSequence> tryReadDICOMsequence(
-        const std::filesystem::path& sequenceDirectory);
+        const std::filesystem::path& sequenceDirectory, bool recursive = false);
 
     /**
      * Tries to read all volumes contained in given directory path, including subdirectories.
@@ -91,12 +107,6 @@ private:
     static std::shared_ptr<VolumeSequence> tryReadDICOMsequenceRecursive(
         const std::filesystem::path& directory);
 
-    /**
-     * Creates inviwo volume handle from DICOM series on disk.
-     * Only metadata, no actual voxels are returned.
-     */
-    static std::shared_ptr<Volume> getVolumeDescription(dicomdir::Series& series,
-                                                        const std::filesystem::path& path = {});
 
     std::filesystem::path file_;
     const DataFormatBase* format_;
@@ -122,6 +132,13 @@ public:
     virtual void updateRepresentation(std::shared_ptr<VolumeRepresentation> dest,
                                       const VolumeRepresentation&) const override;
 
+    /**
+     * Set the number of threads and the cancellation used when decoding the images of the
+     * series. If canceled, creating or updating the representation throws a DataReaderException.
+     */
+    void setDecodeOptions(dicomdir::DecodeOptions options);
+    const dicomdir::DecodeOptions& getDecodeOptions() const;
+
 private:
     void getVolumeData(const dicomdir::Series& series, void* outData) const;  // static here?
     std::filesystem::path file_;  // only relevant for single volumes
@@ -129,6 +146,7 @@ private:
     const DataFormatBase* format_;
     bool isPartOfSequence_;
     dicomdir::Series series_;
+    dicomdir::DecodeOptions decodeOptions_;
 };
 
 }  // namespace inviwo
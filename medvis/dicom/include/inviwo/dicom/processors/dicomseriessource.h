@@ -0,0 +1,102 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+#pragma once
+
+#include <inviwo/dicom/dicommoduledefine.h>
+#include <inviwo/core/common/inviwo.h>
+#include <inviwo/core/processors/poolprocessor.h>
+#include <inviwo/core/ports/volumeport.h>
+#include <inviwo/core/properties/boolproperty.h>
+#include <inviwo/core/properties/buttonproperty.h>
+#include <inviwo/core/properties/compositeproperty.h>
+#include <inviwo/core/properties/directoryproperty.h>
+#include <inviwo/core/properties/minmaxproperty.h>
+#include <inviwo/core/properties/optionproperty.h>
+#include <inviwo/core/properties/ordinalproperty.h>
+
+#include <inviwo/dicom/io/dicomdecoder.h>
+#include <inviwo/dicom/io/dicomscanner.h>
+
+#include <memory>
+
+namespace inviwo {
+
+/** \docpage{org.inviwo.DICOMSeriesSource, DICOM Series Source}
+ * ![](org.inviwo.DICOMSeriesSource.png?classIdentifier=org.inviwo.DICOMSeriesSource)
+ * Loads a region of a DICOM series from a directory. The directory is scanned in the background,
+ * and only the images containing slices of the region are decoded, in parallel in the background.
+ * With progressive loading, a preview with fewer slices is published first and replaced by the
+ * full region once the missing slices are decoded.
+ *
+ * ### Outports
+ *   * __volume__   the selected region of the DICOM series
+ *
+ * ### Properties
+ *   * __Directory__       directory containing the DICOM images
+ *   * __Series__          series to load, all series found in the directory are listed
+ *   * __Region of Interest__  voxel range in x and y and slice range of the loaded region
+ *   * __Slice Stride__    load only every k-th slice of the region
+ *   * __Progressive Loading__ publish a preview with the preview stride first
+ */
+class IVW_MODULE_DICOM_API DICOMSeriesSource : public PoolProcessor {
+public:
+    DICOMSeriesSource();
+    virtual ~DICOMSeriesSource() = default;
+
+    virtual void process() override;
+
+    virtual const ProcessorInfo& getProcessorInfo() const override;
+    static const ProcessorInfo processorInfo_;
+
+private:
+    void scan();
+    void updateSeries();
+    void load();
+
+    VolumeOutport outport_;
+
+    DirectoryProperty directory_;
+    BoolProperty recursive_;
+    ButtonProperty rescan_;
+    OptionPropertyInt series_;
+
+    CompositeProperty region_;
+    IntSizeTMinMaxProperty rangeX_;
+    IntSizeTMinMaxProperty rangeY_;
+    IntSizeTMinMaxProperty slices_;
+    IntSizeTProperty sliceStride_;
+
+    BoolProperty progressive_;
+    IntSizeTProperty previewStride_;
+
+    dicomdir::ScanResult scanned_;
+    bool loadPending_ = false;  ///< set when a scan has finished
+};
+
+}  // namespace inviwo
@@ -0,0 +1,60 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+#pragma once
+
+#include <inviwo/dicom/dicommoduledefine.h>
+
+#include <cstddef>
+#include <functional>
+
+namespace inviwo {
+
+namespace gdcmutil {
+
+/**
+ * Call \p func for each index in [0, \p count) on the thread pool using util::forEachParallelAsync,
+ * adding cancellation, progress and error handling. Exceptions thrown by \p func stop the
+ * remaining indices from being processed and the first one is rethrown once all jobs have
+ * finished.
+ *
+ * @param count     number of indices
+ * @param threads   number of jobs, 0 uses the default of util::forEachParallelAsync
+ * @param func      called once per index, concurrently from different threads
+ * @param progress  optional, called with the fraction of finished indices from the calling thread
+ * @param stop      optional, return true to cancel. Might be called from any of the workers.
+ * @return false if canceled by \p stop, true otherwise
+ */
+IVW_MODULE_DICOM_API bool parallelFor(size_t count, size_t threads,
+                                      const std::function<void(size_t)>& func,
+                                      const std::function<void(float)>& progress = {},
+                                      const std::function<bool()>& stop = {});
+
+}  // namespace gdcmutil
+
+}  // namespace inviwo
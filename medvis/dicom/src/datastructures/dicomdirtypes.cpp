@@ -34,6 +34,7 @@
 #include <inviwo/core/util/stdextensions.h>
 #include <inviwo/core/util/filesystem.h>
 #include <inviwo/core/util/glmmat.h>
+#include <inviwo/core/util/stringconversion.h>
 
 #include <fmt/format.h>
 #include <fmt/std.h>
@@ -46,12 +47,14 @@
 
 #include <gdcmImageHelper.h>
 #include <gdcmImageReader.h>
+#include <gdcmReader.h>
 #include <gdcmAttribute.h>
 #include <gdcmMediaStorage.h>
 #include <warn/pop>
 
 #include <algorithm>
 #include <array>
+#include <fstream>
 
 namespace inviwo {
 
@@ -88,9 +91,9 @@ void Image::updateInfo(const gdcm::DataSet& dataset) {
     updateZpos();
 }
 
-void Image::updateInfo(const gdcm::ImageReader& reader) {
-    const auto& file = reader.GetFile();
+void Image::updateInfo(const gdcm::ImageReader& reader) { updateInfo(reader.GetFile()); }
 
+void Image::updateInfo(const gdcm::File& file) {
     windowCenter = gdcmutil::getTag(file.GetDataSet(), 0x0028, 0x1050);
     windowWidth = gdcmutil::getTag(file.GetDataSet(), 0x0028, 0x1051);
 
@@ -125,28 +128,65 @@ void Image::updateZpos() {
     zPos = glm::dot(origin, glm::cross(orientationX, orientationY));
 }
 
-namespace {
+std::optional<ImageHeader> ImageHeader::read(const std::filesystem::path& path) {
+    std::ifstream stream(path, std::ios::binary);
+    if (!stream.is_open()) {
+        return std::nullopt;
+    }
 
-struct ImageMetaData {
-    ImageMetaData() = default;
-    ImageMetaData(const gdcm::ImageReader& reader, const dicomdir::Image& imgInfo) {
-        set(reader, imgInfo);
+    // all tags needed here are stored in front of the pixel data, stop reading there
+    gdcm::Reader reader;
+    reader.SetStream(stream);
+    if (!reader.ReadUpToTag(gdcm::Tag(0x7fe0, 0x0010))) {
+        return std::nullopt;
+    }
+
+    const gdcm::File& file = reader.GetFile();
+    const gdcm::DataSet& dataset = file.GetDataSet();
+    // skip DICOM files without an image, e.g. DICOMDIR or structured reports
+    if (!dataset.FindDataElement(gdcm::Tag(0x0028, 0x0010))) {
+        return std::nullopt;
     }
 
-    void set(const gdcm::ImageReader& reader, const dicomdir::Image& imgInfo) {
-        dims = size2_t{imgInfo.dims};
-        pixelSpacing = imgInfo.pixelSpacing;
-        orientation[0] = imgInfo.orientationX;
-        orientation[1] = imgInfo.orientationY;
-        origin = imgInfo.origin;
+    ImageHeader header;
+    header.image.path = path.string();
+    header.image.updateInfo(file);
+    header.seriesUID = gdcmutil::getTag(dataset, 0x0020, 0x000E);
+    header.instanceUID = gdcmutil::getTag(dataset, 0x0008, 0x0018);
+    header.seriesDesc = trim(gdcmutil::getTag(dataset, 0x0008, 0x103E));
+
+    gdcm::MediaStorage dicomMediaStorage;
+    dicomMediaStorage.SetFromFile(file);
+    if (const char* modality = dicomMediaStorage.GetModality()) {
+        header.modality = modality;
+    }
+
+    header.photometric = gdcm::ImageHelper::GetPhotometricInterpretationValue(file);
+    header.pixelformat = gdcm::ImageHelper::GetPixelFormatValue(file);
+    auto interceptSlopeVec = gdcm::ImageHelper::GetRescaleInterceptSlopeValue(file);
+    header.intercept = interceptSlopeVec[0];
+    header.slope = interceptSlopeVec[1];
+
+    return header;
+}
 
-        const gdcm::File& file = reader.GetFile();
+namespace {
 
-        photometric = gdcm::ImageHelper::GetPhotometricInterpretationValue(file);
-        pixelformat = gdcm::ImageHelper::GetPixelFormatValue(file);
-        auto interceptSlopeVec = gdcm::ImageHelper::GetRescaleInterceptSlopeValue(file);
-        intercept = interceptSlopeVec[0];
-        slope = interceptSlopeVec[1];
+struct ImageMetaData {
+    ImageMetaData() = default;
+    ImageMetaData(const ImageHeader& header) { set(header); }
+
+    void set(const ImageHeader& header) {
+        dims = size2_t{header.image.dims};
+        pixelSpacing = header.image.pixelSpacing;
+        orientation[0] = header.image.orientationX;
+        orientation[1] = header.image.orientationY;
+        origin = header.image.origin;
+
+        photometric = header.photometric;
+        pixelformat = header.pixelformat;
+        intercept = header.intercept;
+        slope = header.slope;
     }
 
     size2_t dims{0};
@@ -164,6 +204,19 @@ struct ImageMetaData {
 Series::Series(const std::string& description) : desc{description} {}
 
 void Series::updateImageInformation(const std::filesystem::path& dicompath) {
+    std::vector<ImageHeader> headers;
+    headers.reserve(images.size());
+    for (const auto& imgInfo : images) {
+        // images which cannot be read are dropped from the series
+        if (auto header = ImageHeader::read(imgInfo.path)) {
+            headers.push_back(std::move(*header));
+        }
+    }
+    updateImageInformation(headers, dicompath);
+}
+
+void Series::updateImageInformation(const std::vector<ImageHeader>& headers,
+                                    const std::filesystem::path& dicompath) {
 
     // According to the standard the following parameters should be the same within a
     // series:
@@ -222,30 +275,19 @@ void Series::updateImageInformation(const std::filesystem::path& dicompath) {
 
     bool first = true;
     ImageMetaData refImage;
-    for (auto& imgInfo : images) {
-        gdcm::ImageReader imageReader;
-        auto imageInputStream = std::ifstream(imgInfo.path, std::ios::binary);
-        imageReader.SetStream(imageInputStream);
-
-        if (!imageInputStream.is_open() || !imageReader.CanRead()) {
-            imgInfo.dims = {0, 0, 0};
+    images.clear();
+    images.reserve(headers.size());
+    for (const auto& header : headers) {
+        if (header.image.empty()) {
             continue;
         }
-        if (!imageReader.Read()) {
-            throw DataReaderException(
-                fmt::format("could not read image '{}' in DICOM series '{}' ('{}')", imgInfo.path,
-                            desc, dicompath),
-                IVW_CONTEXT);
-        }
-
-        imgInfo.updateInfo(imageReader);
-
         if (first) {
             first = false;
-            refImage.set(imageReader, imgInfo);
+            refImage.set(header);
         } else {
-            sanityCheck(refImage, ImageMetaData{imageReader, imgInfo});
+            sanityCheck(refImage, ImageMetaData{header});
         }
+        images.push_back(header.image);
     }
 
     if (warnSlopeIntercept) {
@@ -264,8 +306,6 @@ void Series::updateImageInformation(const std::filesystem::path& dicompath) {
         LogWarn(fmt::format("origins differ in DICOM series '{}' ('{}')", desc, dicompath));
     }
 
-    util::erase_remove_if(images, [](dicomdir::Image& image) { return image.empty(); });
-
     // determine stack height, i.e. number of slices/images
     const size_t numslices =
         std::accumulate(images.begin(), images.end(), size_t{0},
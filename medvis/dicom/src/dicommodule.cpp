@@ -30,12 +30,21 @@
 #include <inviwo/dicom/dicommodule.h>
 #include <inviwo/dicom/io/gdcmvolumereader.h>
 #include <inviwo/dicom/io/mevisvolumereader.h>
+#include <inviwo/dicom/io/dicomindex.h>
+#include <inviwo/dicom/processors/dicomseriessource.h>
 
 namespace inviwo {
 
 DICOMModule::DICOMModule(InviwoApplication* app) : InviwoModule(app, "DICOM") {
+    registerProcessor<DICOMSeriesSource>();
+
     registerDataReader(std::make_unique<GdcmVolumeReader>());
     registerDataReader(std::make_unique<MevisVolumeReader>());
+
+    settings.clearSeriesIndex.onChange(
+        [this]() { dicomdir::DirectoryIndex::clear(settings.seriesIndexDirectory.get()); });
+
+    registerSettings(&settings);
 }
 
 }  // namespace inviwo
@@ -0,0 +1,193 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/dicom/io/dicomdecoder.h>
+#include <inviwo/dicom/utils/parallelfor.h>
+
+#include <inviwo/core/io/datareaderexception.h>
+
+#include <fmt/format.h>
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gdcmImage.h>
+#include <gdcmImageReader.h>
+#include <warn/pop>
+
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+namespace inviwo {
+
+namespace dicomdir {
+
+namespace {
+
+// first slice of each image within the series, the last element is the total number of slices
+std::vector<size_t> firstSlices(const Series& series) {
+    std::vector<size_t> first(series.images.size() + 1, 0);
+    for (size_t i = 0; i < series.images.size(); ++i) {
+        first[i + 1] = first[i] + series.images[i].dims.z;
+    }
+    if (first.back() != series.dims.z) {
+        throw DataReaderException(
+            fmt::format("number of slices in DICOM series '{}' does not match, expected {} but "
+                        "found {}",
+                        series.desc, series.dims.z, first.back()),
+            IVW_CONTEXT_CUSTOM("dicomdir::decodeSeries"));
+    }
+    return first;
+}
+
+// decode all slices of a single image into dest, which has to hold expectedBytes
+void decodeImage(const Image& imgInfo, size_t expectedBytes, char* dest) {
+    std::ifstream imageInputStream(imgInfo.path, std::ios::binary);
+    if (!imageInputStream.is_open()) {
+        throw DataReaderException(fmt::format("file cannot be opened ({})", imgInfo.path),
+                                  IVW_CONTEXT_CUSTOM("dicomdir::decodeSeries"));
+    }
+
+    gdcm::ImageReader imageReader;
+    imageReader.SetStream(imageInputStream);
+    if (!imageReader.Read()) {
+        throw DataReaderException(fmt::format("could not read image ({})", imgInfo.path),
+                                  IVW_CONTEXT_CUSTOM("dicomdir::decodeSeries"));
+    }
+
+    // Get RAW image (gdcm does the decoding for us)
+    const gdcm::Image& image = imageReader.GetImage();
+    if (image.GetBufferLength() != expectedBytes) {
+        throw DataReaderException(
+            fmt::format("unexpected size of image data, expected {} bytes but found {} ({})",
+                        expectedBytes, image.GetBufferLength(), imgInfo.path),
+            IVW_CONTEXT_CUSTOM("dicomdir::decodeSeries"));
+    }
+    if (!image.GetBuffer(dest)) {
+        throw DataReaderException(fmt::format("could not read image data ({})", imgInfo.path),
+                                  IVW_CONTEXT_CUSTOM("dicomdir::decodeSeries"));
+    }
+}
+
+}  // namespace
+
+size3_t SeriesRegion::dims(const Series& series) const {
+    size3_t result{0};
+    for (int i = 0; i < 3; ++i) {
+        const size_t start = std::min(offset[i], series.dims[i]);
+        const size_t available = series.dims[i] - start;
+        result[i] = extent[i] == 0 ? available : std::min(extent[i], available);
+    }
+    const size_t stride = std::max(sliceStride, size_t{1});
+    result.z = (result.z + stride - 1) / stride;
+    return result;
+}
+
+bool SeriesRegion::isComplete(const Series& series) const {
+    return offset == size3_t{0} && sliceStride <= 1 && dims(series) == series.dims;
+}
+
+bool decodeSeries(const Series& series, void* dest, const DecodeOptions& options) {
+    const size_t sliceBytes =
+        series.dims.x * series.dims.y * static_cast<size_t>(series.pixelformat.GetPixelSize());
+    const auto first = firstSlices(series);
+
+    auto* data = static_cast<char*>(dest);
+    return gdcmutil::parallelFor(
+        series.images.size(), options.threads,
+        [&](size_t i) {
+            const auto& imgInfo = series.images[i];
+            decodeImage(imgInfo, imgInfo.dims.z * sliceBytes, data + first[i] * sliceBytes);
+        },
+        options.progress, options.stop);
+}
+
+bool decodeSeries(const Series& series, const SeriesRegion& region, void* dest,
+                  const DecodeOptions& options) {
+    if (region.isComplete(series)) {
+        return decodeSeries(series, dest, options);
+    }
+    return decodeSeries(series, region, dest, {}, options);
+}
+
+bool decodeSeries(const Series& series, const SeriesRegion& region, void* dest,
+                  const std::function<bool(size_t)>& skip, const DecodeOptions& options) {
+
+    const size3_t dims = region.dims(series);
+    if (glm::compMul(dims) == 0) return true;
+
+    const size_t pixelSize = static_cast<size_t>(series.pixelformat.GetPixelSize());
+    const size_t rowBytes = series.dims.x * pixelSize;
+    const size_t sliceBytes = series.dims.y * rowBytes;
+    const size_t regionRowBytes = dims.x * pixelSize;
+    const size_t regionSliceBytes = dims.y * regionRowBytes;
+    const size_t stride = std::max(region.sliceStride, size_t{1});
+    const auto first = firstSlices(series);
+
+    // slices of the region grouped by image, as pairs of region slice and slice within the image
+    std::vector<std::vector<std::pair<size_t, size_t>>> slicesPerImage(series.images.size());
+    for (size_t z = 0; z < dims.z; ++z) {
+        if (skip && skip(z)) continue;
+        const size_t seriesSlice = region.offset.z + z * stride;
+        const auto it = std::upper_bound(first.begin(), first.end(), seriesSlice);
+        const auto image = static_cast<size_t>(std::distance(first.begin(), it)) - 1;
+        slicesPerImage[image].emplace_back(z, seriesSlice - first[image]);
+    }
+    std::vector<size_t> images;
+    for (size_t i = 0; i < slicesPerImage.size(); ++i) {
+        if (!slicesPerImage[i].empty()) images.push_back(i);
+    }
+
+    auto* data = static_cast<char*>(dest);
+    return gdcmutil::parallelFor(
+        images.size(), options.threads,
+        [&](size_t j) {
+            const size_t i = images[j];
+            const auto& imgInfo = series.images[i];
+            std::vector<char> buffer(imgInfo.dims.z * sliceBytes);
+            decodeImage(imgInfo, buffer.size(), buffer.data());
+
+            for (const auto& [regionSlice, imageSlice] : slicesPerImage[i]) {
+                for (size_t y = 0; y < dims.y; ++y) {
+                    const char* src = buffer.data() + imageSlice * sliceBytes +
+                                      (region.offset.y + y) * rowBytes +
+                                      region.offset.x * pixelSize;
+                    char* dst = data + regionSlice * regionSliceBytes + y * regionRowBytes;
+                    std::copy_n(src, regionRowBytes, dst);
+                }
+            }
+        },
+        options.progress, options.stop);
+}
+
+}  // namespace dicomdir
+
+}  // namespace inviwo
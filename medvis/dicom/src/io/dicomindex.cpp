@@ -0,0 +1,304 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/dicom/io/dicomindex.h>
+
+#include <fmt/format.h>
+#include <fmt/std.h>
+
+#include <algorithm>
+#include <charconv>
+#include <cstdlib>
+#include <fstream>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+
+namespace inviwo {
+
+namespace dicomdir {
+
+namespace {
+
+constexpr std::string_view indexMagic = "inviwo-dicom-index";
+constexpr int indexVersion = 1;
+constexpr std::string_view indexExtension = ".dcmindex";
+
+// FNV-1a, stable across platforms and runs unlike std::hash
+std::uint64_t hashPath(std::string_view path) {
+    std::uint64_t hash = 14695981039346656037ull;
+    for (char c : path) {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+std::string canonicalKey(const std::filesystem::path& directory) {
+    std::error_code ec;
+    auto canonical = std::filesystem::weakly_canonical(directory, ec);
+    return ec ? directory.generic_string() : canonical.generic_string();
+}
+
+// fields are tab separated and entries are newline separated
+std::string sanitize(std::string_view str) {
+    std::string result{str};
+    std::replace_if(
+        result.begin(), result.end(), [](char c) { return c == '\t' || c == '\n' || c == '\r'; },
+        ' ');
+    return result;
+}
+
+class FieldReader {
+public:
+    explicit FieldReader(std::string_view line) : line_{line} {}
+
+    std::string_view next() {
+        if (pos_ > line_.size()) throw std::runtime_error("missing field");
+        const auto end = std::min(line_.find('\t', pos_), line_.size());
+        const auto field = line_.substr(pos_, end - pos_);
+        pos_ = end + 1;
+        return field;
+    }
+    std::string str() { return std::string{next()}; }
+
+    template <typename T>
+    T number() {
+        const auto field = next();
+        if constexpr (std::is_floating_point_v<T>) {
+            // std::from_chars for floating point types is not available on all platforms
+            const std::string str{field};
+            char* end = nullptr;
+            const T value = static_cast<T>(std::strtod(str.c_str(), &end));
+            if (str.empty() || end != str.c_str() + str.size()) {
+                throw std::runtime_error("invalid number");
+            }
+            return value;
+        } else {
+            T value{};
+            if (auto [ptr, ec] = std::from_chars(field.data(), field.data() + field.size(), value);
+                ec != std::errc{} || ptr != field.data() + field.size()) {
+                throw std::runtime_error("invalid number");
+            }
+            return value;
+        }
+    }
+    template <typename V>
+    V vec() {
+        V v{};
+        for (int i = 0; i < V::length(); ++i) {
+            v[i] = number<typename V::value_type>();
+        }
+        return v;
+    }
+
+private:
+    std::string_view line_;
+    size_t pos_ = 0;
+};
+
+template <typename V>
+void writeVec(std::ostream& os, const V& v) {
+    for (int i = 0; i < V::length(); ++i) {
+        os << '\t' << fmt::format("{}", v[i]);
+    }
+}
+
+void writeEntry(std::ostream& os, const std::string& name, const DirectoryIndex::Entry& entry) {
+    os << name << '\t' << entry.stamp.size << '\t' << entry.stamp.mtime;
+    if (!entry.header) {
+        os << "\t0\n";
+        return;
+    }
+    const auto& h = *entry.header;
+    os << "\t1\t" << sanitize(h.seriesUID) << '\t' << sanitize(h.instanceUID) << '\t'
+       << sanitize(h.seriesDesc) << '\t' << sanitize(h.modality) << '\t'
+       << sanitize(h.image.windowCenter) << '\t' << sanitize(h.image.windowWidth) << '\t'
+       << fmt::format("{}", h.image.sliceThickness);
+    writeVec(os, h.image.dims);
+    writeVec(os, h.image.orientationX);
+    writeVec(os, h.image.orientationY);
+    writeVec(os, h.image.origin);
+    writeVec(os, h.image.pixelSpacing);
+    os << '\t' << h.pixelformat.GetSamplesPerPixel() << '\t' << h.pixelformat.GetBitsAllocated()
+       << '\t' << h.pixelformat.GetBitsStored() << '\t' << h.pixelformat.GetHighBit() << '\t'
+       << h.pixelformat.GetPixelRepresentation() << '\t'
+       << static_cast<int>(static_cast<gdcm::PhotometricInterpretation::PIType>(h.photometric))
+       << '\t' << fmt::format("{}", h.intercept) << '\t' << fmt::format("{}", h.slope) << '\n';
+}
+
+std::pair<std::string, DirectoryIndex::Entry> readEntry(std::string_view line,
+                                                        const std::filesystem::path& directory) {
+    FieldReader fields{line};
+    std::string name = fields.str();
+    DirectoryIndex::Entry entry;
+    entry.stamp.size = fields.number<std::uintmax_t>();
+    entry.stamp.mtime = fields.number<std::int64_t>();
+    if (fields.number<int>() == 0) {
+        return {std::move(name), std::move(entry)};
+    }
+
+    ImageHeader h;
+    h.image.path = (directory / name).string();
+    h.seriesUID = fields.str();
+    h.instanceUID = fields.str();
+    h.seriesDesc = fields.str();
+    h.modality = fields.str();
+    h.image.windowCenter = fields.str();
+    h.image.windowWidth = fields.str();
+    h.image.sliceThickness = fields.number<double>();
+    h.image.dims = fields.vec<size3_t>();
+    h.image.orientationX = fields.vec<dvec3>();
+    h.image.orientationY = fields.vec<dvec3>();
+    h.image.origin = fields.vec<dvec3>();
+    h.image.pixelSpacing = fields.vec<dvec3>();
+    h.image.updateZpos();
+
+    const auto samplesPerPixel = fields.number<unsigned short>();
+    const auto bitsAllocated = fields.number<unsigned short>();
+    const auto bitsStored = fields.number<unsigned short>();
+    const auto highBit = fields.number<unsigned short>();
+    const auto pixelRepresentation = fields.number<unsigned short>();
+    h.pixelformat = gdcm::PixelFormat(samplesPerPixel, bitsAllocated, bitsStored, highBit,
+                                      pixelRepresentation);
+    h.photometric = gdcm::PhotometricInterpretation(
+        static_cast<gdcm::PhotometricInterpretation::PIType>(fields.number<int>()));
+    h.intercept = fields.number<double>();
+    h.slope = fields.number<double>();
+
+    entry.header = std::move(h);
+    return {std::move(name), std::move(entry)};
+}
+
+}  // namespace
+
+std::optional<DirectoryIndex::Stamp> DirectoryIndex::Stamp::get(const std::filesystem::path& file) {
+    std::error_code ec;
+    const auto size = std::filesystem::file_size(file, ec);
+    if (ec) return std::nullopt;
+    const auto time = std::filesystem::last_write_time(file, ec);
+    if (ec) return std::nullopt;
+    return Stamp{size, static_cast<std::int64_t>(time.time_since_epoch().count())};
+}
+
+DirectoryIndex::DirectoryIndex(const std::filesystem::path& indexDirectory,
+                               const std::filesystem::path& directory)
+    : file_{indexFile(indexDirectory, directory)}
+    , key_{canonicalKey(directory)}
+    , directory_{directory} {
+
+    std::ifstream in(file_, std::ios::binary);
+    if (!in) return;
+
+    std::string line;
+    if (!std::getline(in, line)) return;
+    try {
+        FieldReader fields{line};
+        if (fields.next() != indexMagic || fields.number<int>() != indexVersion ||
+            fields.next() != key_) {
+            // outdated format or a hash collision, the index is rebuilt
+            return;
+        }
+        while (std::getline(in, line)) {
+            if (line.empty()) continue;
+            entries_.insert(readEntry(line, directory_));
+        }
+    } catch (const std::exception&) {
+        entries_.clear();
+        modified_ = true;
+    }
+}
+
+const DirectoryIndex::Entry* DirectoryIndex::find(const std::string& name,
+                                                  const Stamp& stamp) const {
+    if (auto it = entries_.find(name); it != entries_.end() && it->second.stamp == stamp) {
+        return &it->second;
+    }
+    return nullptr;
+}
+
+void DirectoryIndex::insert(const std::string& name, Entry entry) {
+    // names which cannot be represented in the index are never cached
+    if (name.find_first_of("\t\n\r") != std::string::npos) return;
+    entries_.insert_or_assign(name, std::move(entry));
+    modified_ = true;
+}
+
+void DirectoryIndex::retain(const std::vector<std::string>& sortedNames) {
+    const auto erased = std::erase_if(entries_, [&](const auto& item) {
+        return !std::binary_search(sortedNames.begin(), sortedNames.end(), item.first);
+    });
+    if (erased > 0) modified_ = true;
+}
+
+bool DirectoryIndex::save() {
+    if (!modified_) return true;
+
+    std::error_code ec;
+    std::filesystem::create_directories(file_.parent_path(), ec);
+
+    // write to a temporary file first such that concurrent readers never see a partial index
+    auto tmp = file_;
+    tmp += ".tmp";
+    {
+        std::ofstream out(tmp, std::ios::binary | std::ios::trunc);
+        if (!out) return false;
+        out << indexMagic << '\t' << indexVersion << '\t' << key_ << '\n';
+        for (const auto& [name, entry] : entries_) {
+            writeEntry(out, name, entry);
+        }
+        if (!out) return false;
+    }
+    std::filesystem::rename(tmp, file_, ec);
+    if (ec) {
+        std::filesystem::remove(tmp, ec);
+        return false;
+    }
+    modified_ = false;
+    return true;
+}
+
+std::filesystem::path DirectoryIndex::indexFile(const std::filesystem::path& indexDirectory,
+                                                const std::filesystem::path& directory) {
+    return indexDirectory /
+           fmt::format("{:016x}{}", hashPath(canonicalKey(directory)), indexExtension);
+}
+
+void DirectoryIndex::clear(const std::filesystem::path& indexDirectory) {
+    std::error_code ec;
+    for (const auto& item : std::filesystem::directory_iterator(indexDirectory, ec)) {
+        if (item.path().extension() == indexExtension) {
+            std::filesystem::remove(item.path(), ec);
+        }
+    }
+}
+
+}  // namespace dicomdir
+
+}  // namespace inviwo
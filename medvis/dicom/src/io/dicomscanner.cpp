@@ -0,0 +1,178 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/dicom/io/dicomscanner.h>
+#include <inviwo/dicom/io/dicomindex.h>
+#include <inviwo/dicom/utils/parallelfor.h>
+
+#include <inviwo/core/io/datareaderexception.h>
+#include <inviwo/core/util/filesystem.h>
+#include <inviwo/core/util/logcentral.h>
+
+#include <fmt/format.h>
+#include <fmt/std.h>
+
+#include <algorithm>
+#include <map>
+#include <utility>
+
+namespace inviwo {
+
+namespace dicomdir {
+
+namespace {
+
+void collectDirectories(const std::filesystem::path& directory, bool recursive,
+                        std::vector<std::filesystem::path>& directories) {
+    directories.push_back(directory);
+    if (!recursive) return;
+
+    auto children = filesystem::getDirectoryContents(directory, filesystem::ListMode::Directories);
+    std::sort(children.begin(), children.end());
+    for (const auto& child : children) {
+        collectDirectories(directory / child, recursive, directories);
+    }
+}
+
+}  // namespace
+
+std::vector<std::optional<ImageHeader>> readHeaders(const std::vector<std::filesystem::path>& files,
+                                                    const ScanOptions& options) {
+    std::vector<std::optional<ImageHeader>> headers(files.size());
+    const bool finished = gdcmutil::parallelFor(
+        files.size(), options.threads, [&](size_t i) { headers[i] = ImageHeader::read(files[i]); },
+        options.progress, options.stop);
+    if (!finished) return {};
+    return headers;
+}
+
+ScanResult scan(const std::filesystem::path& directory, const ScanOptions& options) {
+    std::vector<std::filesystem::path> directories;
+    collectDirectories(directory, options.recursive, directories);
+
+    std::vector<std::vector<std::string>> names(directories.size());
+    std::vector<std::filesystem::path> files;
+    std::vector<std::pair<size_t, size_t>> fileLocation;  // directory and name index
+    for (size_t dirIndex = 0; dirIndex < directories.size(); ++dirIndex) {
+        for (const auto& name : filesystem::getDirectoryContents(directories[dirIndex])) {
+            names[dirIndex].push_back(std::filesystem::path{name}.string());
+        }
+        std::sort(names[dirIndex].begin(), names[dirIndex].end());
+        for (size_t nameIndex = 0; nameIndex < names[dirIndex].size(); ++nameIndex) {
+            files.push_back(directories[dirIndex] / names[dirIndex][nameIndex]);
+            fileLocation.emplace_back(dirIndex, nameIndex);
+        }
+    }
+
+    ScanResult result;
+    result.files = files.size();
+
+    std::vector<std::optional<DirectoryIndex>> indices(directories.size());
+    std::vector<std::optional<DirectoryIndex::Stamp>> stamps(files.size());
+    std::vector<std::optional<ImageHeader>> headers(files.size());
+    std::vector<size_t> unindexed;
+    if (!options.indexDirectory.empty()) {
+        for (size_t dirIndex = 0; dirIndex < directories.size(); ++dirIndex) {
+            indices[dirIndex].emplace(options.indexDirectory, directories[dirIndex]);
+        }
+    }
+    for (size_t i = 0; i < files.size(); ++i) {
+        const auto [dirIndex, nameIndex] = fileLocation[i];
+        if (auto& index = indices[dirIndex]) {
+            stamps[i] = DirectoryIndex::Stamp::get(files[i]);
+            if (stamps[i]) {
+                if (const auto* entry = index->find(names[dirIndex][nameIndex], *stamps[i])) {
+                    headers[i] = entry->header;
+                    ++result.indexed;
+                    continue;
+                }
+            }
+        }
+        unindexed.push_back(i);
+    }
+
+    // only new and modified files are parsed
+    std::vector<std::filesystem::path> unindexedFiles;
+    unindexedFiles.reserve(unindexed.size());
+    for (auto i : unindexed) {
+        unindexedFiles.push_back(files[i]);
+    }
+    auto parsed = readHeaders(unindexedFiles, options);
+    if (parsed.size() != unindexedFiles.size()) {
+        result.stopped = true;
+        return result;
+    }
+    for (size_t j = 0; j < unindexed.size(); ++j) {
+        const auto i = unindexed[j];
+        const auto [dirIndex, nameIndex] = fileLocation[i];
+        if (indices[dirIndex] && stamps[i]) {
+            indices[dirIndex]->insert(names[dirIndex][nameIndex], {*stamps[i], parsed[j]});
+        }
+        headers[i] = std::move(parsed[j]);
+    }
+    for (size_t dirIndex = 0; dirIndex < directories.size(); ++dirIndex) {
+        if (auto& index = indices[dirIndex]) {
+            index->retain(names[dirIndex]);
+            if (!index->save()) {
+                log::warn("could not write DICOM series index of '{}' to '{}'",
+                          directories[dirIndex], options.indexDirectory);
+            }
+        }
+    }
+
+    // images with the same series UID belong to the same volume
+    std::map<std::pair<size_t, std::string>, std::vector<ImageHeader>> seriesByUID;
+    for (size_t i = 0; i < headers.size(); ++i) {
+        if (!headers[i]) continue;  // skip non-dicom files
+
+        ++result.images;
+        if (headers[i]->seriesUID.empty()) {
+            throw DataReaderException(fmt::format("could not find DICOM series UID ({})", files[i]),
+                                      IVW_CONTEXT_CUSTOM("dicomdir::scan"));
+        }
+        seriesByUID[{fileLocation[i].first, headers[i]->seriesUID}].push_back(
+            std::move(*headers[i]));
+    }
+
+    for (const auto& [key, seriesHeaders] : seriesByUID) {
+        ScannedSeries item{directories[key.first], Series{seriesHeaders.front().seriesDesc}};
+        if (!seriesHeaders.front().modality.empty()) {
+            item.series.modality = seriesHeaders.front().modality;
+        }
+        item.series.updateImageInformation(seriesHeaders, item.directory);
+        item.series.sortImages();
+        result.series.push_back(std::move(item));
+    }
+
+    return result;
+}
+
+}  // namespace dicomdir
+
+}  // namespace inviwo
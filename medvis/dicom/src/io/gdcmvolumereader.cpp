@@ -29,11 +29,14 @@
 
 #include <inviwo/dicom/io/gdcmvolumereader.h>
 #include <inviwo/dicom/io/mevisvolumereader.h>
+#include <inviwo/dicom/io/dicomscanner.h>
+#include <inviwo/dicom/dicommodule.h>
 #include <inviwo/dicom/utils/gdcmutils.h>
 #include <inviwo/dicom/errorlogging.h>
 
 #include <inviwo/core/util/filesystem.h>
 #include <inviwo/core/util/formatconversion.h>
+#include <inviwo/core/util/moduleutils.h>
 #include <inviwo/core/util/stringconversion.h>
 #include <inviwo/core/datastructures/volume/volume.h>
 
@@ -68,6 +71,28 @@ namespace inviwo {
 // http://gdcm.sourceforge.net/html/gdcminfo.html
 //
 
+namespace {
+
+dicomdir::ScanOptions defaultScanOptions(bool recursive) {
+    dicomdir::ScanOptions options{.recursive = recursive};
+    if (auto* module = util::getModuleByType<DICOMModule>()) {
+        if (module->settings.seriesIndexEnabled) {
+            options.indexDirectory = module->settings.seriesIndexDirectory.get();
+        }
+    }
+    return options;
+}
+
+dicomdir::DecodeOptions defaultDecodeOptions() {
+    dicomdir::DecodeOptions options;
+    if (auto* module = util::getModuleByType<DICOMModule>()) {
+        options.threads = module->settings.decodeThreads.get();
+    }
+    return options;
+}
+
+}  // namespace
+
 GdcmVolumeReader::GdcmVolumeReader()
     : DataReaderType<VolumeSequence>()
     , file_(std::string())
@@ -85,10 +110,9 @@ GdcmVolumeReader* GdcmVolumeReader::clone() const { return new GdcmVolumeReader(
  * Creates inviwo volume handle from DICOM series on disk.
  * Only metadata.
  */
-std::shared_ptr<Volume> GdcmVolumeReader::getVolumeDescription(dicomdir::Series& series,
-                                                               const std::filesystem::path& path) {
-
-    series.updateImageInformation(path);
+std::shared_ptr<Volume> GdcmVolumeReader::getVolumeDescription(
+    dicomdir::Series& series, const std::filesystem::path& path,
+    const dicomdir::SeriesRegion& region) {
     if (series.empty()) {
         throw DataReaderException(
             fmt::format("DICOM series '{}' does not contain any images ({})", series.desc, path),
@@ -110,7 +134,8 @@ std::shared_ptr<Volume> GdcmVolumeReader::getVolumeDescription(dicomdir::Series&
             IVW_CONTEXT_CUSTOM("GdcmVolumeReader::getVolumeDescription"));
     }
 
-    auto volume = std::make_shared<Volume>(series.dims, format);
+    const size3_t dims = region.dims(series);
+    auto volume = std::make_shared<Volume>(dims, format);
 
     // set data range according to used bits, e.g. 12bits for signed and unsigned
     volume->dataMap.dataRange = gdcmutil::getDataRange(series.pixelformat);
@@ -149,15 +174,24 @@ std::shared_ptr<Volume> GdcmVolumeReader::getVolumeDescription(dicomdir::Series&
         }
     }
 
-    dvec3 extent{spacing * dvec3{series.dims}};
+    const dvec3 normal = glm::cross(dicomImg.orientationX, dicomImg.orientationY);
+    // the region starts at its first voxel and keeps every k-th slice
+    const dvec3 origin =
+        dicomImg.origin +
+        dicomImg.orientationX * (spacing.x * static_cast<double>(region.offset.x)) +
+        dicomImg.orientationY * (spacing.y * static_cast<double>(region.offset.y)) +
+        normal * (spacing.z * static_cast<double>(region.offset.z));
+    spacing.z *= static_cast<double>(std::max(region.sliceStride, size_t{1}));
+
+    dvec3 extent{spacing * dvec3{dims}};
 
     mat3 basis{dicomImg.orientationX * extent.x, dicomImg.orientationY * extent.y,
-               glm::cross(dicomImg.orientationX, dicomImg.orientationY) * extent.z};
+               normal * extent.z};
 
     // TODO: do we need to consider the pixel spacing and slice thickness?
 
     volume->setBasis(basis);
-    volume->setOffset(dicomImg.origin);
+    volume->setOffset(origin);
 
     return volume;
 }
@@ -168,89 +202,30 @@ std::shared_ptr<Volume> GdcmVolumeReader::getVolumeDescription(dicomdir::Series&
  */
 std::shared_ptr<VolumeSequence> GdcmVolumeReader::tryReadDICOMsequenceRecursive(
     const std::filesystem::path& directory) {
-    std::shared_ptr<VolumeSequence> outputVolumes = tryReadDICOMsequence(directory);
-
-    const auto childDirectories =
-        filesystem::getDirectoryContents(directory, filesystem::ListMode::Directories);
-    for (const auto& childDir : childDirectories) {
-        std::shared_ptr<VolumeSequence> childVolumes =
-            tryReadDICOMsequenceRecursive(directory / childDir);
-        for (const auto& childVolume : *childVolumes) {
-            outputVolumes->push_back(childVolume);
-        }
-    }
-
-    return outputVolumes;
+    return tryReadDICOMsequence(directory, true);
 }
 
 /**
- * Non-recursive version of tryReadDICOMsequenceRecursive
+ * Tries to read all volumes contained in given directory path, optionally including subdirectories
  */
 std::shared_ptr<VolumeSequence> GdcmVolumeReader::tryReadDICOMsequence(
-    const std::filesystem::path& sequenceDirectory) {
-    const auto files = filesystem::getDirectoryContents(sequenceDirectory);
-    std::shared_ptr<VolumeSequence> outputVolumes = std::make_shared<VolumeSequence>();
-    std::map<std::string, dicomdir::Series> seriesByUID;
-
-    for (const auto& f : files) {
-        // try to load file as DICOM
-        // if yes: read patient ID and sequence ID
-        // group sequences by sequence ID
-        // add sequences to "outputVolumes"
-        std::filesystem::path file = sequenceDirectory / f;
-        if (!std::filesystem::is_regular_file(file)) {
-            throw DataReaderException(fmt::format("file does not exist ({})", file),
-                                      IVW_CONTEXT_CUSTOM("GdcmVolumeReader::tryReadDICOMsequence"));
-        }
-
-        gdcm::ImageReader imageReader;
-        std::ifstream imageInputStream(file, std::ios::binary);
-        if (!imageInputStream.is_open()) {
-            throw DataReaderException(fmt::format("file cannot be opened ({})", file),
-                                      IVW_CONTEXT_CUSTOM("GdcmVolumeReader::tryReadDICOMsequence"));
-        }
-
-        /*if (!imageReader.CanRead()) { // call this on file BrainSample 11.7T\4\pdata\1\2dseq
-        => gdcm crash continue; // skip non-dicom files
-        }*/
-        imageReader.SetStream(imageInputStream);
-        if (imageReader.Read()) {
-            const auto dataset = imageReader.GetFile().GetDataSet();
-            const auto seriesUIDTag = gdcm::Tag(0x0020, 0x000E);
-
-            if (dataset.FindDataElement(seriesUIDTag)) {
-                std::stringstream seriesUID;
-                dataset.GetDataElement(seriesUIDTag).GetValue().Print(seriesUID);
-                std::string suid = seriesUID.str();
-                if (seriesByUID.find(suid) == seriesByUID.end()) {
-                    gdcm::MediaStorage dicomMediaStorage;
-                    dicomMediaStorage.SetFromFile(imageReader.GetFile());
-                    dicomdir::Series newSeries;
-                    newSeries.modality = dicomMediaStorage.GetModality();
-                    seriesByUID[suid] = newSeries;
-                }
-                seriesByUID[suid].images.push_back(dicomdir::Image{file.string()});
-            } else {
-                throw DataReaderException(
-                    fmt::format("could not find DICOM series UID ({})", file),
-                    IVW_CONTEXT_CUSTOM("GdcmVolumeReader::tryReadDICOMsequence"));
-            }
-        } else {
-            continue;  // skip non-dicom files
-        }
-    }
+    const std::filesystem::path& sequenceDirectory, bool recursive) {
+    // reads only the image headers, in parallel, and groups the images into series. Headers of
+    // files which did not change since the last scan are taken from the series index.
+    auto scanned = dicomdir::scan(sequenceDirectory, defaultScanOptions(recursive));
 
-    for (const auto& pair : seriesByUID) {
-        dicomdir::Series series = pair.second;
+    std::shared_ptr<VolumeSequence> outputVolumes = std::make_shared<VolumeSequence>();
+    for (auto& [directory, series] : scanned.series) {
         if (series.images.empty()) {
             continue;
         }
-        std::shared_ptr<Volume> vol = getVolumeDescription(series, sequenceDirectory);
+        std::shared_ptr<Volume> vol = getVolumeDescription(series, directory);
         // on-demand loading via loader class
-        auto diskRepr = std::make_shared<VolumeDisk>(sequenceDirectory, vol->getDimensions(),
-                                                     vol->getDataFormat());
-        auto loader = std::make_unique<GCDMVolumeRAMLoader>(sequenceDirectory, vol->getDimensions(),
+        auto diskRepr =
+            std::make_shared<VolumeDisk>(directory, vol->getDimensions(), vol->getDataFormat());
+        auto loader = std::make_unique<GCDMVolumeRAMLoader>(directory, vol->getDimensions(),
                                                             vol->getDataFormat(), true, series);
+        loader->setDecodeOptions(defaultDecodeOptions());
         diskRepr->setLoader(loader.release());
         vol->addRepresentation(diskRepr);
         outputVolumes->push_back(vol);
@@ -420,12 +395,14 @@ std::shared_ptr<VolumeSequence> GdcmVolumeReader::tryReadDICOMDIR(
 
                 series.modality = dicomMediaStorage.GetModality();
 
+                series.updateImageInformation(dicomdirPath);
                 std::shared_ptr<Volume> vol = getVolumeDescription(series, dicomdirPath);
                 // on-demand loading via loader class
                 auto diskRepr = std::make_shared<VolumeDisk>(dicomdirPath, vol->getDimensions(),
                                                              vol->getDataFormat());
                 auto loader = std::make_unique<GCDMVolumeRAMLoader>(
                     dicomdirPath, vol->getDimensions(), vol->getDataFormat(), true, series);
+                loader->setDecodeOptions(defaultDecodeOptions());
                 diskRepr->setLoader(loader.release());
                 vol->addRepresentation(diskRepr);
                 vol->setMetaData<StringMetaData>("name", series.desc);
@@ -716,6 +693,14 @@ GCDMVolumeRAMLoader::GCDMVolumeRAMLoader(const std::filesystem::path& file, size
     , isPartOfSequence_(isPartOfSequence)
     , series_(series) {}
 
+void GCDMVolumeRAMLoader::setDecodeOptions(dicomdir::DecodeOptions options) {
+    decodeOptions_ = std::move(options);
+}
+
+const dicomdir::DecodeOptions& GCDMVolumeRAMLoader::getDecodeOptions() const {
+    return decodeOptions_;
+}
+
 GCDMVolumeRAMLoader* GCDMVolumeRAMLoader::clone() const { return new GCDMVolumeRAMLoader(*this); }
 
 std::shared_ptr<VolumeRepresentation> GCDMVolumeRAMLoader::createRepresentation(
@@ -749,32 +734,10 @@ std::shared_ptr<VolumeRepresentation> GCDMVolumeRAMLoader::createRepresentation(
  * @param series represents the volume as collection of image file paths
  */
 void GCDMVolumeRAMLoader::getVolumeData(const dicomdir::Series& series, void* outData) const {
-    unsigned long totalByteCount = 0;
-    for (const auto& imgInfo : series.images) {
-        gdcm::ImageReader imageReader;
-
-        std::ifstream imageInputStream(imgInfo.path, std::ios::binary);
-        if (!imageInputStream.is_open()) {
-            throw DataReaderException(fmt::format("file cannot be opened ({})", imgInfo.path),
-                                      IVW_CONTEXT);
-        }
-
-        imageReader.SetStream(imageInputStream);
-        if (!imageReader.CanRead()) {
-            // Image is probably no DICOM file, its best to just skip it
-            continue;
-        }
-
-        if (imageReader.Read()) {
-            gdcm::Image image = imageReader.GetImage();
-            // Get RAW image (gdcm does the decoding for us)
-            if (!image.GetBuffer(reinterpret_cast<char*>(outData) + totalByteCount)) {
-                throw DataReaderException(
-                    fmt::format("could not read image data ({})", imgInfo.path), IVW_CONTEXT);
-            }
-
-            totalByteCount += image.GetBufferLength();
-        }
+    if (!dicomdir::decodeSeries(series, outData, decodeOptions_)) {
+        throw DataReaderException(
+            fmt::format("loading of DICOM series '{}' was canceled ({})", series.desc, file_),
+            IVW_CONTEXT);
     }
 }
 
@@ -0,0 +1,270 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/dicom/processors/dicomseriessource.h>
+#include <inviwo/dicom/dicommodule.h>
+#include <inviwo/dicom/io/gdcmvolumereader.h>
+
+#include <inviwo/core/datastructures/volume/volume.h>
+#include <inviwo/core/datastructures/volume/volumeramprecision.h>
+#include <inviwo/core/util/moduleutils.h>
+#include <inviwo/core/util/stringconversion.h>
+
+#include <fmt/format.h>
+
+#include <algorithm>
+
+namespace inviwo {
+
+namespace {
+
+/**
+ * Load \p region of \p series. If a \p preview of the same region with a slice stride of
+ * \p previewStride is given, the slices contained in it are copied instead of decoded again.
+ */
+std::shared_ptr<Volume> loadRegion(dicomdir::Series& series, const std::filesystem::path& directory,
+                                   const dicomdir::SeriesRegion& region,
+                                   const dicomdir::DecodeOptions& options,
+                                   const Volume* preview = nullptr, size_t previewStride = 1) {
+    auto volume = GdcmVolumeReader::getVolumeDescription(series, directory, region);
+    auto ram = createVolumeRAM(volume->getDimensions(), volume->getDataFormat());
+
+    const auto inPreview = [&](size_t z) { return (z * region.sliceStride) % previewStride == 0; };
+    const bool decoded =
+        preview ? dicomdir::decodeSeries(series, region, ram->getData(), inPreview, options)
+                : dicomdir::decodeSeries(series, region, ram->getData(), options);
+    if (!decoded) return nullptr;
+
+    if (preview) {
+        const auto dims = ram->getDimensions();
+        const size_t sliceBytes = dims.x * dims.y * ram->getDataFormat()->getSizeInBytes();
+        const auto* src =
+            static_cast<const char*>(preview->getRepresentation<VolumeRAM>()->getData());
+        auto* dst = static_cast<char*>(ram->getData());
+        for (size_t z = 0; z < dims.z; ++z) {
+            if (!inPreview(z)) continue;
+            const size_t previewSlice = z * region.sliceStride / previewStride;
+            std::copy_n(src + previewSlice * sliceBytes, sliceBytes, dst + z * sliceBytes);
+        }
+    }
+
+    volume->addRepresentation(ram);
+    volume->setMetaData<StringMetaData>("name", series.desc);
+    return volume;
+}
+
+void updateRange(IntSizeTMinMaxProperty& property, size_t size) {
+    const size_t max = size > 0 ? size - 1 : 0;
+    // keep the current range, e.g. from a deserialized workspace, as long as the size matches
+    if (property.getRangeMax() != max) {
+        property.setRangeMin(0);
+        property.setRangeMax(max);
+        property.set(size2_t{0, max});
+    }
+}
+
+}  // namespace
+
+const ProcessorInfo DICOMSeriesSource::processorInfo_{
+    "org.inviwo.DICOMSeriesSource",  // Class identifier
+    "DICOM Series Source",           // Display name
+    "Data Input",                    // Category
+    CodeState::Experimental,         // Code state
+    Tags::CPU,                       // Tags
+};
+const ProcessorInfo& DICOMSeriesSource::getProcessorInfo() const { return processorInfo_; }
+
+DICOMSeriesSource::DICOMSeriesSource()
+    : PoolProcessor()
+    , outport_{"volume"}
+    , directory_{"directory", "Directory"}
+    , recursive_{"recursive", "Include Subdirectories", true}
+    , rescan_{"rescan", "Rescan"}
+    , series_{"series", "Series"}
+    , region_{"region", "Region of Interest"}
+    , rangeX_{"rangeX", "X", 0, 0, 0, 0, 1, 0}
+    , rangeY_{"rangeY", "Y", 0, 0, 0, 0, 1, 0}
+    , slices_{"slices", "Slices", 0, 0, 0, 0, 1, 0}
+    , sliceStride_{"sliceStride",
+                   "Slice Stride",
+                   "Load only every k-th slice of the region"_help,
+                   1,
+                   {1, ConstraintBehavior::Immutable},
+                   {16, ConstraintBehavior::Ignore}}
+    , progressive_{"progressive", "Progressive Loading",
+                   "Publish a preview with fewer slices first and replace it with the full "
+                   "region once it is decoded"_help,
+                   true}
+    , previewStride_{"previewStride",
+                     "Preview Stride",
+                     "Slice stride of the preview"_help,
+                     8,
+                     {2, ConstraintBehavior::Immutable},
+                     {64, ConstraintBehavior::Ignore}} {
+
+    addPort(outport_);
+
+    region_.addProperties(rangeX_, rangeY_, slices_, sliceStride_);
+    addProperties(directory_, recursive_, rescan_, series_, region_, progressive_, previewStride_);
+
+    previewStride_.visibilityDependsOn(progressive_, [](const auto& p) { return p.get(); });
+}
+
+void DICOMSeriesSource::process() {
+    if (directory_.isModified() || recursive_.isModified() || rescan_.isModified()) {
+        scan();
+    } else if (loadPending_ || series_.isModified() || rangeX_.isModified() ||
+               rangeY_.isModified() || slices_.isModified() || sliceStride_.isModified() ||
+               progressive_.isModified() || previewStride_.isModified()) {
+        if (series_.isModified()) updateSeries();
+        load();
+    }
+}
+
+void DICOMSeriesSource::scan() {
+    loadPending_ = false;
+    outport_.clear();
+
+    const auto& directory = directory_.get();
+    dicomdir::ScanOptions options{.recursive = recursive_.get()};
+    if (auto* module = util::getModuleByType<DICOMModule>()) {
+        options.threads = module->settings.decodeThreads.get();
+        if (module->settings.seriesIndexEnabled) {
+            options.indexDirectory = module->settings.seriesIndexDirectory.get();
+        }
+    }
+
+    const auto calc = [directory, options](pool::Stop stop,
+                                           pool::Progress progress) -> dicomdir::ScanResult {
+        if (directory.empty() || !std::filesystem::is_directory(directory)) return {};
+        auto scanOptions = options;
+        scanOptions.stop = [stop]() { return static_cast<bool>(stop); };
+        scanOptions.progress = [progress](float f) { progress(f); };
+        return dicomdir::scan(directory, scanOptions);
+    };
+
+    dispatchOne(calc, [this](dicomdir::ScanResult result) {
+        if (result.stopped) return;
+        scanned_ = std::move(result);
+
+        std::vector<OptionPropertyIntOption> options;
+        for (size_t i = 0; i < scanned_.series.size(); ++i) {
+            const auto& [seriesDirectory, series] = scanned_.series[i];
+            const auto desc =
+                series.desc.empty() ? seriesDirectory.filename().string() : series.desc;
+            options.emplace_back(fmt::format("series{}", i),
+                                 fmt::format("{} {} ({})", series.modality, desc,
+                                             toString(series.dims)),
+                                 static_cast<int>(i));
+        }
+        series_.replaceOptions(options);
+        updateSeries();
+
+        // load the selected series in the next process
+        loadPending_ = true;
+        invalidate(InvalidationLevel::InvalidOutput);
+    });
+}
+
+void DICOMSeriesSource::updateSeries() {
+    if (series_.size() == 0 || scanned_.series.empty()) return;
+
+    const auto& dims = scanned_.series[static_cast<size_t>(series_.get())].series.dims;
+    updateRange(rangeX_, dims.x);
+    updateRange(rangeY_, dims.y);
+    updateRange(slices_, dims.z);
+}
+
+void DICOMSeriesSource::load() {
+    loadPending_ = false;
+
+    if (series_.size() == 0 || scanned_.series.empty()) {
+        outport_.clear();
+        return;
+    }
+
+    const auto& item = scanned_.series[static_cast<size_t>(series_.get())];
+    const size2_t x = rangeX_.get();
+    const size2_t y = rangeY_.get();
+    const size2_t z = slices_.get();
+    const dicomdir::SeriesRegion region{
+        .offset = size3_t{x[0], y[0], z[0]},
+        .extent = size3_t{x[1] - x[0] + 1, y[1] - y[0] + 1, z[1] - z[0] + 1},
+        .sliceStride = sliceStride_.get()};
+
+    dicomdir::DecodeOptions options;
+    if (auto* module = util::getModuleByType<DICOMModule>()) {
+        options.threads = module->settings.decodeThreads.get();
+    }
+
+    // the jobs of the preview and the full region run one after the other
+    const auto decode = [series = std::make_shared<dicomdir::Series>(item.series),
+                         directory = item.directory,
+                         options](const dicomdir::SeriesRegion& region, pool::Stop stop,
+                                  pool::Progress progress, const Volume* preview,
+                                  size_t previewStride) {
+        auto decodeOptions = options;
+        decodeOptions.stop = [stop]() { return static_cast<bool>(stop); };
+        decodeOptions.progress = [progress](float f) { progress(f); };
+        return loadRegion(*series, directory, region, decodeOptions, preview, previewStride);
+    };
+
+    const auto loadFull = [this, decode, region](std::shared_ptr<const Volume> preview,
+                                                 size_t previewStride) {
+        dispatchOne(
+            [decode, region, preview, previewStride](pool::Stop stop, pool::Progress progress) {
+                return decode(region, stop, progress, preview.get(), previewStride);
+            },
+            [this](std::shared_ptr<Volume> volume) {
+                if (!volume) return;  // canceled
+                outport_.setData(volume);
+                newResults();
+            });
+    };
+
+    if (progressive_.get() && previewStride_.get() > sliceStride_.get()) {
+        auto preview = region;
+        preview.sliceStride = previewStride_.get();
+        dispatchOne(
+            [decode, preview](pool::Stop stop, pool::Progress progress) {
+                return decode(preview, stop, progress, nullptr, 1);
+            },
+            [this, loadFull, stride = preview.sliceStride](std::shared_ptr<Volume> volume) {
+                if (!volume) return;  // canceled
+                outport_.setData(volume);
+                newResults();
+                // decode only the slices missing in the preview
+                loadFull(volume, stride);
+            });
+    } else {
+        loadFull(nullptr, 1);
+    }
+}
+
+}  // namespace inviwo
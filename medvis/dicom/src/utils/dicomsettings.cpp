@@ -0,0 +1,58 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/dicom/utils/dicomsettings.h>
+
+#include <inviwo/core/util/filesystem.h>
+
+namespace inviwo {
+
+DICOMSettings::DICOMSettings()
+    : Settings("DICOM Settings")
+    , decodeThreads{"decodeThreads",
+                    "Decoder Threads",
+                    "Number of images of a DICOM series which are read and decoded in parallel, "
+                    "0 uses the default of the thread pool"_help,
+                    0,
+                    {0, ConstraintBehavior::Immutable},
+                    {64, ConstraintBehavior::Ignore}}
+    , seriesIndex{"seriesIndex", "Series Index",
+                  "The image headers of scanned DICOM directories are stored in an index, such "
+                  "that reopening a study only reads new or modified files"_help}
+    , seriesIndexEnabled{"seriesIndexEnabled", "Enabled", true}
+    , seriesIndexDirectory{"seriesIndexDirectory", "Directory",
+                           filesystem::getInviwoUserSettingsPath() / "dicomindex"}
+    , clearSeriesIndex{"clearSeriesIndex", "Clear"} {
+
+    seriesIndex.addProperties(seriesIndexEnabled, seriesIndexDirectory, clearSeriesIndex);
+    addProperties(decodeThreads, seriesIndex);
+    load();
+}
+
+}  // namespace inviwo
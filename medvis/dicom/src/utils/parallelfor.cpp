@@ -0,0 +1,92 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/dicom/utils/parallelfor.h>
+
+#include <inviwo/core/util/foreach.h>
+#include <inviwo/core/util/zip.h>
+
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <future>
+#include <vector>
+
+namespace inviwo {
+
+namespace gdcmutil {
+
+bool parallelFor(size_t count, size_t threads, const std::function<void(size_t)>& func,
+                 const std::function<void(float)>& progress, const std::function<bool()>& stop) {
+    if (count == 0) return true;
+
+    std::atomic<size_t> done{0};
+    std::atomic<bool> abort{false};
+    std::atomic<bool> canceled{false};
+
+    const auto reportProgress = [&]() {
+        if (progress) progress(static_cast<float>(done.load()) / static_cast<float>(count));
+    };
+
+    const auto seq = util::make_sequence(size_t{0}, count, size_t{1});
+    auto futures = util::forEachParallelAsync(
+        seq,
+        [&](size_t i) {
+            if (abort) return;
+            if (stop && stop()) {
+                canceled = true;
+                abort = true;
+                return;
+            }
+            try {
+                func(i);
+            } catch (...) {
+                abort = true;
+                throw;
+            }
+            ++done;
+        },
+        threads);
+
+    // Wait for all jobs before rethrowing, they refer to the state above
+    for (auto& future : futures) {
+        while (future.wait_for(std::chrono::milliseconds{100}) != std::future_status::ready) {
+            reportProgress();
+        }
+    }
+    for (auto& future : futures) future.get();
+    if (canceled) return false;
+
+    reportProgress();
+    return true;
+}
+
+}  // namespace gdcmutil
+
+}  // namespace inviwo
@@ -0,0 +1,180 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <inviwo/dicom/io/dicomindex.h>
+
+#include <fmt/format.h>
+
+#include <filesystem>
+#include <fstream>
+#include <random>
+
+namespace inviwo {
+
+namespace {
+
+class DICOMSeriesIndex : public ::testing::Test {
+protected:
+    void SetUp() override {
+        root_ = std::filesystem::temp_directory_path() /
+                fmt::format("inviwo-dicom-index-{}", std::random_device{}());
+        directory_ = root_ / "study";
+        indexDirectory_ = root_ / "index";
+        std::filesystem::create_directories(directory_);
+        for (auto name : {"a.dcm", "b.dcm", "readme.txt"}) {
+            std::ofstream{directory_ / name} << name;
+        }
+    }
+    void TearDown() override {
+        std::error_code ec;
+        std::filesystem::remove_all(root_, ec);
+    }
+
+    dicomdir::ImageHeader header(const std::string& name) const {
+        dicomdir::ImageHeader h;
+        h.image.path = (directory_ / name).string();
+        h.image.dims = size3_t{512, 256, 1};
+        h.image.origin = dvec3{-120.5, 33.25, 17.0 / 3.0};
+        h.image.pixelSpacing = dvec3{0.625, 0.625, 0.0};
+        h.image.windowCenter = "40";
+        h.image.windowWidth = "400";
+        h.image.updateZpos();
+        h.seriesUID = "1.2.826.0.1.3680043.2.1125.1";
+        h.instanceUID = "1.2.826.0.1.3680043.2.1125.1." + name;
+        h.seriesDesc = "head\twith tab";
+        h.modality = "CT";
+        h.pixelformat = gdcm::PixelFormat(1, 16, 12, 11, 1);
+        h.photometric = gdcm::PhotometricInterpretation::MONOCHROME2;
+        h.intercept = -1024.0;
+        h.slope = 1.0;
+        return h;
+    }
+
+    std::filesystem::path root_;
+    std::filesystem::path directory_;
+    std::filesystem::path indexDirectory_;
+};
+
+}  // namespace
+
+TEST_F(DICOMSeriesIndex, RoundTrip) {
+    const auto stampA = dicomdir::DirectoryIndex::Stamp::get(directory_ / "a.dcm");
+    const auto stampTxt = dicomdir::DirectoryIndex::Stamp::get(directory_ / "readme.txt");
+    ASSERT_TRUE(stampA && stampTxt);
+    {
+        dicomdir::DirectoryIndex index{indexDirectory_, directory_};
+        EXPECT_EQ(index.size(), 0u);
+        index.insert("a.dcm", {*stampA, header("a.dcm")});
+        index.insert("readme.txt", {*stampTxt, std::nullopt});
+        ASSERT_TRUE(index.save());
+        EXPECT_FALSE(index.isModified());
+    }
+
+    const dicomdir::DirectoryIndex index{indexDirectory_, directory_};
+    EXPECT_EQ(index.size(), 2u);
+
+    const auto* a = index.find("a.dcm", *stampA);
+    ASSERT_NE(a, nullptr);
+    ASSERT_TRUE(a->header);
+    const auto expected = header("a.dcm");
+    EXPECT_EQ(a->header->image.path, expected.image.path);
+    EXPECT_EQ(a->header->image.dims, expected.image.dims);
+    EXPECT_EQ(a->header->image.origin, expected.image.origin);
+    EXPECT_EQ(a->header->image.pixelSpacing, expected.image.pixelSpacing);
+    EXPECT_EQ(a->header->image.zPos, expected.image.zPos);
+    EXPECT_EQ(a->header->image.windowCenter, expected.image.windowCenter);
+    EXPECT_EQ(a->header->seriesUID, expected.seriesUID);
+    EXPECT_EQ(a->header->instanceUID, expected.instanceUID);
+    EXPECT_EQ(a->header->seriesDesc, "head with tab");
+    EXPECT_EQ(a->header->pixelformat, expected.pixelformat);
+    EXPECT_TRUE(a->header->photometric.IsSameColorSpace(expected.photometric));
+    EXPECT_EQ(a->header->intercept, expected.intercept);
+
+    const auto* txt = index.find("readme.txt", *stampTxt);
+    ASSERT_NE(txt, nullptr);
+    EXPECT_FALSE(txt->header);
+
+    EXPECT_EQ(index.find("b.dcm", *stampA), nullptr);
+}
+
+TEST_F(DICOMSeriesIndex, StaleStamp) {
+    const auto stamp = dicomdir::DirectoryIndex::Stamp::get(directory_ / "a.dcm");
+    ASSERT_TRUE(stamp);
+    {
+        dicomdir::DirectoryIndex index{indexDirectory_, directory_};
+        index.insert("a.dcm", {*stamp, header("a.dcm")});
+        ASSERT_TRUE(index.save());
+    }
+
+    auto modified = *stamp;
+    modified.size += 1;
+    const dicomdir::DirectoryIndex index{indexDirectory_, directory_};
+    EXPECT_NE(index.find("a.dcm", *stamp), nullptr);
+    EXPECT_EQ(index.find("a.dcm", modified), nullptr);
+}
+
+TEST_F(DICOMSeriesIndex, Retain) {
+    const auto stamp = dicomdir::DirectoryIndex::Stamp::get(directory_ / "a.dcm");
+    ASSERT_TRUE(stamp);
+
+    dicomdir::DirectoryIndex index{indexDirectory_, directory_};
+    index.insert("a.dcm", {*stamp, header("a.dcm")});
+    index.insert("b.dcm", {*stamp, header("b.dcm")});
+    ASSERT_TRUE(index.save());
+
+    index.retain({"b.dcm", "readme.txt"});
+    EXPECT_TRUE(index.isModified());
+    EXPECT_EQ(index.size(), 1u);
+    EXPECT_EQ(index.find("a.dcm", *stamp), nullptr);
+    EXPECT_NE(index.find("b.dcm", *stamp), nullptr);
+}
+
+TEST_F(DICOMSeriesIndex, Clear) {
+    const auto stamp = dicomdir::DirectoryIndex::Stamp::get(directory_ / "a.dcm");
+    ASSERT_TRUE(stamp);
+    {
+        dicomdir::DirectoryIndex index{indexDirectory_, directory_};
+        index.insert("a.dcm", {*stamp, header("a.dcm")});
+        ASSERT_TRUE(index.save());
+    }
+    EXPECT_TRUE(std::filesystem::exists(
+        dicomdir::DirectoryIndex::indexFile(indexDirectory_, directory_)));
+
+    dicomdir::DirectoryIndex::clear(indexDirectory_);
+    EXPECT_FALSE(std::filesystem::exists(
+        dicomdir::DirectoryIndex::indexFile(indexDirectory_, directory_)));
+    EXPECT_EQ((dicomdir::DirectoryIndex{indexDirectory_, directory_}.size()), 0u);
+}
+
+}  // namespace inviwo
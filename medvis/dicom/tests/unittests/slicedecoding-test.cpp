@@ -0,0 +1,290 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <inviwo/dicom/io/dicomdecoder.h>
+#include <inviwo/dicom/io/dicomindex.h>
+#include <inviwo/dicom/io/dicomscanner.h>
+
+#include <fmt/format.h>
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gdcmAttribute.h>
+#include <gdcmImage.h>
+#include <gdcmImageChangeTransferSyntax.h>
+#include <gdcmImageWriter.h>
+#include <gdcmMediaStorage.h>
+#include <gdcmUIDGenerator.h>
+#include <warn/pop>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace inviwo {
+
+namespace {
+
+const size2_t sliceDims{256, 256};
+constexpr size_t numSlices = 48;
+
+uint16_t syntheticValue(size_t x, size_t y, size_t z) {
+    return static_cast<uint16_t>((x * 7 + y * 13 + z * 31 + (x * y) / 64) % 4096);
+}
+
+void insertTag(gdcm::DataSet& dataset, const gdcm::Tag& tag, const gdcm::VR& vr,
+               std::string value) {
+    if (value.size() % 2 != 0) {
+        value.push_back(vr == gdcm::VR::UI ? '\0' : ' ');
+    }
+    gdcm::DataElement element(tag);
+    element.SetVR(vr);
+    element.SetByteValue(value.data(), static_cast<uint32_t>(value.size()));
+    dataset.Replace(element);
+}
+
+// writes a JPEG lossless compressed CT slice located at z
+void writeSlice(const std::filesystem::path& path, size_t z, const std::string& seriesUID) {
+    std::vector<uint16_t> pixels(sliceDims.x * sliceDims.y);
+    for (size_t y = 0; y < sliceDims.y; ++y) {
+        for (size_t x = 0; x < sliceDims.x; ++x) {
+            pixels[y * sliceDims.x + x] = syntheticValue(x, y, z);
+        }
+    }
+
+    gdcm::Image image;
+    image.SetNumberOfDimensions(2);
+    image.SetDimension(0, static_cast<unsigned int>(sliceDims.x));
+    image.SetDimension(1, static_cast<unsigned int>(sliceDims.y));
+    image.SetPixelFormat(gdcm::PixelFormat::UINT16);
+    image.SetPhotometricInterpretation(gdcm::PhotometricInterpretation::MONOCHROME2);
+    image.SetTransferSyntax(gdcm::TransferSyntax::ExplicitVRLittleEndian);
+    const double origin[3] = {0.0, 0.0, static_cast<double>(z)};
+    image.SetOrigin(origin);
+    const double spacing[3] = {0.5, 0.5, 1.0};
+    image.SetSpacing(spacing);
+
+    gdcm::DataElement pixelData(gdcm::Tag(0x7fe0, 0x0010));
+    pixelData.SetByteValue(reinterpret_cast<const char*>(pixels.data()),
+                           static_cast<uint32_t>(pixels.size() * sizeof(uint16_t)));
+    image.SetDataElement(pixelData);
+
+    gdcm::ImageChangeTransferSyntax change;
+    change.SetTransferSyntax(gdcm::TransferSyntax::JPEGLosslessProcess14_1);
+    change.SetInput(image);
+    ASSERT_TRUE(change.Change());
+
+    gdcm::ImageWriter writer;
+    writer.SetImage(change.GetOutput());
+    auto& dataset = writer.GetFile().GetDataSet();
+    insertTag(dataset, gdcm::Tag(0x0008, 0x0016), gdcm::VR::UI,
+              gdcm::MediaStorage::GetMSString(gdcm::MediaStorage::CTImageStorage));
+    insertTag(dataset, gdcm::Tag(0x0008, 0x0060), gdcm::VR::CS, "CT");
+    insertTag(dataset, gdcm::Tag(0x0008, 0x103E), gdcm::VR::LO, "synthetic");
+    insertTag(dataset, gdcm::Tag(0x0020, 0x000E), gdcm::VR::UI, seriesUID);
+    writer.SetFileName(path.string().c_str());
+    ASSERT_TRUE(writer.Write());
+}
+
+class DICOMSliceDecoding : public ::testing::Test {
+protected:
+    static void SetUpTestSuite() {
+        directory_ = std::filesystem::temp_directory_path() /
+                     fmt::format("inviwo-dicom-decoding-{}", std::random_device{}());
+        std::filesystem::create_directories(directory_);
+
+        gdcm::UIDGenerator uid;
+        const std::string seriesUID = uid.Generate();
+        for (size_t z = 0; z < numSlices; ++z) {
+            writeSlice(directory_ / fmt::format("slice{:03}.dcm", z), z, seriesUID);
+        }
+    }
+    static void TearDownTestSuite() {
+        std::error_code ec;
+        std::filesystem::remove_all(directory_, ec);
+    }
+
+    static dicomdir::Series scanSeries() {
+        auto result = dicomdir::scan(directory_, {.recursive = false});
+        EXPECT_EQ(result.files, numSlices);
+        EXPECT_EQ(result.images, numSlices);
+        if (result.series.size() != 1) {
+            ADD_FAILURE() << "expected a single DICOM series, found " << result.series.size();
+            return {};
+        }
+        return result.series.front().series;
+    }
+
+    static std::filesystem::path directory_;
+};
+
+std::filesystem::path DICOMSliceDecoding::directory_;
+
+}  // namespace
+
+TEST_F(DICOMSliceDecoding, ScanFindsSeries) {
+    const auto series = scanSeries();
+    EXPECT_EQ(series.dims, size3_t(sliceDims, numSlices));
+    EXPECT_EQ(series.modality, "CT");
+    EXPECT_EQ(series.desc, "synthetic");
+    ASSERT_EQ(series.images.size(), numSlices);
+    // images are sorted by decreasing slice position
+    EXPECT_GT(series.images.front().zPos, series.images.back().zPos);
+}
+
+TEST_F(DICOMSliceDecoding, ScanWithIndex) {
+    const auto indexDirectory = directory_ / "index";
+    dicomdir::ScanOptions options{.recursive = false, .indexDirectory = indexDirectory};
+
+    const auto first = dicomdir::scan(directory_, options);
+    EXPECT_EQ(first.indexed, 0u);
+    EXPECT_EQ(first.images, numSlices);
+
+    const auto second = dicomdir::scan(directory_, options);
+    EXPECT_EQ(second.indexed, numSlices);
+    EXPECT_EQ(second.images, numSlices);
+    ASSERT_EQ(second.series.size(), 1u);
+    ASSERT_EQ(first.series.size(), 1u);
+    EXPECT_EQ(second.series.front().series.dims, first.series.front().series.dims);
+    EXPECT_EQ(second.series.front().series.images.front().path,
+              first.series.front().series.images.front().path);
+
+    dicomdir::DirectoryIndex::clear(indexDirectory);
+    std::filesystem::remove(indexDirectory);
+}
+
+TEST_F(DICOMSliceDecoding, ParallelMatchesSerial) {
+    const auto series = scanSeries();
+    ASSERT_EQ(series.images.size(), numSlices);
+
+    std::vector<uint16_t> serial(glm::compMul(series.dims));
+    std::vector<uint16_t> parallel(glm::compMul(series.dims));
+    ASSERT_TRUE(dicomdir::decodeSeries(series, serial.data(), {.threads = 1}));
+    ASSERT_TRUE(dicomdir::decodeSeries(series, parallel.data(), {.threads = 0}));
+
+    EXPECT_EQ(serial, parallel);
+
+    // the first slice in the volume is the one with the largest z
+    const size_t z = numSlices - 1;
+    EXPECT_EQ(parallel[0], syntheticValue(0, 0, z));
+    EXPECT_EQ(parallel[5 * sliceDims.x + 3], syntheticValue(3, 5, z));
+}
+
+TEST_F(DICOMSliceDecoding, DISABLED_Benchmark) {
+    const auto series = scanSeries();
+    ASSERT_EQ(series.images.size(), numSlices);
+
+    std::vector<uint16_t> data(glm::compMul(series.dims));
+    using clock = std::chrono::steady_clock;
+    using ms = std::chrono::duration<double, std::milli>;
+    for (const size_t threads : {size_t{1}, size_t{0}}) {
+        const auto start = clock::now();
+        ASSERT_TRUE(dicomdir::decodeSeries(series, data.data(), {.threads = threads}));
+        fmt::print("[ BENCH    ] {} JPEG lossless slices of {}x{}, {} threads: {:.1f} ms\n",
+                   numSlices, sliceDims.x, sliceDims.y,
+                   threads > 0 ? threads : size_t{std::thread::hardware_concurrency()},
+                   ms(clock::now() - start).count());
+    }
+}
+
+TEST_F(DICOMSliceDecoding, Region) {
+    const auto series = scanSeries();
+    ASSERT_EQ(series.images.size(), numSlices);
+
+    std::vector<uint16_t> full(glm::compMul(series.dims));
+    ASSERT_TRUE(dicomdir::decodeSeries(series, full.data()));
+
+    const dicomdir::SeriesRegion region{
+        .offset = size3_t{10, 20, 5}, .extent = size3_t{32, 16, 20}, .sliceStride = 3};
+    const auto dims = region.dims(series);
+    EXPECT_EQ(dims, size3_t(32, 16, 7));
+    EXPECT_FALSE(region.isComplete(series));
+
+    std::vector<uint16_t> data(glm::compMul(dims));
+    ASSERT_TRUE(dicomdir::decodeSeries(series, region, data.data(), {.threads = 2}));
+
+    for (size_t z = 0; z < dims.z; ++z) {
+        for (size_t y = 0; y < dims.y; ++y) {
+            for (size_t x = 0; x < dims.x; ++x) {
+                const size3_t src = region.offset + size3_t{x, y, z * region.sliceStride};
+                ASSERT_EQ(data[(z * dims.y + y) * dims.x + x],
+                          full[(src.z * series.dims.y + src.y) * series.dims.x + src.x]);
+            }
+        }
+    }
+
+    // regions are clamped to the series
+    const dicomdir::SeriesRegion clamped{.offset = size3_t{250, 0, 40},
+                                         .extent = size3_t{100, 0, 0}};
+    EXPECT_EQ(clamped.dims(series), size3_t(6, sliceDims.y, 8));
+}
+
+TEST_F(DICOMSliceDecoding, SkipSlices) {
+    const auto series = scanSeries();
+    ASSERT_EQ(series.images.size(), numSlices);
+
+    std::vector<uint16_t> full(glm::compMul(series.dims));
+    ASSERT_TRUE(dicomdir::decodeSeries(series, full.data()));
+
+    const dicomdir::SeriesRegion region{};
+    constexpr uint16_t untouched = 0xffff;
+    std::vector<uint16_t> data(full.size(), untouched);
+    const auto skip = [](size_t z) { return z % 4 == 0; };
+    ASSERT_TRUE(dicomdir::decodeSeries(series, region, data.data(), skip, {.threads = 2}));
+
+    const size_t sliceSize = series.dims.x * series.dims.y;
+    for (size_t z = 0; z < series.dims.z; ++z) {
+        const auto begin = z * sliceSize;
+        for (size_t i = begin; i < begin + sliceSize; ++i) {
+            ASSERT_EQ(data[i], skip(z) ? untouched : full[i]) << "slice " << z;
+        }
+    }
+}
+
+TEST_F(DICOMSliceDecoding, Cancel) {
+    const auto series = scanSeries();
+    ASSERT_EQ(series.images.size(), numSlices);
+
+    std::vector<uint16_t> data(glm::compMul(series.dims));
+    std::atomic<size_t> calls{0};
+    const auto stop = [&]() { return ++calls > 4; };
+    EXPECT_FALSE(dicomdir::decodeSeries(series, data.data(), {.threads = 2, .stop = stop}));
+}
+
+}  // namespace inviwo
@@ -33,9 +33,14 @@
 #include <inviwo/core/common/inviwo.h>
 #include <inviwo/core/processors/processor.h>
 #include <inviwo/core/processors/processortraits.h>
+#include <inviwo/core/processors/processorobserver.h>
 #include <inviwo/core/properties/boolproperty.h>
 #include <inviwo/core/properties/boolcompositeproperty.h>
+#include <inviwo/core/properties/buttonproperty.h>
 #include <inviwo/core/properties/buttongroupproperty.h>
+#include <inviwo/core/properties/fileproperty.h>
+#include <inviwo/core/properties/ordinalproperty.h>
+#include <inviwo/core/properties/stringproperty.h>
 #include <inviwo/core/ports/imageport.h>
 #include <inviwo/core/ports/volumeport.h>
 #include <inviwo/core/ports/meshport.h>
@@ -48,15 +53,25 @@
 #include <inviwo/core/interaction/events/resizeevent.h>
 #include <inviwo/core/interaction/events/pickingevent.h>
 #include <inviwo/core/util/zip.h>
+#include <inviwo/core/util/exception.h>
+#include <inviwo/devtools/util/eventlatencytracer.h>
 
 #include <fmt/format.h>
+#include <fmt/std.h>
 
+#include <algorithm>
+#include <fstream>
 #include <functional>
+#include <unordered_map>
 
 namespace inviwo {
 
+/**
+ * Logs the events passing through, and optionally traces the latency from an event until the
+ * processors connected to the outport have processed the next time, see EventLatencyTracer.
+ */
 template <typename Inport, typename Outport>
-class EventLogger : public Processor {
+class EventLogger : public Processor, public ProcessorObserver {
 public:
     EventLogger();
     virtual ~EventLogger() = default;
@@ -65,7 +80,15 @@ public:
     virtual const ProcessorInfo& getProcessorInfo() const override;
     virtual void invokeEvent(Event* event) override;
 
+    virtual void onProcessorAboutToProcess(Processor* processor) override;
+    virtual void onProcessorFinishedProcess(Processor* processor) override;
+
 private:
+    void observeDownstream();
+    void frameFinished();
+    void updateReport(bool force);
+    void exportTrace() const;
+
     Inport inport_;
     Outport outport_;
     BoolCompositeProperty enable_;
@@ -81,6 +104,17 @@ private:
     const std::unordered_map<uint64_t, std::reference_wrapper<BoolProperty>> eventMap_;
 
     BoolProperty enableOtherEvents_;
+
+    BoolCompositeProperty tracing_;
+    DoubleProperty timeout_;
+    StringProperty report_;
+    FileProperty traceFile_;
+    ButtonProperty exportTrace_;
+    ButtonProperty resetTrace_;
+
+    EventLatencyTracer tracer_;
+    std::unordered_map<Processor*, EventLatencyTracer::Clock::time_point> processStart_;
+    EventLatencyTracer::Clock::time_point lastReport_{};
 };
 
 template <typename Inport, typename Outport>
@@ -118,7 +152,21 @@ EventLogger<Inport, Outport>::EventLogger()
         }
         return map;
     }())
-    , enableOtherEvents_("enableOtherEvents", "Enable Other Events", true) {
+    , enableOtherEvents_("enableOtherEvents", "Enable Other Events", true)
+    , tracing_("tracing", "Latency Tracing",
+               "Measure the time from each selected event until the processors connected to the "
+               "outport have finished processing the next time."_help,
+               false)
+    , timeout_("timeout", "Timeout (ms)",
+               "Events that have not led to a new frame within this time are discarded"_help,
+               5000.0, {1.0, ConstraintBehavior::Immutable}, {60000.0, ConstraintBehavior::Ignore})
+    , report_("report", "Report", "Latency percentiles for each event type"_help, "",
+              InvalidationLevel::Valid, PropertySemantics::Multiline)
+    , traceFile_("traceFile", "Trace File",
+                 "Chrome trace-event JSON, open it in chrome://tracing or Perfetto"_help, "")
+    , exportTrace_("exportTrace", "Export Trace")
+    , resetTrace_("resetTrace", "Reset")
+    , tracer_{} {
 
     addPort(inport_);
     addPort(outport_);
@@ -129,21 +177,109 @@ EventLogger<Inport, Outport>::EventLogger()
         enable_.addProperty(p);
     }
     enable_.addProperty(enableOtherEvents_);
+
+    addProperty(tracing_);
+    tracing_.addProperties(timeout_, report_, traceFile_, exportTrace_, resetTrace_);
+    report_.setReadOnly(true);
+    traceFile_.setFileMode(FileMode::AnyFile);
+    traceFile_.setAcceptMode(AcceptMode::Save);
+    traceFile_.clearNameFilters();
+    traceFile_.addNameFilter("Chrome trace (*.json)");
+
+    timeout_.onChange([this]() {
+        tracer_.setTimeout(EventLatencyTracer::Duration{timeout_.get()});
+    });
+    exportTrace_.onChange([this]() { exportTrace(); });
+    resetTrace_.onChange([this]() {
+        tracer_.clear();
+        updateReport(true);
+    });
+    tracing_.getBoolProperty()->onChange([this]() {
+        if (tracing_) observeDownstream();
+    });
 }
 
 template <typename Inport, typename Outport>
 void EventLogger<Inport, Outport>::process() {
+    const auto start = EventLatencyTracer::Clock::now();
     outport_.setData(inport_.getData());
+
+    if (!tracing_) return;
+    tracer_.processorFinished(getDisplayName(), start);
+    observeDownstream();
+    if (outport_.getConnectedInports().empty()) frameFinished();
+}
+
+template <typename Inport, typename Outport>
+void EventLogger<Inport, Outport>::onProcessorAboutToProcess(Processor* processor) {
+    if (!tracing_) return;
+    processStart_[processor] = EventLatencyTracer::Clock::now();
+}
+
+template <typename Inport, typename Outport>
+void EventLogger<Inport, Outport>::onProcessorFinishedProcess(Processor* processor) {
+    if (!tracing_) return;
+    const auto it = processStart_.find(processor);
+    if (it != processStart_.end()) {
+        tracer_.processorFinished(processor->getDisplayName(), it->second);
+        processStart_.erase(it);
+    }
+    frameFinished();
+}
+
+template <typename Inport, typename Outport>
+void EventLogger<Inport, Outport>::observeDownstream() {
+    // Connections may have changed, observe exactly the processors connected to the outport
+    ProcessorObserver::removeObservations();
+    processStart_.clear();
+    for (auto* inport : outport_.getConnectedInports()) {
+        if (auto* processor = inport->getProcessor()) processor->addObserver(this);
+    }
+}
+
+template <typename Inport, typename Outport>
+void EventLogger<Inport, Outport>::frameFinished() {
+    if (tracer_.pending() == 0) return;
+    tracer_.frameFinished();
+    updateReport(false);
+}
+
+template <typename Inport, typename Outport>
+void EventLogger<Inport, Outport>::updateReport(bool force) {
+    // Computing the percentiles sorts all samples, limit how often that is done
+    const auto now = EventLatencyTracer::Clock::now();
+    if (!force && now - lastReport_ < std::chrono::milliseconds{500}) return;
+    lastReport_ = now;
+    report_.set(tracer_.report());
+}
+
+template <typename Inport, typename Outport>
+void EventLogger<Inport, Outport>::exportTrace() const {
+    if (traceFile_.get().empty()) {
+        throw Exception(SourceContext{}, "No trace file selected");
+    }
+    std::ofstream file{traceFile_.get()};
+    if (!file) {
+        throw Exception(SourceContext{}, "Could not open {} for writing", traceFile_.get());
+    }
+    tracer_.writeChromeTrace(file);
+    log::info("Wrote latency trace to {}\n{}", traceFile_.get(), tracer_.report());
 }
 
 template <typename Inport, typename Outport>
 void EventLogger<Inport, Outport>::invokeEvent(Event* event) {
-    if (!enable_) return;
+    if (!enable_ && !tracing_) return;
 
     const auto it = eventMap_.find(event->hash());
     if ((it == eventMap_.end() && enableOtherEvents_.get()) ||
         (it != eventMap_.end() && it->second.get())) {
-        log::info("{:25} {}", getDisplayName(), *event);
+        if (enable_) log::info("{:25} {}", getDisplayName(), *event);
+        if (tracing_) {
+            const auto type = std::find(eventHash_.begin(), eventHash_.end(), event->hash());
+            tracer_.eventReceived(type != eventHash_.end()
+                                      ? events_[std::distance(eventHash_.begin(), type)]
+                                      : "Other");
+        }
     }
 }
 
@@ -33,18 +33,27 @@
 #include <inviwo/core/common/inviwo.h>
 #include <inviwo/core/processors/processor.h>
 #include <inviwo/core/properties/boolproperty.h>
+#include <inviwo/core/properties/ordinalproperty.h>
 #include <inviwo/core/properties/stringproperty.h>
 #include <inviwo/core/ports/imageport.h>
+#include <inviwo/devtools/util/logringbuffer.h>
 #include <modules/fontrendering/properties/fontproperty.h>
 #include <modules/fontrendering/textrenderer.h>
 
+#include <atomic>
+#include <deque>
+
 namespace inviwo {
 
 class IVW_MODULE_DEVTOOLS_API LogRendererProcessors : public Processor {
+    /**
+     * Receives log messages on any thread. Messages are only copied into a ring buffer, and at
+     * most one invalidation of the processor is queued until the processor has consumed them.
+     */
     class LoggerHandler : public Logger {
     public:
         // Inherited via Logger
-        LoggerHandler(LogRendererProcessors* owner) : owner_(owner) {}
+        LoggerHandler(LogRendererProcessors* owner) : owner_(owner), buffer_(queueCapacity) {}
 
         virtual ~LoggerHandler() { owner_ = nullptr; }
 
@@ -52,18 +61,26 @@ class IVW_MODULE_DEVTOOLS_API LogRendererProcessors : public Processor {
                          std::string_view file, std::string_view function, int line,
                          std::string_view msg) override;
 
-        LogRendererProcessors* owner_;
+        LogRendererProcessors* owner_;  ///< only accessed on the main thread
+        std::weak_ptr<LoggerHandler> self_;
+        LogRingBuffer buffer_;
+        std::atomic<bool> invalidationPending_{false};
+        std::atomic<bool> logInfo_{true};
+        std::atomic<bool> logWarnings_{true};
+        std::atomic<bool> logErrors_{true};
     };
 
 public:
     LogRendererProcessors();
-    virtual ~LogRendererProcessors() = default;
+    virtual ~LogRendererProcessors();
 
     virtual void process() override;
 
     virtual const ProcessorInfo& getProcessorInfo() const override;
     static const ProcessorInfo processorInfo_;
 
+    static constexpr size_t queueCapacity = 4096;
+
 private:
     ImageOutport outport_;
     FontProperty font_;
@@ -75,9 +92,14 @@ private:
     BoolProperty logWarnings_;
     BoolProperty logErrors_;
 
+    IntSizeTProperty historySize_;
+    IntSizeTProperty dropped_;
+    IntSizeTProperty overflowed_;
+
     TextRenderer textRenderer_;
 
-    std::vector<std::string> rows_;
+    std::deque<LogRecord> history_;
+    size_t overflowCount_ = 0;
 
     std::shared_ptr<LoggerHandler> loggerHandler_;
 };
@@ -0,0 +1,136 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+#pragma once
+
+#include <inviwo/devtools/devtoolsmoduledefine.h>
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace inviwo {
+
+/**
+ * Measures the time from when an input event arrives until the next frame has been produced.
+ * Each event gets an id and stays pending until frameFinished() is called. All pending events
+ * are then completed by that frame, and their latencies are added to the statistics of their
+ * type. Processor executions can be recorded as well. Everything is tagged with the frame that
+ * completed it and can be exported as Chrome trace-event JSON (chrome://tracing, Perfetto).
+ *
+ * Not thread safe, it is meant to be used from the main thread only.
+ */
+class IVW_MODULE_DEVTOOLS_API EventLatencyTracer {
+public:
+    using Clock = std::chrono::steady_clock;
+    using Duration = std::chrono::duration<double, std::milli>;
+
+    struct Percentiles {
+        size_t count = 0;
+        double p50 = 0.0;  ///< in milliseconds
+        double p95 = 0.0;
+        double p99 = 0.0;
+        double max = 0.0;
+    };
+
+    /**
+     * @param timeout         events still pending after this long are discarded as expired, for
+     *                        example events that did not cause any processing at all
+     * @param maxTraceEvents  maximum number of recorded trace entries, further ones are dropped
+     */
+    explicit EventLatencyTracer(Duration timeout = std::chrono::seconds{5},
+                                size_t maxTraceEvents = 1'000'000);
+
+    void setTimeout(Duration timeout) { timeout_ = timeout; }
+
+    /// Records the arrival of an event of `type`, returns its id
+    size_t eventReceived(std::string_view type, Clock::time_point time = Clock::now());
+
+    /// Records an execution of `processor` for the trace
+    void processorFinished(std::string_view processor, Clock::time_point begin,
+                           Clock::time_point end = Clock::now());
+
+    /**
+     * Completes all pending events with `time` as the time the frame was finished.
+     * @return the number of completed events
+     */
+    size_t frameFinished(Clock::time_point time = Clock::now());
+
+    /// Latency statistics for each event type
+    std::map<std::string, Percentiles, std::less<>> latencies() const;
+
+    size_t pending() const { return pending_.size(); }
+    size_t expired() const { return expired_; }
+    size_t frames() const { return frame_; }
+
+    /// A table of the latency statistics
+    std::string report() const;
+
+    /// Writes all completed events and recorded processor executions as trace-event JSON
+    void writeChromeTrace(std::ostream& os) const;
+
+    void clear();
+
+private:
+    struct Pending {
+        size_t id;
+        std::string type;
+        Clock::time_point time;
+    };
+    struct Span {
+        std::string name;
+        size_t track;  ///< 0 for events, processors get their own tracks
+        Clock::time_point begin;
+        Clock::time_point end;
+        size_t id;  ///< event id, 0 for processors
+        size_t frame;
+    };
+
+    void addSpan(Span span);
+
+    Duration timeout_;
+    size_t maxTraceEvents_;
+    Clock::time_point start_;
+
+    std::vector<Pending> pending_;
+    std::map<std::string, std::vector<double>, std::less<>> samples_;
+    std::vector<Span> spans_;
+    std::map<std::string, size_t, std::less<>> tracks_;
+
+    size_t nextId_ = 1;
+    size_t frame_ = 0;
+    size_t expired_ = 0;
+    size_t droppedTraceEvents_ = 0;
+};
+
+}  // namespace inviwo
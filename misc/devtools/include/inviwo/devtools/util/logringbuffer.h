@@ -0,0 +1,101 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+#pragma once
+
+#include <inviwo/devtools/devtoolsmoduledefine.h>
+#include <inviwo/core/util/logcentral.h>
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+
+namespace inviwo {
+
+/**
+ * The unformatted content of a log message. Formatting is deferred until the message is shown.
+ */
+struct IVW_MODULE_DEVTOOLS_API LogRecord {
+    std::string source;
+    LogLevel level = LogLevel::Info;
+    LogAudience audience = LogAudience::User;
+    std::string file;
+    std::string function;
+    int line = 0;
+    std::string msg;
+};
+
+/**
+ * A fixed capacity ring buffer of log records. Any number of threads may push concurrently
+ * without locking, while a single consumer thread takes the records out in order. Pushing to a
+ * full buffer drops the record and increments the dropped counter instead of blocking or
+ * allocating more memory.
+ */
+class IVW_MODULE_DEVTOOLS_API LogRingBuffer {
+public:
+    /// The capacity is rounded up to the next power of two
+    explicit LogRingBuffer(size_t capacity);
+    LogRingBuffer(const LogRingBuffer&) = delete;
+    LogRingBuffer& operator=(const LogRingBuffer&) = delete;
+    ~LogRingBuffer();
+
+    /**
+     * Appends a record, can be called from any thread.
+     * @return false if the buffer was full and the record was dropped
+     */
+    bool push(LogRecord&& record);
+
+    /**
+     * Moves all available records, in the order they were pushed, to `consumer`. Only one
+     * thread at a time may consume.
+     * @return the number of consumed records
+     */
+    size_t consume(const std::function<void(LogRecord&&)>& consumer);
+
+    size_t capacity() const { return mask_ + 1; }
+    /// Number of records dropped because the buffer was full
+    size_t dropped() const { return dropped_.load(std::memory_order_relaxed); }
+
+private:
+    struct Slot {
+        std::atomic<size_t> sequence;
+        LogRecord record;
+    };
+    static constexpr size_t cacheLine = 64;
+
+    std::unique_ptr<Slot[]> slots_;
+    size_t mask_;
+    alignas(cacheLine) std::atomic<size_t> head_{0};
+    alignas(cacheLine) size_t tail_{0};
+    alignas(cacheLine) std::atomic<size_t> dropped_{0};
+};
+
+}  // namespace inviwo
@@ -35,6 +35,9 @@
 
 #include <fmt/format.h>
 
+#include <iterator>
+#include <limits>
+
 namespace inviwo {
 
 // The Class Identifier has to be globally unique. Use a reverse DNS naming scheme
@@ -60,18 +63,53 @@ LogRendererProcessors::LogRendererProcessors()
     , logInfo_("logInfo", "Log Info Messages", true)
     , logWarnings_("logWarnings", "Log Warnings", true)
     , logErrors_("logErrors", "Log Errors", true)
+    , historySize_("historySize", "History Size",
+                   "Maximum number of messages to keep, older messages are discarded"_help, 1000,
+                   {1, ConstraintBehavior::Immutable}, {100000, ConstraintBehavior::Ignore})
+    , dropped_("dropped", "Dropped Messages",
+               "Messages that were lost because they arrived faster than they were rendered"_help,
+               0, {0, ConstraintBehavior::Immutable},
+               {std::numeric_limits<size_t>::max(), ConstraintBehavior::Ignore}, 1,
+               InvalidationLevel::Valid, PropertySemantics::Text)
+    , overflowed_("overflowed", "Discarded Messages",
+                  "Messages removed from the history to stay within the history size"_help, 0,
+                  {0, ConstraintBehavior::Immutable},
+                  {std::numeric_limits<size_t>::max(), ConstraintBehavior::Ignore}, 1,
+                  InvalidationLevel::Valid, PropertySemantics::Text)
     , textRenderer_{}
     , loggerHandler_{std::make_shared<LoggerHandler>(this)} {
+    loggerHandler_->self_ = loggerHandler_;
     fmtDesc_.setReadOnly(true);
+    dropped_.setReadOnly(true);
+    overflowed_.setReadOnly(true);
     addPort(outport_);
-    addProperties(fmt_, fmtDesc_, font_, logInfo_, logWarnings_, logErrors_);
+    addProperties(fmt_, fmtDesc_, font_, logInfo_, logWarnings_, logErrors_, historySize_, dropped_,
+                  overflowed_);
 
     font_.anchorPos_.setVisible(false);
 
+    // The logger reads the filters from other threads, mirror them in atomics
+    logInfo_.onChange([this]() { loggerHandler_->logInfo_ = logInfo_.get(); });
+    logWarnings_.onChange([this]() { loggerHandler_->logWarnings_ = logWarnings_.get(); });
+    logErrors_.onChange([this]() { loggerHandler_->logErrors_ = logErrors_.get(); });
+
     LogCentral::getPtr()->registerLogger(loggerHandler_);
 }
 
+LogRendererProcessors::~LogRendererProcessors() { loggerHandler_->owner_ = nullptr; }
+
 void LogRendererProcessors::process() {
+    // Reset before draining, a message arriving from now on queues the next invalidation
+    loggerHandler_->invalidationPending_.store(false);
+    loggerHandler_->buffer_.consume(
+        [&](LogRecord&& record) { history_.push_back(std::move(record)); });
+    while (history_.size() > historySize_.get()) {
+        history_.pop_front();
+        ++overflowCount_;
+    }
+    dropped_.set(loggerHandler_->buffer_.dropped());
+    overflowed_.set(overflowCount_);
+
     utilgl::activateAndClearTarget(outport_, ImageType::ColorDepth);
     utilgl::DepthFuncState depthFunc(GL_ALWAYS);
     utilgl::BlendModeState blending(GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
@@ -83,20 +121,22 @@ void LogRendererProcessors::process() {
     textRenderer_.setFontSize(font_.fontSize_);
     textRenderer_.setLineSpacing(font_.lineSpacing_);
 
-    auto maxRows = outport_.getDimensions().y / textRenderer_.getLineHeight();
+    const size_t maxRows = outport_.getDimensions().y / textRenderer_.getLineHeight();
 
-    auto getText = [&]() -> std::string {
-        if (rows_.size() > maxRows) {
-            return joinString(rows_.end() - maxRows, rows_.end(), "\n");
-        } else {
-            return joinString(rows_, "\n");
-        }
-    };
+    // Only the visible rows are formatted
+    std::string text;
+    const auto first = static_cast<std::ptrdiff_t>(
+        history_.size() > maxRows ? history_.size() - maxRows : size_t{0});
+    for (auto it = history_.begin() + first; it != history_.end(); ++it) {
+        if (it != history_.begin() + first) text.push_back('\n');
+        fmt::format_to(std::back_inserter(text), fmt::runtime(fmt_.get()), it->source, it->level,
+                       it->audience, it->file, it->function, it->line, it->msg);
+    }
 
-    auto height = textRenderer_.computeBoundingBox(getText()).textExtent.y;
+    auto height = textRenderer_.computeBoundingBox(text).textExtent.y;
     auto y = (height) / (float)(dim.y);
 
-    textRenderer_.render(getText(), vec2(-1, 2 * y - 1), invDim, vec4(1, 1, 1, 1));
+    textRenderer_.render(text, vec2(-1, 2 * y - 1), invDim, vec4(1, 1, 1, 1));
 
     utilgl::deactivateCurrentTarget();
 }
@@ -105,16 +145,21 @@ void LogRendererProcessors::LoggerHandler::log(std::string_view logSource, LogLe
                                                LogAudience audience, std::string_view file,
                                                std::string_view function, int line,
                                                std::string_view msg) {
-    if (logLevel == LogLevel::Info && !owner_->logInfo_.get()) return;
-    if (logLevel == LogLevel::Warn && !owner_->logWarnings_.get()) return;
-    if (logLevel == LogLevel::Error && !owner_->logErrors_.get()) return;
-    msg = fmt::format(fmt::runtime(owner_->fmt_.get()), logSource, logLevel, audience, file,
-                      function, line, msg);
-    owner_->rows_.emplace_back(msg);
-
-    dispatchFront([network = owner_->getNetwork(), id = owner_->getIdentifier()]() {
-        auto p = network->getProcessorByIdentifier(id);
-        if (p) p->invalidate(InvalidationLevel::InvalidOutput);
+    if (logLevel == LogLevel::Info && !logInfo_.load(std::memory_order_relaxed)) return;
+    if (logLevel == LogLevel::Warn && !logWarnings_.load(std::memory_order_relaxed)) return;
+    if (logLevel == LogLevel::Error && !logErrors_.load(std::memory_order_relaxed)) return;
+
+    if (!buffer_.push(LogRecord{std::string{logSource}, logLevel, audience, std::string{file},
+                                std::string{function}, line, std::string{msg}})) {
+        return;
+    }
+
+    // Coalesce, only the first message after the last process queues an invalidation
+    if (invalidationPending_.exchange(true)) return;
+    dispatchFront([handler = self_]() {
+        if (auto h = handler.lock(); h && h->owner_) {
+            h->owner_->invalidate(InvalidationLevel::InvalidOutput);
+        }
     });
 }
 
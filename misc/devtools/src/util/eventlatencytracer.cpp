@@ -0,0 +1,189 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/devtools/util/eventlatencytracer.h>
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+
+namespace inviwo {
+
+namespace {
+
+/// Nearest rank percentile of sorted values
+double percentile(const std::vector<double>& sorted, double p) {
+    if (sorted.empty()) return 0.0;
+    const auto rank = static_cast<size_t>(std::ceil(p * static_cast<double>(sorted.size())));
+    return sorted[std::clamp<size_t>(rank, 1, sorted.size()) - 1];
+}
+
+void writeJsonString(std::ostream& os, std::string_view str) {
+    os << '"';
+    for (const char c : str) {
+        switch (c) {
+            case '"':
+                os << "\\\"";
+                break;
+            case '\\':
+                os << "\\\\";
+                break;
+            case '\n':
+                os << "\\n";
+                break;
+            case '\t':
+                os << "\\t";
+                break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    os << fmt::format("\\u{:04x}", static_cast<int>(c));
+                } else {
+                    os << c;
+                }
+        }
+    }
+    os << '"';
+}
+
+}  // namespace
+
+EventLatencyTracer::EventLatencyTracer(Duration timeout, size_t maxTraceEvents)
+    : timeout_{timeout}, maxTraceEvents_{maxTraceEvents}, start_{Clock::now()} {}
+
+size_t EventLatencyTracer::eventReceived(std::string_view type, Clock::time_point time) {
+    const auto id = nextId_++;
+    pending_.push_back(Pending{id, std::string{type}, time});
+    return id;
+}
+
+void EventLatencyTracer::processorFinished(std::string_view processor, Clock::time_point begin,
+                                           Clock::time_point end) {
+    auto it = tracks_.find(processor);
+    if (it == tracks_.end()) {
+        it = tracks_.emplace(std::string{processor}, tracks_.size() + 1).first;
+    }
+    addSpan(Span{std::string{processor}, it->second, begin, end, 0, frame_});
+}
+
+size_t EventLatencyTracer::frameFinished(Clock::time_point time) {
+    size_t completed = 0;
+    for (auto& event : pending_) {
+        const Duration latency = time - event.time;
+        if (latency > timeout_) {
+            ++expired_;
+            continue;
+        }
+        samples_[event.type].push_back(latency.count());
+        addSpan(Span{std::move(event.type), 0, event.time, time, event.id, frame_});
+        ++completed;
+    }
+    pending_.clear();
+    ++frame_;
+    return completed;
+}
+
+std::map<std::string, EventLatencyTracer::Percentiles, std::less<>> EventLatencyTracer::latencies()
+    const {
+    std::map<std::string, Percentiles, std::less<>> res;
+    for (const auto& [type, values] : samples_) {
+        auto sorted = values;
+        std::sort(sorted.begin(), sorted.end());
+        res[type] = Percentiles{.count = sorted.size(),
+                                .p50 = percentile(sorted, 0.50),
+                                .p95 = percentile(sorted, 0.95),
+                                .p99 = percentile(sorted, 0.99),
+                                .max = sorted.empty() ? 0.0 : sorted.back()};
+    }
+    return res;
+}
+
+std::string EventLatencyTracer::report() const {
+    std::string str;
+    auto out = std::back_inserter(str);
+    fmt::format_to(out, "{:12} {:>8} {:>10} {:>10} {:>10} {:>10}\n", "Event", "Count", "p50 ms",
+                   "p95 ms", "p99 ms", "Max ms");
+    for (const auto& [type, p] : latencies()) {
+        fmt::format_to(out, "{:12} {:>8} {:>10.2f} {:>10.2f} {:>10.2f} {:>10.2f}\n", type, p.count,
+                       p.p50, p.p95, p.p99, p.max);
+    }
+    fmt::format_to(out, "Frames: {}, pending: {}, expired: {}", frame_, pending_.size(),
+                   expired_);
+    return str;
+}
+
+void EventLatencyTracer::writeChromeTrace(std::ostream& os) const {
+    const auto micros = [&](Clock::time_point t) {
+        return std::chrono::duration<double, std::micro>(t - start_).count();
+    };
+
+    os << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+    os << R"({"name":"thread_name","ph":"M","pid":1,"tid":0,"args":{"name":"Input events"}})";
+    for (const auto& [name, track] : tracks_) {
+        os << ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << track
+           << ",\"args\":{\"name\":";
+        writeJsonString(os, name);
+        os << "}}";
+    }
+    for (const auto& span : spans_) {
+        os << ",\n{\"name\":";
+        writeJsonString(os, span.name);
+        os << ",\"cat\":\"" << (span.id != 0 ? "event" : "process") << "\",\"ph\":\"X\""
+           << fmt::format(",\"ts\":{:.3f},\"dur\":{:.3f}", micros(span.begin),
+                          micros(span.end) - micros(span.begin))
+           << ",\"pid\":1,\"tid\":" << span.track << ",\"args\":{\"frame\":" << span.frame;
+        if (span.id != 0) os << ",\"event\":" << span.id;
+        os << "}}";
+    }
+    os << "\n],\"otherData\":{\"droppedTraceEvents\":" << droppedTraceEvents_
+       << ",\"expiredEvents\":" << expired_ << "}}\n";
+}
+
+void EventLatencyTracer::clear() {
+    pending_.clear();
+    samples_.clear();
+    spans_.clear();
+    tracks_.clear();
+    start_ = Clock::now();
+    nextId_ = 1;
+    frame_ = 0;
+    expired_ = 0;
+    droppedTraceEvents_ = 0;
+}
+
+void EventLatencyTracer::addSpan(Span span) {
+    if (spans_.size() >= maxTraceEvents_) {
+        ++droppedTraceEvents_;
+        return;
+    }
+    spans_.push_back(std::move(span));
+}
+
+}  // namespace inviwo
@@ -0,0 +1,112 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <inviwo/devtools/util/eventlatencytracer.h>
+
+#include <sstream>
+
+namespace inviwo {
+
+namespace {
+
+using namespace std::chrono_literals;
+using Clock = EventLatencyTracer::Clock;
+
+}  // namespace
+
+TEST(EventLatencyTracer, Percentiles) {
+    EventLatencyTracer tracer;
+    const auto t0 = Clock::now();
+
+    // 100 mouse events with latencies 1..100 ms, each answered by its own frame
+    for (int i = 1; i <= 100; ++i) {
+        const auto start = t0 + std::chrono::seconds{i};
+        tracer.eventReceived("Mouse", start);
+        EXPECT_EQ(tracer.frameFinished(start + std::chrono::milliseconds{i}), 1u);
+    }
+    const auto latencies = tracer.latencies();
+    ASSERT_EQ(latencies.count("Mouse"), 1u);
+    const auto& mouse = latencies.at("Mouse");
+    EXPECT_EQ(mouse.count, 100u);
+    EXPECT_NEAR(mouse.p50, 50.0, 1e-6);
+    EXPECT_NEAR(mouse.p95, 95.0, 1e-6);
+    EXPECT_NEAR(mouse.p99, 99.0, 1e-6);
+    EXPECT_NEAR(mouse.max, 100.0, 1e-6);
+    EXPECT_EQ(tracer.frames(), 100u);
+}
+
+TEST(EventLatencyTracer, FrameCompletesAllPendingEvents) {
+    EventLatencyTracer tracer{1s};
+    const auto t0 = Clock::now();
+
+    tracer.eventReceived("Mouse", t0);
+    tracer.eventReceived("Wheel", t0 + 4ms);
+    tracer.eventReceived("Mouse", t0 + 6ms);
+    EXPECT_EQ(tracer.pending(), 3u);
+    EXPECT_EQ(tracer.frameFinished(t0 + 10ms), 3u);
+    EXPECT_EQ(tracer.pending(), 0u);
+
+    const auto latencies = tracer.latencies();
+    EXPECT_EQ(latencies.at("Mouse").count, 2u);
+    EXPECT_NEAR(latencies.at("Mouse").max, 10.0, 1e-6);
+    EXPECT_NEAR(latencies.at("Wheel").p50, 6.0, 1e-6);
+
+    // Events that do not lead to a frame within the timeout are discarded
+    tracer.eventReceived("Keyboard", t0 + 20ms);
+    EXPECT_EQ(tracer.frameFinished(t0 + 5s), 0u);
+    EXPECT_EQ(tracer.expired(), 1u);
+    EXPECT_EQ(tracer.latencies().count("Keyboard"), 0u);
+}
+
+TEST(EventLatencyTracer, ChromeTrace) {
+    EventLatencyTracer tracer;
+    const auto t0 = Clock::now();
+    tracer.eventReceived("Mouse", t0);
+    tracer.processorFinished("Volume \"Raycaster\"", t0 + 1ms, t0 + 3ms);
+    tracer.frameFinished(t0 + 4ms);
+
+    std::stringstream ss;
+    tracer.writeChromeTrace(ss);
+    const auto json = ss.str();
+    EXPECT_NE(json.find("\"traceEvents\":["), std::string::npos);
+    EXPECT_NE(json.find(R"("name":"Volume \"Raycaster\"")"), std::string::npos);
+    EXPECT_NE(json.find(R"("name":"Mouse","cat":"event","ph":"X")"), std::string::npos);
+    EXPECT_NE(json.find(R"("args":{"frame":0,"event":1})"), std::string::npos);
+
+    EXPECT_NE(tracer.report().find("Mouse"), std::string::npos);
+    tracer.clear();
+    EXPECT_TRUE(tracer.latencies().empty());
+}
+
+}  // namespace inviwo
@@ -0,0 +1,128 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <inviwo/devtools/util/logringbuffer.h>
+
+#include <fmt/format.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace inviwo {
+
+namespace {
+
+LogRecord record(int line, std::string msg = {}) {
+    LogRecord r;
+    r.line = line;
+    r.msg = std::move(msg);
+    return r;
+}
+
+}  // namespace
+
+TEST(LogRingBuffer, PushAndConsumeInOrder) {
+    LogRingBuffer buffer{5};
+    EXPECT_EQ(buffer.capacity(), 8u);
+
+    for (int i = 0; i < 3; ++i) EXPECT_TRUE(buffer.push(record(i, fmt::format("msg {}", i))));
+
+    std::vector<LogRecord> out;
+    EXPECT_EQ(buffer.consume([&](LogRecord&& r) { out.push_back(std::move(r)); }), 3u);
+    ASSERT_EQ(out.size(), 3u);
+    for (int i = 0; i < 3; ++i) {
+        EXPECT_EQ(out[i].line, i);
+        EXPECT_EQ(out[i].msg, fmt::format("msg {}", i));
+    }
+    EXPECT_EQ(buffer.consume([](LogRecord&&) {}), 0u);
+}
+
+TEST(LogRingBuffer, DropsWhenFull) {
+    LogRingBuffer buffer{4};
+    for (int i = 0; i < 4; ++i) EXPECT_TRUE(buffer.push(record(i)));
+    EXPECT_FALSE(buffer.push(record(4)));
+    EXPECT_FALSE(buffer.push(record(5)));
+    EXPECT_EQ(buffer.dropped(), 2u);
+
+    std::vector<int> lines;
+    buffer.consume([&](LogRecord&& r) { lines.push_back(r.line); });
+    EXPECT_EQ(lines, (std::vector<int>{0, 1, 2, 3}));
+
+    // Wraps around once space is available again
+    for (int i = 0; i < 4; ++i) EXPECT_TRUE(buffer.push(record(10 + i)));
+    lines.clear();
+    buffer.consume([&](LogRecord&& r) { lines.push_back(r.line); });
+    EXPECT_EQ(lines, (std::vector<int>{10, 11, 12, 13}));
+}
+
+TEST(LogRingBuffer, ConcurrentProducers) {
+    constexpr int producers = 8;
+    constexpr int perProducer = 20000;
+    LogRingBuffer buffer{1024};
+
+    std::vector<int> next(producers, 0);
+    size_t received = 0;
+    bool ordered = true;
+    auto consume = [&]() {
+        return buffer.consume([&](LogRecord&& r) {
+            const int producer = r.line / perProducer;
+            const int index = r.line % perProducer;
+            // Records of one producer arrive in order, some may have been dropped
+            ordered = ordered && index >= next[producer];
+            next[producer] = index + 1;
+            ++received;
+        });
+    };
+
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; ++p) {
+        threads.emplace_back([&buffer, p]() {
+            for (int i = 0; i < perProducer; ++i) buffer.push(record(p * perProducer + i));
+        });
+    }
+    std::atomic<bool> done{false};
+    std::thread consumer{[&]() {
+        while (!done) consume();
+    }};
+    for (auto& t : threads) t.join();
+    done = true;
+    consumer.join();
+    consume();
+
+    EXPECT_TRUE(ordered);
+    EXPECT_EQ(received + buffer.dropped(), static_cast<size_t>(producers * perProducer));
+}
+
+}  // namespace inviwo
@@ -1,11 +1,14 @@
 import numpy
 import inspect
+import weakref
 from netCDF4 import Dataset, Dimension, Variable
 
 import inviwopy as ivw
 from inviwopy.properties import FileProperty, ButtonProperty, BoolProperty, \
     BoolCompositeProperty, CompositeProperty, IntMinMaxProperty, StringProperty
 
+import netcdftimesteps
+
 
 class GenericNetCDFSource(ivw.Processor):
     def log(self, msg):
@@ -33,8 +36,13 @@ class GenericNetCDFSource(ivw.Processor):
         self.addProperty(self.ignoreDimNames)
         self.addProperty(self.triggerLoad)
 
-        self.displayInfo.onChange(self.displayDataInfo)
+        # The callback only holds a weak reference, a bound method would keep the processor alive
+        # through the property after it has been removed from the network
+        displayDataInfo = weakref.WeakMethod(self.displayDataInfo)
+        self.displayInfo.onChange(lambda: (method := displayDataInfo()) and method())
         self.firstRun = True
+        # Modifying any of these properties reloads the data
+        self.reloadProperties = [self.triggerLoad]
 
     @staticmethod
     def enabled(prop: BoolCompositeProperty):
@@ -66,6 +74,30 @@ class GenericNetCDFSource(ivw.Processor):
         for dim in dims:
             self.addMinmaxProperty(dim)
 
+    def hyperslab(self, var: Variable):
+        """The inclusive ranges of the dimensions of var to load, as slices"""
+        return tuple(slice(r.x, r.y + 1) for r in (self.minmax(dim) for dim in var.get_dims()))
+
+    def dataExtents(self, nc: Dataset, dims: list[Dimension]):
+        extents = []
+        for dim in dims:
+            dimRange = self.minmax(dim)
+            if dimRange.x == dimRange.y:
+                continue
+            ncDimVar = nc.variables[dim.name]
+            cellExt = ncDimVar[1] - ncDimVar[0]
+            cellNum = dimRange.y - dimRange.x
+            extents.append(cellExt * cellNum)
+        return extents
+
+    def loadLazily(self):
+        """
+        Overload and return True to get dataSelected(names, slabs, extents) called instead of
+        dataLoaded when loading, and read the data on demand. It is called after the file has been
+        closed and netcdfLock released, so it can open readers of its own
+        """
+        return False
+
     def addVariablePropery(self, variable: Variable):
         enabled = BoolCompositeProperty(self.cleanName(variable.name), variable.name, False)
         enabled.readOnly = len(variable.shape) < self.outputDimension
@@ -101,7 +133,10 @@ class GenericNetCDFSource(ivw.Processor):
             self.dimensions.clear()
             return
 
-        with Dataset(self.filePath.value, "r", format="NETCDF4") as nc:
+        selected = None
+        loaded = None
+        with netcdftimesteps.netcdfLock, \
+                Dataset(self.filePath.value, "r", format="NETCDF4") as nc:
             # Update variables.
             if self.filePath.isModified:
                 if self.variables.empty() or any(var.displayName not in nc.variables
@@ -157,34 +192,31 @@ class GenericNetCDFSource(ivw.Processor):
                                      f" to be {minmax0} got {minmaxi}")
                             return
 
-            if self.triggerLoad.isModified or first:
+            if first or any(prop.isModified for prop in self.reloadProperties):
                 if len(nonZeroDims) == 0:
                     self.log("No variables selected")
                     return
 
-                data = []
-                for var in request:
-                    ranges = [self.minmax(dim) for dim in var.get_dims()]
-                    sizeDims = [r.y - r.x + 1 for r in ranges if r.x != r.y]
-                    dims = [slice(item.x, item.y + 1) for item in ranges]
-                    varData = var[tuple(dims)]
-                    buffer = numpy.array(varData).astype(
-                        'float32' if self.toFloat.value else var.datatype)
-                    buffer.shape = buffer.shape[3:] + (1,)
-                    data.append(buffer)
-
-                # Assemble data extent.
-                extents = []
-                for dim in nonZeroDims[0][1]:
-                    dimRange = self.minmax(dim)
-                    if dimRange.x == dimRange.y:
-                        continue
-                    ncDimVar = nc.variables[dim.name]
-                    cellExt = ncDimVar[1] - ncDimVar[0]
-                    cellNum = dimRange.y - dimRange.x
-                    extents.append(cellExt * cellNum)
+                extents = self.dataExtents(nc, nonZeroDims[0][1])
+
+                if self.loadLazily():
+                    selected = ([var.name for var in request],
+                                [self.hyperslab(var) for var in request], extents)
+                else:
+                    loaded = ([self.readVariable(var) for var in request], extents)
+
+        if selected is not None:
+            self.dataSelected(*selected)  # implemented in child
+        elif loaded is not None:
+            self.dataLoaded(*loaded)  # implemented in child
 
-                self.dataLoaded(data, extents)  # implemented in child
+    def readVariable(self, var: Variable):
+        ranges = [self.minmax(dim) for dim in var.get_dims()]
+        sizeDims = [r.y - r.x + 1 for r in ranges if r.x != r.y]
+        varData = var[self.hyperslab(var)]
+        buffer = numpy.array(varData).astype('float32' if self.toFloat.value else var.datatype)
+        buffer.shape = tuple(sizeDims) + (1,)
+        return buffer
 
     def displayDataInfo(self):
         if not self.filePath.value.is_file():
@@ -196,7 +228,8 @@ class GenericNetCDFSource(ivw.Processor):
                 self.log(f"{indent*' '}{attr}: {getattr(item, attr)}")
 
         self.log(f"File: {self.filePath.value}")
-        with Dataset(self.filePath.value, "r", format="NETCDF4") as nc:
+        with netcdftimesteps.netcdfLock, \
+                Dataset(self.filePath.value, "r", format="NETCDF4") as nc:
             attrs(nc)
             self.log(f"Dimensions: {', '.join(nc.dimensions)}")
             for name, var in nc.variables.items():
@@ -0,0 +1,154 @@
+import threading
+from collections import OrderedDict
+from concurrent.futures import ThreadPoolExecutor
+
+import numpy
+from netCDF4 import Dataset, Variable
+
+# The netCDF C library is not thread safe, every access to a dataset has to hold this lock.
+netcdfLock = threading.Lock()
+
+
+def attributeRange(var: Variable):
+    """
+    The CF 'actual_range' attribute of a variable, if present. It describes the range of the
+    unpacked values, and lets us set a data range without reading any data.
+    """
+    if 'actual_range' in var.ncattrs():
+        actual = numpy.ravel(var.getncattr('actual_range'))
+        if actual.size == 2:
+            return (float(actual[0]), float(actual[1]))
+    return None
+
+
+def extendRange(valueRange, raw):
+    """Extends (min, max) by the values of a masked array, ignoring masked fill values"""
+    if numpy.ma.count(raw) == 0:
+        return valueRange
+    return (min(valueRange[0], float(numpy.ma.min(raw))),
+            max(valueRange[1], float(numpy.ma.max(raw))))
+
+
+class TimeStepReader:
+    """
+    Reads single time steps of a set of NetCDF variables on demand. Each time step is read as a
+    hyperslab, i.e. only the data of that step within the selected ranges, and the decoded
+    steps are kept in a bounded LRU cache. When a step is accessed, the next one is read in the
+    background. The file is only open while reading, so an idle reader holds no resources.
+
+    The time dimension is the first dimension of each variable that is not collapsed. The
+    remaining three dimensions form the volume of each step, and the variables become its
+    components.
+    """
+
+    def __init__(self, path, names: list[str], slabs: list[tuple[slice, ...]], dtype=None,
+                 cacheSize=4, prefetch=True):
+        """
+        path:      NetCDF file
+        names:     variable names, one component each
+        slabs:     the inclusive index ranges to load, as slices, of each variable
+        dtype:     convert the data to this type, the type of the variable if None
+        cacheSize: maximum number of decoded time steps to keep
+        prefetch:  read the step following an accessed step in the background
+        """
+        self.path = path
+        self.names = names
+        self.dtype = dtype
+        self.cacheSize = max(1, cacheSize)
+        self.prefetchNext = prefetch
+
+        self.slabs = []
+        self.timeAxes = []
+        for slab in slabs:
+            nonCollapsed = [i for i, s in enumerate(slab) if s.stop - s.start > 1]
+            if len(nonCollapsed) != 4:
+                raise ValueError(f"Expected 4 non collapsed dimensions got {len(nonCollapsed)}")
+            self.slabs.append(slab)
+            self.timeAxes.append(nonCollapsed[0])
+        first = self.slabs[0]
+        sizes = [s.stop - s.start for s in first if s.stop - s.start > 1]
+        self.numSteps = sizes[0]
+        self.shape = tuple(sizes[1:]) + (1,)
+
+        self.cache = OrderedDict()  # step -> (buffer, (min, max))
+        self.pending = {}  # step -> Future
+        self.executor = ThreadPoolExecutor(max_workers=1, thread_name_prefix="netcdf-prefetch")
+
+        with netcdfLock, Dataset(self.path, "r") as nc:
+            ranges = [attributeRange(nc.variables[name]) for name in self.names]
+        self.range = None
+        if all(r is not None for r in ranges):
+            self.range = (min(r[0] for r in ranges), max(r[1] for r in ranges))
+
+    def close(self):
+        for future in self.pending.values():
+            future.cancel()
+        self.pending.clear()
+        self.executor.shutdown(wait=True)
+        self.cache.clear()
+
+    def _hyperslabs(self, nc: Dataset, step: int):
+        """The variables and their raw masked data of a time step, requires the lock"""
+        for name, slab, axis in zip(self.names, self.slabs, self.timeAxes):
+            var = nc.variables[name]
+            index = list(slab)
+            index[axis] = slab[axis].start + step
+            yield var, var[tuple(index)]
+
+    def _read(self, step: int):
+        parts = []
+        valueRange = (numpy.inf, -numpy.inf)
+        with netcdfLock, Dataset(self.path, "r") as nc:
+            for var, raw in self._hyperslabs(nc, step):
+                valueRange = extendRange(valueRange, raw)
+                parts.append(numpy.ma.getdata(raw).astype(
+                    self.dtype if self.dtype is not None else var.datatype, copy=False))
+
+        parts = [part.reshape(self.shape) for part in parts]
+        buffer = parts[0] if len(parts) == 1 else numpy.concatenate(parts, axis=3)
+        if valueRange[0] > valueRange[1]:
+            valueRange = (0.0, 0.0)
+        return buffer, valueRange
+
+    def prefetch(self, step: int):
+        if step < 0 or step >= self.numSteps or step in self.cache or step in self.pending:
+            return
+        # Only keep the latest request, older ones that did not start yet are dropped
+        for old in list(self.pending):
+            if self.pending[old].cancel():
+                del self.pending[old]
+        self.pending[step] = self.executor.submit(self._read, step)
+
+    def get(self, step: int):
+        """Returns the buffer of time step and its (min, max) value range"""
+        if step < 0 or step >= self.numSteps:
+            raise IndexError(f"Time step {step} out of range [0, {self.numSteps})")
+
+        if step in self.cache:
+            self.cache.move_to_end(step)
+            data = self.cache[step]
+        else:
+            future = self.pending.pop(step, None)
+            data = future.result() if future is not None else self._read(step)
+            self.cache[step] = data
+            while len(self.cache) > self.cacheSize:
+                self.cache.popitem(last=False)
+
+        if self.prefetchNext:
+            self.prefetch(step + 1)
+        return data
+
+    def dataRange(self):
+        """
+        The range of all time steps, which stays the same while scrubbing. Taken from the
+        'actual_range' attributes if all variables have one. Otherwise all steps are scanned
+        once, one step at a time, on the first call.
+        """
+        if self.range is None:
+            valueRange = (numpy.inf, -numpy.inf)
+            with netcdfLock, Dataset(self.path, "r") as nc:
+                for step in range(self.numSteps):
+                    for _, raw in self._hyperslabs(nc, step):
+                        valueRange = extendRange(valueRange, raw)
+            self.range = valueRange if valueRange[0] <= valueRange[1] else (0.0, 0.0)
+        return self.range
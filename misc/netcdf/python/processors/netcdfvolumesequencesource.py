@@ -3,11 +3,14 @@
 import inviwopy as ivw
 from inviwopy.glm import dvec2, mat4, vec4
 from inviwopy.properties import BoolProperty, DoubleMinMaxProperty, OptionPropertyInt, \
-    FloatMat4Property
+    FloatMat4Property, IntProperty
 import genericnetcdfsource
+import netcdftimesteps
 import numpy
 import importlib
+import weakref
 importlib.reload(genericnetcdfsource)
+importlib.reload(netcdftimesteps)
 
 
 def options(enum):
@@ -20,6 +23,28 @@ class NetCDFVolumeSequenceSource(genericnetcdfsource.GenericNetCDFSource):
         genericnetcdfsource.GenericNetCDFSource.__init__(self, id, name, outputDimension=4)
         self.volumeOutport = ivw.data.VolumeSequenceOutport("data4D")
         self.addOutport(self.volumeOutport, owner=False)
+        self.timeStepOutport = ivw.data.VolumeOutport("timeStep")
+        self.addOutport(self.timeStepOutport, owner=False)
+
+        # Lazy mode, only the selected time step is read and put on the time step outport
+        self.lazy = BoolProperty("lazy", "Load Time Steps On Demand", False)
+        self.addProperty(self.lazy)
+        self.timeStep = IntProperty("timeStep", "Time Step", 0, 0, 0, 1)
+        self.addProperty(self.timeStep)
+        self.cacheSize = IntProperty("cacheSize", "Cached Time Steps", 4, 1, 64, 1)
+        self.addProperty(self.cacheSize)
+        self.prefetch = BoolProperty("prefetch", "Prefetch Next Time Step", True)
+        self.addProperty(self.prefetch)
+        for prop in (self.timeStep, self.cacheSize, self.prefetch):
+            prop.readonlyDependsOn(self.lazy, lambda x: not x.value)
+        self.reloadProperties += [self.lazy, self.cacheSize, self.prefetch, self.toFloat]
+        self.reader = None
+        self.spatialExtents = []
+        # Close the reader as soon as the file or the loading mode changes, the callbacks only
+        # hold a weak reference to not keep the processor alive
+        closeReader = weakref.WeakMethod(self.closeReader)
+        for prop in (self.filePath, self.lazy):
+            prop.onChange(lambda: (method := closeReader()) and method())
 
         self.interpolation = OptionPropertyInt(
             "interpolation", "Interpolation", options(ivw.data.InterpolationType), 0)
@@ -66,43 +91,79 @@ class NetCDFVolumeSequenceSource(genericnetcdfsource.GenericNetCDFSource):
     def getProcessorInfo(self):
         return NetCDFVolumeSequenceSource.processorInfo()
 
+    def createVolume(self, buffer, extents, dataRange):
+        volume = ivw.data.Volume(buffer)
+        if self.overwriteDataRange.value:
+            volume.dataMap.dataRange = self.dataRange.value
+        else:
+            volume.dataMap.dataRange = dvec2(dataRange[0], dataRange[1])
+        volume.dataMap.valueRange = volume.dataMap.dataRange
+
+        if self.overwriteModel:
+            volume.modelMatrix = self.modelMatrix.value
+        else:
+            volume.modelMatrix = mat4(
+                vec4(extents[2], 0, 0, 0),
+                vec4(0, extents[1], 0, 0),
+                vec4(0, 0, extents[0], 0),
+                vec4(0, 0, 0, 1)
+            )
+        volume.interpolation = ivw.data.InterpolationType(self.interpolation.value)
+        volume.wrapping = [
+            ivw.data.Wrapping(self.wrappingX.value),
+            ivw.data.Wrapping(self.wrappingY.value),
+            ivw.data.Wrapping(self.wrappingZ.value)
+        ]
+        return volume
+
+    def closeReader(self):
+        if self.reader is not None:
+            self.reader.close()
+            self.reader = None
+
+    def loadLazily(self):
+        return self.lazy.value
+
+    def dataSelected(self, names, slabs, extents):
+        self.closeReader()
+        self.reader = netcdftimesteps.TimeStepReader(
+            self.filePath.value, names, slabs,
+            dtype='float32' if self.toFloat.value else None,
+            cacheSize=self.cacheSize.value, prefetch=self.prefetch.value)
+        self.timeStep.maxValue = self.reader.numSteps - 1
+        # The first dimension is time
+        self.spatialExtents = extents[1:]
+
+    def process(self):
+        genericnetcdfsource.GenericNetCDFSource.process(self)
+
+        if not self.lazy.value:
+            self.closeReader()
+            self.timeStepOutport.clear()
+            return
+        self.volumeOutport.clear()
+        if self.reader is None:
+            self.timeStepOutport.clear()
+            return
+
+        step = min(self.timeStep.value, self.reader.numSteps - 1)
+        buffer, _ = self.reader.get(step)
+        if self.overwriteDataRange.value:
+            dataRange = self.dataRange.value
+        else:
+            # The same range for all time steps, shown in the data range property
+            dataRange = self.reader.dataRange()
+            self.dataRange.value = dvec2(dataRange[0], dataRange[1])
+        self.timeStepOutport.setData(self.createVolume(buffer, self.spatialExtents, dataRange))
+
     def dataLoaded(self, data, extents):
+        # Each buffer is laid out as (time, z, y, x, 1)
         volumeSequence = []
-        for timeStep in range(data[0].shape[3]):
-            subData = []
-            for comp in data:
-                # A bit brute force, but delivers correct data.
-                numElems = comp.shape[0] * comp.shape[1] * comp.shape[2]
-                subBuffer = comp.flat[(numElems * timeStep): (numElems * (timeStep + 1))]
-                subBuffer.shape = (comp.shape[0],
-                                   comp.shape[1], comp.shape[2], 1)
-                subData.append(subBuffer)
-            buffer = numpy.concatenate(subData, axis=3)
-            volume = ivw.data.Volume(buffer)
-            if self.overwriteDataRange.value:
-                volume.dataMap.dataRange = self.dataRange.value
-            else:
-                minVal = numpy.amin(buffer)
-                maxVal = numpy.amax(buffer)
-                volume.dataMap.dataRange = dvec2(minVal, maxVal)
-            volume.dataMap.valueRange = volume.dataMap.dataRange
-
-            if self.overwriteModel:
-                volume.modelMatrix = self.modelMatrix.value
-            else:
-                volume.modelMatrix = mat4(
-                    vec4(extents[2], 0, 0, 0),
-                    vec4(0, extents[1], 0, 0),
-                    vec4(0, 0, extents[0], 0),
-                    vec4(0, 0, 0, 1)
-                )
-            volume.interpolation = ivw.data.InterpolationType(self.interpolation.value)
-            volume.wrapping = [
-                ivw.data.Wrapping(self.wrappingX.value),
-                ivw.data.Wrapping(self.wrappingY.value),
-                ivw.data.Wrapping(self.wrappingZ.value)
-            ]
-            volumeSequence.append(volume)
+        for timeStep in range(data[0].shape[0]):
+            subData = [comp[timeStep] for comp in data]
+            buffer = subData[0] if len(subData) == 1 else numpy.concatenate(subData, axis=3)
+            volumeSequence.append(self.createVolume(
+                buffer, extents[1:], (numpy.amin(buffer), numpy.amax(buffer))))
 
         sequence = ivw.data.VolumeSequence(volumeSequence)
         self.volumeOutport.setData(sequence)
@@ -0,0 +1,106 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+#pragma once
+
+#include <inviwo/pythontools/pythontoolsmoduledefine.h>
+#include <inviwo/core/processors/processor.h>
+#include <inviwo/core/ports/imageport.h>
+#include <inviwo/core/properties/buttonproperty.h>
+#include <inviwo/core/properties/compositeproperty.h>
+#include <inviwo/core/properties/directoryproperty.h>
+#include <inviwo/core/properties/optionproperty.h>
+#include <inviwo/core/properties/ordinalproperty.h>
+#include <inviwo/core/properties/stringproperty.h>
+#include <inviwo/pythontools/util/asyncframewriter.h>
+
+#include <atomic>
+#include <filesystem>
+#include <memory>
+#include <string>
+
+namespace inviwo {
+
+class IVW_MODULE_PYTHONTOOLS_API ImageSequenceRecorder : public Processor {
+public:
+    enum class Format { PNG, Raw };
+
+    ImageSequenceRecorder();
+    virtual ~ImageSequenceRecorder() = default;
+
+    virtual void process() override;
+
+    virtual const ProcessorInfo& getProcessorInfo() const override;
+    static const ProcessorInfo processorInfo_;
+
+private:
+    void startRecording();
+    void stopRecording();
+    void updateStats();
+
+    ImageInport inport_;
+    ImageOutport outport_;
+
+    DirectoryProperty directory_;
+    StringProperty baseName_;
+    OptionProperty<Format> format_;
+    IntSizeTProperty queueSize_;
+    IntSizeTProperty threads_;
+    OptionProperty<AsyncFrameWriter::Overflow> overflow_;
+    ButtonProperty start_;
+    ButtonProperty stop_;
+
+    CompositeProperty stats_;
+    IntSizeTProperty frames_;
+    IntSizeTProperty queueDepth_;
+    IntSizeTProperty written_;
+    IntSizeTProperty dropped_;
+    DoubleProperty framesPerSecond_;
+    DoubleProperty megabytesPerSecond_;
+
+    /// The output settings when the recording started, the encoder is fixed by then
+    struct Target {
+        std::filesystem::path directory;
+        std::string baseName;
+        Format format = Format::PNG;
+    };
+
+    /// Lets the writer threads refresh the statistics, queued refreshes expire with the processor
+    struct StatsRefresh {
+        explicit StatsRefresh(ImageSequenceRecorder* recorder) : owner{recorder} {}
+        ImageSequenceRecorder* owner;
+        std::atomic<bool> pending{false};
+    };
+
+    std::shared_ptr<StatsRefresh> statsRefresh_;
+    std::unique_ptr<AsyncFrameWriter> writer_;
+    Target target_;
+    size_t frameIndex_ = 0;
+};
+
+}  // namespace inviwo
@@ -0,0 +1,127 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+#pragma once
+
+#include <inviwo/pythontools/pythontoolsmoduledefine.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace inviwo {
+
+class LayerRAM;
+
+/**
+ * Writes frames to disk on background threads. Frames are queued in a bounded queue, when the
+ * queue is full a new frame is either dropped or the caller blocks until there is space, see
+ * Overflow. Each thread uses its own encoder, so encoders do not need to be thread safe.
+ */
+class IVW_MODULE_PYTHONTOOLS_API AsyncFrameWriter {
+public:
+    enum class Overflow { Drop, Block };
+
+    /// Writes a frame to a file, called on a background thread
+    using Encoder = std::function<void(std::shared_ptr<LayerRAM>, const std::filesystem::path&)>;
+    /// Called on a background thread after each frame is written or failed
+    using OnWritten = std::function<void()>;
+
+    struct Stats {
+        size_t queueDepth = 0;
+        size_t written = 0;
+        size_t dropped = 0;
+        size_t failed = 0;
+        double framesPerSecond = 0.0;
+        double megabytesPerSecond = 0.0;
+        std::string lastError;
+    };
+
+    /**
+     * @param capacity     maximum number of queued frames
+     * @param threads      number of encoding threads
+     * @param overflow     what to do with a new frame when the queue is full
+     * @param makeEncoder  called once for every thread, on the calling thread
+     * @param onWritten    optional, called after each frame, must be thread safe
+     */
+    AsyncFrameWriter(size_t capacity, size_t threads, Overflow overflow,
+                     const std::function<Encoder()>& makeEncoder, OnWritten onWritten = {});
+    AsyncFrameWriter(const AsyncFrameWriter&) = delete;
+    AsyncFrameWriter& operator=(const AsyncFrameWriter&) = delete;
+    /// Writes all queued frames before returning, @see finish
+    ~AsyncFrameWriter();
+
+    /**
+     * Queues a frame for writing. The frame must not be modified afterwards.
+     * @return false if the queue was full and the frame was dropped
+     */
+    bool push(std::shared_ptr<LayerRAM> frame, std::filesystem::path path);
+
+    /// Waits until all queued frames are written and stops the threads
+    void finish();
+
+    Stats stats() const;
+
+private:
+    struct Item {
+        std::shared_ptr<LayerRAM> frame;
+        std::filesystem::path path;
+    };
+
+    void work(Encoder encoder);
+
+    size_t capacity_;
+    Overflow overflow_;
+    OnWritten onWritten_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable notEmpty_;
+    std::condition_variable notFull_;
+    std::deque<Item> queue_;
+    bool stopping_ = false;
+    std::string lastError_;
+
+    std::atomic<size_t> written_{0};
+    std::atomic<size_t> bytes_{0};
+    std::atomic<size_t> dropped_{0};
+    std::atomic<size_t> failed_{0};
+    std::chrono::steady_clock::time_point start_;
+
+    std::vector<std::thread> threads_;
+};
+
+}  // namespace inviwo
@@ -0,0 +1,251 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/pythontools/processors/imagesequencerecorder.h>
+#include <inviwo/core/common/inviwoapplication.h>
+#include <inviwo/core/datastructures/image/image.h>
+#include <inviwo/core/datastructures/image/layer.h>
+#include <inviwo/core/datastructures/image/layerram.h>
+#include <inviwo/core/io/datawriter.h>
+#include <inviwo/core/io/datawriterfactory.h>
+#include <inviwo/core/util/exception.h>
+#include <inviwo/core/util/formats.h>
+
+#include <fmt/format.h>
+#include <fmt/std.h>
+
+#include <glm/gtx/component_wise.hpp>
+
+#include <fstream>
+#include <limits>
+
+namespace inviwo {
+
+const ProcessorInfo ImageSequenceRecorder::processorInfo_{
+    "org.inviwo.ImageSequenceRecorder",  // Class identifier
+    "Image Sequence Recorder",           // Display name
+    "Data Output",                       // Category
+    CodeState::Experimental,             // Code state
+    Tags::CPU,                           // Tags
+    R"(Records the images passing through as a numbered sequence of PNG or raw files.
+    Each frame is copied into a bounded queue on the network thread and encoded on background
+    threads, so encoding does not add to the frame time. When the queue is full new frames are
+    either dropped or the network waits for space.)"_unindentHelp};
+const ProcessorInfo& ImageSequenceRecorder::getProcessorInfo() const { return processorInfo_; }
+
+namespace {
+
+constexpr auto maxCount = std::numeric_limits<size_t>::max();
+
+IntSizeTProperty statProperty(std::string_view identifier, std::string_view displayName,
+                              Document help) {
+    return IntSizeTProperty{identifier,
+                            displayName,
+                            std::move(help),
+                            0,
+                            {0, ConstraintBehavior::Immutable},
+                            {maxCount, ConstraintBehavior::Ignore},
+                            1,
+                            InvalidationLevel::Valid,
+                            PropertySemantics::Text};
+}
+
+DoubleProperty rateProperty(std::string_view identifier, std::string_view displayName,
+                            Document help) {
+    return DoubleProperty{identifier,
+                          displayName,
+                          std::move(help),
+                          0.0,
+                          {0.0, ConstraintBehavior::Immutable},
+                          {std::numeric_limits<double>::max(), ConstraintBehavior::Ignore},
+                          0.1,
+                          InvalidationLevel::Valid,
+                          PropertySemantics::Text};
+}
+
+size_t sizeInBytes(const LayerRAM& frame) {
+    return glm::compMul(frame.getDimensions()) * frame.getDataFormat()->getSizeInBytes();
+}
+
+void writeRaw(const LayerRAM& frame, const std::filesystem::path& path) {
+    std::ofstream file{path, std::ios::binary};
+    if (!file) throw Exception(SourceContext{}, "Could not open {} for writing", path);
+    const auto bytes = sizeInBytes(frame);
+    file.write(static_cast<const char*>(frame.getData()), static_cast<std::streamsize>(bytes));
+    if (!file) throw Exception(SourceContext{}, "Could not write {}", path);
+}
+
+}  // namespace
+
+ImageSequenceRecorder::ImageSequenceRecorder()
+    : Processor{}
+    , inport_{"inport", "Images to record, they are passed on unchanged"_help}
+    , outport_{"outport"}
+    , directory_{"directory", "Output Directory"}
+    , baseName_{"baseName", "File Name",
+                "Frames are written as <name>_00000.<ext>, <name>_00001.<ext>, ..."_help, "frame"}
+    , format_{"format",
+              "Format",
+              "PNG files, or the raw bytes of the first color layer"_help,
+              {{"png", "PNG", Format::PNG}, {"raw", "Raw", Format::Raw}}}
+    , queueSize_{"queueSize", "Queue Size",
+                 util::ordinalCount(size_t{16}, size_t{256})
+                     .set("Maximum number of frames waiting to be written"_help)}
+    , threads_{"threads", "Encoding Threads",
+               util::ordinalCount(size_t{2}, size_t{16})
+                   .set("Number of threads encoding frames in the background"_help)}
+    , overflow_{"overflow",
+                "When Full",
+                "What to do with a new frame when the queue is full"_help,
+                {{"drop", "Drop Frame", AsyncFrameWriter::Overflow::Drop},
+                 {"block", "Wait", AsyncFrameWriter::Overflow::Block}}}
+    , start_{"start", "Start Recording"}
+    , stop_{"stop", "Stop Recording"}
+    , stats_{"stats", "Statistics"}
+    , frames_{statProperty("frames", "Frames", "Frames recorded since the start"_help)}
+    , queueDepth_{statProperty("queueDepth", "Queue Depth", "Frames waiting to be written"_help)}
+    , written_{statProperty("written", "Written", "Frames written to disk"_help)}
+    , dropped_{statProperty("dropped", "Dropped", "Frames dropped because the queue was full"_help)}
+    , framesPerSecond_{rateProperty("framesPerSecond", "Frames / s",
+                                    "Encoding throughput in frames per second"_help)}
+    , megabytesPerSecond_{rateProperty("megabytesPerSecond", "MB / s",
+                                       "Encoding throughput in uncompressed MB per second"_help)}
+    , statsRefresh_{std::make_shared<StatsRefresh>(this)} {
+
+    addPorts(inport_, outport_);
+    addProperties(directory_, baseName_, format_, queueSize_, threads_, overflow_, start_, stop_,
+                  stats_);
+    stats_.addProperties(frames_, queueDepth_, written_, dropped_, framesPerSecond_,
+                         megabytesPerSecond_);
+
+    for (auto* prop : stats_.getProperties()) prop->setReadOnly(true);
+
+    start_.onChange([this]() { startRecording(); });
+    stop_.onChange([this]() { stopRecording(); });
+}
+
+void ImageSequenceRecorder::startRecording() {
+    stopRecording();
+
+    Target target{std::filesystem::path{directory_.get()}, baseName_.get(), format_.get()};
+    if (target.directory.empty()) {
+        throw Exception(SourceContext{}, "No output directory selected");
+    }
+    std::filesystem::create_directories(target.directory);
+
+    std::function<AsyncFrameWriter::Encoder()> makeEncoder;
+    if (target.format == Format::PNG) {
+        // Writers are created here since the factory is not meant to be used from other threads
+        makeEncoder = []() -> AsyncFrameWriter::Encoder {
+            std::shared_ptr<DataWriterType<Layer>> writer =
+                InviwoApplication::getPtr()
+                    ->getDataWriterFactory()
+                    ->getWriterForTypeAndExtension<Layer>(std::string_view{"png"});
+            if (!writer) throw Exception(SourceContext{}, "No PNG writer available");
+            writer->setOverwrite(Overwrite::Yes);
+            return [writer](std::shared_ptr<LayerRAM> frame, const std::filesystem::path& path) {
+                const Layer layer{frame};
+                writer->writeData(&layer, path);
+            };
+        };
+    } else {
+        makeEncoder = []() -> AsyncFrameWriter::Encoder {
+            return [](std::shared_ptr<LayerRAM> frame, const std::filesystem::path& path) {
+                writeRaw(*frame, path);
+            };
+        };
+    }
+
+    // The network may be idle while the queue drains, so the writer threads refresh the stats.
+    // Coalesce, only the first frame after the last refresh queues a new one
+    auto onWritten = [self = std::weak_ptr{statsRefresh_}]() {
+        if (auto r = self.lock(); !r || r->pending.exchange(true)) return;
+        dispatchFront([self]() {
+            if (auto r = self.lock()) {
+                r->pending = false;
+                if (r->owner->writer_) r->owner->updateStats();
+            }
+        });
+    };
+
+    writer_ = std::make_unique<AsyncFrameWriter>(queueSize_.get(), threads_.get(),
+                                                 overflow_.get(), makeEncoder, onWritten);
+    target_ = std::move(target);
+    frameIndex_ = 0;
+    updateStats();
+}
+
+void ImageSequenceRecorder::stopRecording() {
+    if (!writer_) return;
+    writer_->finish();
+    updateStats();
+    const auto stats = writer_->stats();
+    if (stats.failed > 0) {
+        log::warn("{} frames could not be written: {}", stats.failed, stats.lastError);
+    }
+    writer_.reset();
+}
+
+void ImageSequenceRecorder::process() {
+    const auto image = inport_.getData();
+    outport_.setData(image);
+
+    if (!writer_) return;
+
+    const auto* layer = image->getColorLayer();
+    if (!layer) return;
+
+    // The copy is the only cost on the network thread, encoding happens in the background
+    std::shared_ptr<LayerRAM> frame{layer->getRepresentation<LayerRAM>()->clone()};
+    const auto ext = target_.format == Format::PNG ? "png" : "raw";
+    auto path =
+        target_.directory / fmt::format("{}_{:05}.{}", target_.baseName, frameIndex_++, ext);
+
+    if (frameIndex_ == 1 && target_.format == Format::Raw) {
+        // Describe the layout once, the raw files only contain the pixel data
+        std::ofstream info{target_.directory / fmt::format("{}.txt", target_.baseName)};
+        info << fmt::format("Dimensions: {} {}\nFormat: {}\nBytes per frame: {}\n",
+                            frame->getDimensions().x, frame->getDimensions().y,
+                            frame->getDataFormat()->getString(), sizeInBytes(*frame));
+    }
+    writer_->push(std::move(frame), std::move(path));
+    updateStats();
+}
+
+void ImageSequenceRecorder::updateStats() {
+    const auto stats = writer_ ? writer_->stats() : AsyncFrameWriter::Stats{};
+    frames_.set(frameIndex_);
+    queueDepth_.set(stats.queueDepth);
+    written_.set(stats.written);
+    dropped_.set(stats.dropped);
+    framesPerSecond_.set(stats.framesPerSecond);
+    megabytesPerSecond_.set(stats.megabytesPerSecond);
+}
+
+}  // namespace inviwo
@@ -28,11 +28,14 @@
  *********************************************************************************/
 
 #include <inviwo/pythontools/pythontoolsmodule.h>
+#include <inviwo/pythontools/processors/imagesequencerecorder.h>
 
 namespace inviwo {
 
 PythonToolsModule::PythonToolsModule(InviwoApplication* app)
     : InviwoModule(app, "PythonTools")
-    , pythonFolderObserver_{app, getPath() / "processors", *this} {}
+    , pythonFolderObserver_{app, getPath() / "processors", *this} {
+    registerProcessor<ImageSequenceRecorder>();
+}
 
 }  // namespace inviwo
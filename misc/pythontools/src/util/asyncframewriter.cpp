@@ -0,0 +1,135 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/pythontools/util/asyncframewriter.h>
+#include <inviwo/core/datastructures/image/layerram.h>
+#include <inviwo/core/util/formats.h>
+
+#include <glm/gtx/component_wise.hpp>
+
+#include <algorithm>
+#include <exception>
+#include <utility>
+
+namespace inviwo {
+
+AsyncFrameWriter::AsyncFrameWriter(size_t capacity, size_t threads, Overflow overflow,
+                                   const std::function<Encoder()>& makeEncoder,
+                                   OnWritten onWritten)
+    : capacity_{std::max(capacity, size_t{1})}
+    , overflow_{overflow}
+    , onWritten_{std::move(onWritten)}
+    , start_{std::chrono::steady_clock::now()} {
+    for (size_t i = 0; i < std::max(threads, size_t{1}); ++i) {
+        threads_.emplace_back([this, encoder = makeEncoder()]() { work(encoder); });
+    }
+}
+
+AsyncFrameWriter::~AsyncFrameWriter() { finish(); }
+
+bool AsyncFrameWriter::push(std::shared_ptr<LayerRAM> frame, std::filesystem::path path) {
+    {
+        std::unique_lock lock{mutex_};
+        if (queue_.size() >= capacity_) {
+            if (overflow_ == Overflow::Drop || stopping_) {
+                ++dropped_;
+                return false;
+            }
+            notFull_.wait(lock, [&]() { return queue_.size() < capacity_ || stopping_; });
+            if (stopping_) {
+                ++dropped_;
+                return false;
+            }
+        }
+        queue_.push_back(Item{std::move(frame), std::move(path)});
+    }
+    notEmpty_.notify_one();
+    return true;
+}
+
+void AsyncFrameWriter::finish() {
+    {
+        std::scoped_lock lock{mutex_};
+        stopping_ = true;
+    }
+    notEmpty_.notify_all();
+    notFull_.notify_all();
+    for (auto& thread : threads_) {
+        if (thread.joinable()) thread.join();
+    }
+    threads_.clear();
+}
+
+AsyncFrameWriter::Stats AsyncFrameWriter::stats() const {
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start_;
+    const auto seconds = std::max(elapsed.count(), 1e-9);
+
+    Stats stats;
+    {
+        std::scoped_lock lock{mutex_};
+        stats.queueDepth = queue_.size();
+        stats.lastError = lastError_;
+    }
+    stats.written = written_.load();
+    stats.dropped = dropped_.load();
+    stats.failed = failed_.load();
+    stats.framesPerSecond = static_cast<double>(stats.written) / seconds;
+    stats.megabytesPerSecond = static_cast<double>(bytes_.load()) / (1024.0 * 1024.0) / seconds;
+    return stats;
+}
+
+void AsyncFrameWriter::work(Encoder encoder) {
+    while (true) {
+        Item item;
+        {
+            std::unique_lock lock{mutex_};
+            // Keep writing until the queue is empty, also after finish() was called
+            notEmpty_.wait(lock, [&]() { return !queue_.empty() || stopping_; });
+            if (queue_.empty()) return;
+            item = std::move(queue_.front());
+            queue_.pop_front();
+        }
+        notFull_.notify_one();
+
+        const auto bytes = glm::compMul(item.frame->getDimensions()) *
+                           item.frame->getDataFormat()->getSizeInBytes();
+        try {
+            encoder(item.frame, item.path);
+            ++written_;
+            bytes_ += bytes;
+        } catch (const std::exception& e) {
+            ++failed_;
+            std::scoped_lock lock{mutex_};
+            lastError_ = e.what();
+        }
+        if (onWritten_) onWritten_();
+    }
+}
+
+}  // namespace inviwo
@@ -0,0 +1,142 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <inviwo/pythontools/util/asyncframewriter.h>
+#include <inviwo/core/datastructures/image/layerramprecision.h>
+#include <inviwo/core/util/exception.h>
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <set>
+#include <thread>
+
+namespace inviwo {
+
+namespace {
+
+std::shared_ptr<LayerRAM> frame() {
+    return std::make_shared<LayerRAMPrecision<glm::u8vec4>>(size2_t{8, 8});
+}
+
+}  // namespace
+
+TEST(AsyncFrameWriter, BlockWritesAllFrames) {
+    std::mutex mutex;
+    std::set<std::filesystem::path> paths;
+    std::atomic<int> encoders{0};
+
+    {
+        AsyncFrameWriter writer{2, 3, AsyncFrameWriter::Overflow::Block, [&]() {
+                                    ++encoders;
+                                    return [&](std::shared_ptr<LayerRAM>,
+                                               const std::filesystem::path& path) {
+                                        std::this_thread::sleep_for(std::chrono::milliseconds{1});
+                                        std::scoped_lock lock{mutex};
+                                        paths.insert(path);
+                                    };
+                                }};
+        for (int i = 0; i < 50; ++i) {
+            EXPECT_TRUE(writer.push(frame(), std::to_string(i)));
+            EXPECT_LE(writer.stats().queueDepth, 2u);
+        }
+        writer.finish();
+
+        const auto stats = writer.stats();
+        EXPECT_EQ(stats.written, 50u);
+        EXPECT_EQ(stats.dropped, 0u);
+        EXPECT_EQ(stats.queueDepth, 0u);
+        EXPECT_GT(stats.framesPerSecond, 0.0);
+        EXPECT_GT(stats.megabytesPerSecond, 0.0);
+    }
+    EXPECT_EQ(encoders, 3);
+    EXPECT_EQ(paths.size(), 50u);
+}
+
+TEST(AsyncFrameWriter, DropWhenFull) {
+    std::atomic<bool> release{false};
+    AsyncFrameWriter writer{4, 1, AsyncFrameWriter::Overflow::Drop, [&]() {
+                                return [&](std::shared_ptr<LayerRAM>,
+                                           const std::filesystem::path&) {
+                                    while (!release) std::this_thread::yield();
+                                };
+                            }};
+
+    // One frame may be taken by the encoder, at most four more are queued
+    size_t accepted = 0;
+    for (int i = 0; i < 20; ++i) accepted += writer.push(frame(), std::to_string(i)) ? 1 : 0;
+    EXPECT_LE(accepted, 5u);
+    EXPECT_GE(accepted, 4u);
+    EXPECT_EQ(writer.stats().dropped, 20u - accepted);
+
+    release = true;
+    writer.finish();
+    EXPECT_EQ(writer.stats().written, accepted);
+}
+
+TEST(AsyncFrameWriter, ReportsErrors) {
+    AsyncFrameWriter writer{4, 1, AsyncFrameWriter::Overflow::Block, []() {
+                                return [](std::shared_ptr<LayerRAM>,
+                                          const std::filesystem::path&) {
+                                    throw Exception(SourceContext{}, "disk full");
+                                };
+                            }};
+    writer.push(frame(), "a");
+    writer.push(frame(), "b");
+    writer.finish();
+
+    const auto stats = writer.stats();
+    EXPECT_EQ(stats.written, 0u);
+    EXPECT_EQ(stats.failed, 2u);
+    EXPECT_NE(stats.lastError.find("disk full"), std::string::npos);
+}
+
+TEST(AsyncFrameWriter, NotifiesAfterEachFrame) {
+    std::atomic<size_t> notified{0};
+    AsyncFrameWriter writer{
+        4, 2, AsyncFrameWriter::Overflow::Block,
+        []() {
+            return [](std::shared_ptr<LayerRAM>, const std::filesystem::path& path) {
+                if (path == "bad") throw Exception(SourceContext{}, "disk full");
+            };
+        },
+        [&]() { ++notified; }};
+    for (int i = 0; i < 9; ++i) writer.push(frame(), std::to_string(i));
+    writer.push(frame(), "bad");
+    writer.finish();
+
+    EXPECT_EQ(notified, 10u);
+}
+
+}  // namespace inviwo
@@ -31,6 +31,7 @@
 
 #include <inviwo/vtk/vtkmoduledefine.h>
 #include <inviwo/core/processors/processor.h>
+#include <inviwo/core/properties/boolproperty.h>
 #include <inviwo/core/properties/ordinalproperty.h>
 #include <inviwo/core/properties/optionproperty.h>
 #include <inviwo/core/ports/imageport.h>
@@ -59,6 +60,7 @@ private:
     IntProperty layerIndex_;
 
     OrdinalProperty<dmat4> transform_;
+    BoolProperty shareMemory_;
 
     vtkSmartPointer<vtkImageData> data_;
 };
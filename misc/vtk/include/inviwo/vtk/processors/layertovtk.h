@@ -32,6 +32,7 @@
 #include <inviwo/vtk/vtkmoduledefine.h>
 #include <inviwo/core/processors/processor.h>
 #include <inviwo/core/ports/layerport.h>
+#include <inviwo/core/properties/boolproperty.h>
 
 #include <inviwo/vtk/ports/vtkoutport.h>
 #include <vtkImageData.h>
@@ -52,6 +53,7 @@ public:
 private:
     LayerInport inport_;
     vtk::VtkOutport outport_;
+    BoolProperty shareMemory_;
 
     vtkSmartPointer<vtkImageData> data_;
 };
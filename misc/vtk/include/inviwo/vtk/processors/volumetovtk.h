@@ -32,6 +32,7 @@
 #include <inviwo/vtk/vtkmoduledefine.h>
 #include <inviwo/core/processors/processor.h>
 #include <inviwo/core/ports/volumeport.h>
+#include <inviwo/core/properties/boolproperty.h>
 #include <inviwo/core/properties/optionproperty.h>
 
 #include <inviwo/vtk/ports/vtkoutport.h>
@@ -58,6 +59,7 @@ private:
     vtk::VtkOutport outport_;
     enum class Space { Data, Model };
     OptionProperty<Space> space_;
+    BoolProperty shareMemory_;
 
     vtkSmartPointer<vtkImageData> data_;
     std::vector<vtkSmartPointer<vtkDataArray>> volumeData_;
@@ -33,17 +33,35 @@
 #include <inviwo/core/processors/processor.h>
 #include <inviwo/core/properties/directoryproperty.h>
 #include <inviwo/core/properties/optionproperty.h>
+#include <inviwo/core/properties/boolproperty.h>
+#include <inviwo/core/properties/ordinalproperty.h>
+#include <inviwo/core/properties/stringproperty.h>
 #include <inviwo/core/network/processornetworkevaluationobserver.h>
 #include <modules/base/processors/filecache.h>
 
 #include <inviwo/vtk/ports/vtkoutport.h>
 #include <inviwo/vtk/ports/vtkinport.h>
+#include <inviwo/vtk/util/vtkfiltercache.h>
+
+#include <chrono>
+#include <future>
+#include <mutex>
+#include <string>
+#include <unordered_map>
 
 namespace inviwo {
 
+/**
+ * A file cache for vtk data. Cached data is kept in RAM up to a byte budget, the least recently
+ * used data is evicted and reloaded from the cache directory when needed again. Files can be
+ * written in the background (write-behind) and with compressed binary appended data.
+ */
 class IVW_MODULE_VTK_API VTKFileCache : public CacheBase {
 public:
+    enum class Compression { None, LZ4, ZLib, LZMA };
+
     explicit VTKFileCache();
+    virtual ~VTKFileCache();
 
     virtual void process() override;
 
@@ -52,17 +70,36 @@ public:
 
 private:
     void castAndSetOutportData(vtkDataObject* data);
+    void write(vtkDataObject* data, const std::filesystem::path& path, Compression compression);
+    void waitForWrite(const std::string& key);
+    void finishWrites();
+    void updateStats();
 
     std::optional<std::filesystem::path> pathForKey(std::string_view key);
     virtual bool hasCache(std::string_view key) override;
     const std::string& loadedKey() const override { return loadedKey_; }
 
     OptionPropertyInt outportType_;
+    BoolProperty asyncWrite_;
+    OptionProperty<Compression> compression_;
+    IntSizeTProperty ramBudget_;  ///< In MB
+    StringProperty stats_;
 
     vtk::VtkInport inport_;
     vtk::VtkOutport outport_;
 
-    RAMCache<vtkSmartPointer<vtkDataObject>> ram_;
+    vtk::FilterCache ram_;
+
+    struct IOStats {
+        size_t ramHits = 0;
+        size_t diskHits = 0;
+        size_t misses = 0;
+        std::chrono::duration<double> lastRead{0};
+        std::chrono::duration<double> lastWrite{0};
+    };
+    std::mutex ioMutex_;
+    IOStats ioStats_;
+    std::unordered_map<std::string, std::shared_future<void>> pendingWrites_;
 
     std::string loadedKey_;
 };
@@ -30,14 +30,20 @@
 #pragma once
 
 #include <inviwo/vtk/vtkmoduledefine.h>
+#include <inviwo/vtk/vtkmodule.h>
+#include <inviwo/vtk/util/vtkfiltercache.h>
 #include <inviwo/core/common/inviwoapplication.h>
+#include <inviwo/core/io/serialization/serializer.h>
 #include <inviwo/core/network/processornetwork.h>
-#include <inviwo/core/processors/processor.h>
+#include <inviwo/core/processors/poolprocessor.h>
 #include <inviwo/core/properties/property.h>
+#include <inviwo/core/properties/boolproperty.h>
 #include <inviwo/core/properties/optionproperty.h>
 #include <inviwo/core/properties/compositeproperty.h>
+#include <inviwo/core/properties/stringproperty.h>
 #include <inviwo/core/util/foreacharg.h>
 #include <inviwo/core/util/zip.h>
+#include <inviwo/core/util/moduleutils.h>
 #include <inviwo/core/util/utilities.h>
 #include <inviwo/core/util/rendercontext.h>
 #include <inviwo/core/algorithm/markdown.h>
@@ -45,9 +51,16 @@
 #include <inviwo/vtk/ports/vtkinport.h>
 #include <inviwo/vtk/ports/vtkoutport.h>
 
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <string_view>
 #include <tuple>
 #include <optional>
 #include <type_traits>
+#include <vector>
 
 #include <fmt/format.h>
 
@@ -166,11 +179,38 @@ void setupFieldSelection(Inport* inport, auto& wrapper) {
 }
 /**
  * @brief A Wrapper for all VTK filters
+ *
+ * By default the filter is updated synchronously in process(). If "Run in Background" is enabled
+ * the filter is instead configured on the calling thread and updated on the thread pool using a
+ * separate filter instance and shallow copies of the inputs. A job that is superseded by new
+ * input or property changes is aborted using vtkAlgorithm::SetAbortExecute, and the outputs of a
+ * finished job are published to all outports at once.
+ *
+ * If "Cache Outputs" is enabled, outputs are memoized in the vtk::FilterCache of the VTKModule,
+ * keyed by the filter, the serialized filter properties and the identity and modification time of
+ * the input data. Filters without inputs, i.e. sources and readers, are not cached since their
+ * output can depend on external state.
  */
 template <typename VTKFilter>
-class VTKGenericProcessor : public Processor {
+class VTKGenericProcessor : public PoolProcessor {
 public:
-    VTKGenericProcessor() : Processor() {
+    VTKGenericProcessor()
+        : PoolProcessor()
+        , runInBackground_{"runInBackground", "Run in Background",
+                           "Update the VTK filter on the thread pool instead of blocking the "
+                           "network evaluation. Outdated updates are aborted."_help,
+                           false, InvalidationLevel::Valid}
+        , cacheOutputs_{"cacheOutputs", "Cache Outputs",
+                        "Keep the outputs in the filter output cache, such that going back to a "
+                        "previously used state does not rerun the filter"_help,
+                        false}
+        , cacheInfo_{"cacheInfo", "Output Cache",
+                     "Whether the last output was taken from the filter output cache"_help, "",
+                     InvalidationLevel::Valid}
+        , cache_{[]() -> vtk::FilterCache* {
+            if (auto* module = util::getModuleByType<VTKModule>()) return &module->filterCache;
+            return nullptr;
+        }()} {
         observer_ = vtkSmartPointer<Command>::Take(Command::New());
 
         observer_->callback = [this](vtkObject*, unsigned long eid, void* data) {
@@ -198,6 +238,11 @@ public:
 
         createOutports();
 
+        addProperties(runInBackground_, cacheOutputs_, cacheInfo_);
+        cacheInfo_.visibilityDependsOn(cacheOutputs_, [](const auto& p) { return p.get(); });
+        cacheInfo_.setReadOnly(true);
+        cacheInfo_.setSerializationMode(PropertySerializationMode::None);
+
         std::unordered_map<std::string_view, CompositeProperty*> groupMap;
         for (auto&& group : traits_.groups) {
             auto comp = std::make_unique<CompositeProperty>(
@@ -265,55 +310,227 @@ public:
             }
         }
     }
-    virtual ~VTKGenericProcessor() = default;
+    virtual ~VTKGenericProcessor() { abortRunning(); }
 
     virtual void process() override {
-        bool ready = true;
-        util::for_each_in_tuple([&](auto& wrapper) { ready &= wrapper.set(*filter_); },
-                                traits_.properties);
+        std::optional<std::string> key;
+        if (cacheOutputs_ && cache_ && cache_->isEnabled() && !getInports().empty() &&
+            !getOutports().empty()) {
+            key = cacheKey();
+            if (auto outputs = cache_->get(*key)) {
+                abortRunning();
+                setOutputs(*outputs);
+                updateCacheInfo("Hit");
+                return;
+            }
+        }
+
+        if (runInBackground_) {
+            processInBackground(key);
+        } else {
+            processNow(key);
+        }
+    }
 
-        if (!ready) return;
+    virtual const ProcessorInfo& getProcessorInfo() const override;
 
-        notifyObserversProgressChanged(this, 0.0);
+    static const ProcessorInfo processorInfo_;
 
-        const auto nInputs = filter_->GetNumberOfInputPorts();
-        const auto nOutputs = filter_->GetNumberOfOutputPorts();
+protected:
+    /**
+     * Apply all property wrappers and the current inport data to @p filter. If @p copyInputs is
+     * true the inputs are shallow copied such that the filter does not share pipeline information
+     * with the data of the inports. Returns false if any wrapper is not ready.
+     */
+    bool configure(VTKFilter& filter, bool copyInputs) {
+        bool ready = true;
+        util::for_each_in_tuple([&](auto& wrapper) { ready &= wrapper.set(filter); },
+                                traits_.properties);
+        if (!ready) return false;
+
+        auto input = [&](vtkDataObject* data) -> vtkSmartPointer<vtkDataObject> {
+            if (!copyInputs || !data) return data;
+            auto copy = vtkSmartPointer<vtkDataObject>::Take(data->NewInstance());
+            copy->ShallowCopy(data);
+            return copy;
+        };
 
+        const auto nInputs = filter.GetNumberOfInputPorts();
         for (int i = 0; i < nInputs; ++i) {
             auto* inport = static_cast<vtk::VtkInport*>(getInports()[i]);
             if (inport->isOptional() && !inport->hasData()) {
-                filter_->SetInputDataObject(i, nullptr);
+                filter.SetInputDataObject(i, nullptr);
             } else {
-                filter_->SetInputDataObject(i, inport->getData());
+                filter.SetInputDataObject(i, input(inport->getData()));
                 for (size_t p = 1; p < inport->getNumberOfConnections(); ++p) {
-                    filter_->AddInputDataObject(i, inport->getData());
+                    filter.AddInputDataObject(i, input(inport->getData()));
                 }
             }
         }
+        return true;
+    }
 
-        if (filter_->GetExecutive()->Update() != 1) {
-            for (int i = 0; i < nOutputs; ++i) {
-                static_cast<vtk::VtkOutport*>(getOutports()[i])->setData(nullptr);
+    /**
+     * The key used to look up the outputs in the filter cache. Combines the filter, the serialized
+     * state of the filter properties and the identity and modification time of the input data.
+     */
+    std::string cacheKey() const {
+        Serializer serializer{""};
+        util::for_each_in_tuple(
+            [&](auto& wrapper) {
+                serializer.serialize(wrapper.property.getIdentifier(), wrapper.property);
+            },
+            traits_.properties);
+        std::stringstream ss;
+        serializer.write(ss);
+
+        std::string key{VTKTraits<VTKFilter>::uri};
+        for (auto* inport : getInports()) {
+            fmt::format_to(std::back_inserter(key), "\n{}:", inport->getNumberOfConnections());
+            if (auto* data = static_cast<vtk::VtkInport*>(inport)->getData()) {
+                fmt::format_to(std::back_inserter(key), " {}@{}", static_cast<const void*>(data),
+                               data->GetMTime());
             }
+        }
+        key += '\n';
+        key += std::move(ss).str();
+        return key;
+    }
+
+    void updateCacheInfo(std::string_view status) {
+        if (cache_) {
+            cacheInfo_.set(fmt::format("{}: {}", status, cache_->getStats().toString()));
+        }
+    }
+
+    void abortRunning() {
+        if (running_) running_->SetAbortExecute(1);
+        running_ = nullptr;
+    }
+
+    void setOutputs(const std::vector<vtkSmartPointer<vtkDataObject>>& outputs) {
+        for (auto&& [port, data] : util::zip(getOutports(), outputs)) {
+            static_cast<vtk::VtkOutport*>(port)->setData(data);
+        }
+    }
+
+    void processNow(std::optional<std::string> key) {
+        if (!configure(*filter_, false)) return;
+
+        notifyObserversProgressChanged(this, 0.0);
+
+        const auto nOutputs = filter_->GetNumberOfOutputPorts();
+        const auto status = [&]() {
+            const auto scope = executionScope()(filter_);
+            return filter_->GetExecutive()->Update();
+        }();
+        if (status != 1) {
+            setOutputs(std::vector<vtkSmartPointer<vtkDataObject>>(nOutputs));
             throw Exception(SourceContext{}, "Error running vtk filter");
         }
 
+        std::vector<vtkSmartPointer<vtkDataObject>> outputs(nOutputs);
         for (int i = 0; i < nOutputs; ++i) {
-            if (auto result = filter_->GetOutputDataObject(i)) {
-                static_cast<vtk::VtkOutport*>(getOutports()[i])->setData(result);
-            } else {
-                static_cast<vtk::VtkOutport*>(getOutports()[i])->setData(nullptr);
+            outputs[i] = filter_->GetOutputDataObject(i);
+        }
+        if (key) {
+            // The filter reuses its output objects, so cache shallow copies
+            for (auto& output : outputs) {
+                if (!output) continue;
+                auto copy = vtkSmartPointer<vtkDataObject>::Take(output->NewInstance());
+                copy->ShallowCopy(output);
+                output = copy;
             }
+            cache_->add(*key, outputs);
+            updateCacheInfo("Miss");
         }
+        setOutputs(outputs);
 
         notifyObserversProgressChanged(this, std::nullopt);
     }
 
-    virtual const ProcessorInfo& getProcessorInfo() const override;
+    void processInBackground(std::optional<std::string> key) {
+        // Whatever is still running is outdated now
+        abortRunning();
+
+        auto filter = vtkSmartPointer<VTKFilter>::New();
+        if (!configure(*filter, true)) return;
+        running_ = filter;
+
+        using Result = std::optional<std::vector<vtkSmartPointer<vtkDataObject>>>;
+        const auto calc = [filter, scope = executionScope()](pool::Stop stop,
+                                                             pool::Progress progress) -> Result {
+            auto observer = vtkSmartPointer<Command>::Take(Command::New());
+            observer->callback = [&](vtkObject* caller, unsigned long eid, void* data) {
+                if (eid == vtkCommand::ErrorEvent) {
+                    log::report(LogLevel::Error, static_cast<const char*>(data));
+                } else if (eid == vtkCommand::WarningEvent) {
+                    log::report(LogLevel::Warn, static_cast<const char*>(data));
+                } else if (eid == vtkCommand::MessageEvent || eid == vtkCommand::TextEvent) {
+                    log::report(LogLevel::Info, static_cast<const char*>(data));
+                } else if (eid == vtkCommand::ProgressEvent) {
+                    if (stop()) {
+                        static_cast<vtkAlgorithm*>(caller)->SetAbortExecute(1);
+                    }
+                    progress(static_cast<float>(*static_cast<double*>(data)));
+                }
+            };
+            for (auto eid : {vtkCommand::ErrorEvent, vtkCommand::WarningEvent,
+                             vtkCommand::MessageEvent, vtkCommand::TextEvent,
+                             vtkCommand::ProgressEvent}) {
+                filter->AddObserver(eid, observer);
+            }
 
-    static const ProcessorInfo processorInfo_;
+            const auto status = [&]() {
+                const auto lease = scope(filter);
+                return filter->GetExecutive()->Update();
+            }();
+            filter->RemoveObserver(observer);
+
+            if (stop() || filter->GetAbortExecute()) return std::nullopt;
+            if (status != 1) {
+                throw Exception(SourceContext{}, "Error running vtk filter");
+            }
+
+            std::vector<vtkSmartPointer<vtkDataObject>> outputs(filter->GetNumberOfOutputPorts());
+            for (int i = 0; i < filter->GetNumberOfOutputPorts(); ++i) {
+                outputs[i] = filter->GetOutputDataObject(i);
+            }
+            return outputs;
+        };
+
+        dispatchOne(calc, [this, filter, key = std::move(key)](Result result) {
+            if (running_ != filter) return;
+            running_ = nullptr;
+            if (!result) return;
+            if (key) {
+                cache_->add(*key, *result);
+                updateCacheInfo("Miss");
+            }
+            setOutputs(*result);
+            newResults();
+        });
+    }
+
+    /**
+     * Returns a function to call right before updating a filter, the returned object is held
+     * until the update has finished. Used by e.g. TTK filters to lease threads from a shared
+     * budget. Does nothing unless the VTKTraits provide an <tt>executionScopeFunc</tt>.
+     */
+    std::function<std::shared_ptr<void>(vtkAlgorithm*)> executionScope() const {
+        if constexpr (requires {
+                          traits_.executionScopeFunc;
+                          requires std::invocable<decltype(traits_.executionScopeFunc),
+                                                  vtkAlgorithm*, std::string_view>;
+                      }) {
+            return [func = traits_.executionScopeFunc](vtkAlgorithm* filter) {
+                return func(filter, VTKTraits<VTKFilter>::identifier);
+            };
+        } else {
+            return [](vtkAlgorithm*) { return std::shared_ptr<void>{}; };
+        }
+    }
 
-protected:
     vtk::VtkInport::Optional isPortOptional(int portNumber) const {
         if (vtkInformation* info = filter_->GetInputPortInformation(portNumber)) {
             if (info && info->Has(vtkAlgorithm::INPUT_IS_OPTIONAL())) {
@@ -369,6 +586,11 @@ protected:
     vtkNew<VTKFilter> filter_;
     VTKTraits<VTKFilter> traits_;
     vtkSmartPointer<Command> observer_;
+    BoolProperty runInBackground_;
+    BoolProperty cacheOutputs_;
+    StringProperty cacheInfo_;
+    vtk::FilterCache* cache_;
+    vtkSmartPointer<VTKFilter> running_;
 };
 
 }  // namespace vtkwrapper
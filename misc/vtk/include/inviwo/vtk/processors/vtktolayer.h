@@ -32,6 +32,7 @@
 #include <inviwo/vtk/vtkmoduledefine.h>
 #include <inviwo/core/processors/processor.h>
 #include <inviwo/core/properties/optionproperty.h>
+#include <inviwo/core/properties/stringproperty.h>
 #include <inviwo/core/ports/layerport.h>
 #include <modules/base/properties/layerinformationproperty.h>
 #include <modules/base/properties/basisproperty.h>
@@ -60,6 +61,7 @@ private:
 
     OptionPropertyInt source_;
     OptionPropertyInt precision_;
+    StringProperty transfer_;
 
     LayerInformationProperty information_;
     BasisProperty basis_;
@@ -33,6 +33,7 @@
 #include <inviwo/core/processors/processor.h>
 #include <inviwo/core/ports/volumeport.h>
 #include <inviwo/core/properties/optionproperty.h>
+#include <inviwo/core/properties/stringproperty.h>
 #include <modules/base/properties/volumeinformationproperty.h>
 #include <modules/base/properties/basisproperty.h>
 
@@ -61,6 +62,7 @@ private:
 
     OptionPropertyInt source_;
     OptionPropertyInt precision_;
+    StringProperty transfer_;
 
     VolumeInformationProperty information_;
     BasisProperty basis_;
@@ -244,10 +244,23 @@ std::shared_ptr<VolumeRAM> arrayToVolumeRAM(size3_t dimensions, vtkDataArray* ar
     return ram;
 }
 
+struct TransferReport;
+
+/**
+ * Creates a Layer from the point data array \p arrayIndex of \p vtkImage.
+ * @param report optional, set to describe whether the data was shared or copied
+ */
 IVW_MODULE_VTK_API std::shared_ptr<Layer> vtkImageDataToLayer(vtkImageData* vtkImage,
-                                                              int arrayIndex, int precision);
+                                                              int arrayIndex, int precision,
+                                                              TransferReport* report = nullptr);
+/**
+ * Creates a Volume from the point data array \p arrayIndex of \p vtkImage. The volume refers to
+ * the memory of the VTK array if possible, @see toVolumeRAM
+ * @param report optional, set to describe whether the data was shared or copied
+ */
 IVW_MODULE_VTK_API std::shared_ptr<Volume> vtkImageDataToVolume(vtkImageData* vtkImage,
-                                                                int arrayIndex, int precision);
+                                                                int arrayIndex, int precision,
+                                                                TransferReport* report = nullptr);
 
 }  // namespace vtk
 
@@ -0,0 +1,127 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <inviwo/vtk/vtkmoduledefine.h>
+
+#include <cstddef>
+#include <list>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <vtkSmartPointer.h>
+
+class vtkDataObject;
+
+namespace inviwo {
+
+namespace vtk {
+
+/**
+ * A memoization cache for the outputs of VTK filters. Entries are looked up by a key that
+ * identifies the filter, its parameters and its inputs, see VTKGenericProcessor. The full key is
+ * stored and compared on lookup, hence different keys never share an entry. The least
+ * recently used entries are evicted once the memory of the cached outputs, as reported by
+ * vtkDataObject::GetActualMemorySize, exceeds the byte budget. All functions are thread safe.
+ */
+class IVW_MODULE_VTK_API FilterCache {
+public:
+    using Outputs = std::vector<vtkSmartPointer<vtkDataObject>>;
+
+    struct IVW_MODULE_VTK_API Stats {
+        size_t hits = 0;
+        size_t misses = 0;
+        size_t evictions = 0;
+        size_t entries = 0;
+        size_t bytes = 0;
+        size_t byteBudget = 0;
+
+        std::string toString() const;
+    };
+
+    explicit FilterCache(size_t byteBudget = size_t{512} << 20);
+
+    /**
+     * Look up the outputs stored for @p key and mark them as most recently used. Counts as a hit
+     * if found. Returns std::nullopt if not found or if the cache is disabled.
+     */
+    std::optional<Outputs> get(std::string_view key);
+
+    /**
+     * Store @p outputs for @p key, replacing any previous entry. Counts as a miss, since the
+     * outputs had to be computed. Outputs larger than the byte budget are not stored. The outputs
+     * must not be modified after being added.
+     */
+    void add(std::string_view key, Outputs outputs);
+
+    /// Check if there is an entry for @p key without affecting the order or the statistics
+    bool has(std::string_view key) const;
+
+    /// Remove the entry for @p key, if any
+    void remove(std::string_view key);
+
+    void setEnabled(bool enabled);
+    bool isEnabled() const;
+
+    void setByteBudget(size_t byteBudget);
+    size_t getByteBudget() const;
+
+    /// Remove all entries and reset the statistics
+    void clear();
+
+    Stats getStats() const;
+
+    /// The total memory of @p outputs in bytes, data shared between the outputs is counted twice
+    static size_t memorySize(const Outputs& outputs);
+
+private:
+    struct Entry {
+        std::string key;
+        Outputs outputs;
+        size_t bytes;
+    };
+
+    void evict(size_t byteBudget);
+    void erase(std::string_view key);
+
+    mutable std::mutex mutex_;
+    bool enabled_ = true;
+    std::list<Entry> lru_;  // most recently used first
+    std::unordered_map<std::string_view, std::list<Entry>::iterator> entries_;  // keys in lru_
+    Stats stats_;
+};
+
+}  // namespace vtk
+
+}  // namespace inviwo
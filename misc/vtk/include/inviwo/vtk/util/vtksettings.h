@@ -33,6 +33,9 @@
 #include <inviwo/core/util/settings/settings.h>
 #include <inviwo/core/properties/optionproperty.h>
 #include <inviwo/core/properties/boolproperty.h>
+#include <inviwo/core/properties/buttonproperty.h>
+#include <inviwo/core/properties/compositeproperty.h>
+#include <inviwo/core/properties/ordinalproperty.h>
 
 #include <vtkLogger.h>
 
@@ -44,6 +47,11 @@ public:
 
     BoolProperty globalWarningDisplay;
     OptionProperty<vtkLogger::Verbosity> verbosity;
+
+    CompositeProperty filterCache;
+    BoolProperty filterCacheEnabled;
+    IntSizeTProperty filterCacheSize;  ///< In MB
+    ButtonProperty clearFilterCache;
 };
 
 }  // namespace inviwo
@@ -0,0 +1,177 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+#pragma once
+
+#include <inviwo/vtk/vtkmoduledefine.h>
+
+#include <inviwo/core/util/glm.h>
+#include <inviwo/core/util/formats.h>
+
+#include <memory>
+#include <string>
+
+#include <vtkSmartPointer.h>
+
+class vtkDataArray;
+
+namespace inviwo {
+
+class Volume;
+class VolumeRAM;
+class Layer;
+class LayerRAM;
+class BufferBase;
+
+namespace vtk {
+
+/**
+ * Describes how data was transferred between Inviwo and VTK. Data is either shared, i.e. both
+ * sides refer to the same memory, or copied because the layout or type differs.
+ */
+struct IVW_MODULE_VTK_API TransferReport {
+    enum class Mode { Shared, Copied };
+
+    Mode mode = Mode::Shared;
+    /// Number of bytes that were shared or copied
+    size_t bytes = 0;
+    /// The reason why the data had to be copied, empty if shared
+    std::string reason;
+
+    void shared(size_t numBytes);
+    void copied(size_t numBytes, std::string_view why);
+
+    std::string toString() const;
+};
+
+/**
+ * Returns the VTK data type, i.e. VTK_FLOAT, VTK_INT, ..., for the components of \p format.
+ * @throw Exception if there is no matching VTK type
+ */
+IVW_MODULE_VTK_API int toVTKType(const DataFormatBase* format);
+
+/**
+ * Returns true if \p array stores its values contiguously as array-of-structs, i.e. it is a
+ * vtkAOSDataArrayTemplate, and its memory can be shared without conversion.
+ */
+IVW_MODULE_VTK_API bool isContiguous(vtkDataArray* array);
+
+/**
+ * Creates a VTK data array which refers to \p data without copying it. The array keeps a
+ * reference to \p owner until VTK releases the array, \p owner has to keep \p data alive.
+ * VTK has no read only arrays, any filter writing to the array in place writes to the Inviwo
+ * data. Only share data with consumers that leave their input unchanged, otherwise use
+ * copyToVTK.
+ *
+ * @param data     pointer to the first element
+ * @param format   data format of each element, each component maps to a VTK component
+ * @param size     number of elements
+ * @param owner    keeps \p data alive while the VTK array exists
+ * @throw Exception if the format cannot be mapped to VTK
+ */
+IVW_MODULE_VTK_API vtkSmartPointer<vtkDataArray> shareWithVTK(const void* data,
+                                                              const DataFormatBase* format,
+                                                              size_t size,
+                                                              std::shared_ptr<const void> owner);
+
+/**
+ * Creates a VTK data array which refers to the VolumeRAM representation of \p volume without
+ * copying, @see shareWithVTK
+ */
+IVW_MODULE_VTK_API vtkSmartPointer<vtkDataArray> shareWithVTK(std::shared_ptr<const Volume> volume,
+                                                              TransferReport* report = nullptr);
+
+/**
+ * Creates a VTK data array which refers to the LayerRAM representation of \p layer without
+ * copying. The \p owner has to keep the layer alive, for example the Image holding the layer.
+ * @see shareWithVTK
+ */
+IVW_MODULE_VTK_API vtkSmartPointer<vtkDataArray> shareWithVTK(const Layer& layer,
+                                                              std::shared_ptr<const void> owner,
+                                                              TransferReport* report = nullptr);
+
+/**
+ * Creates a VTK data array holding a copy of \p data, @see shareWithVTK
+ *
+ * @param data     pointer to the first element
+ * @param format   data format of each element, each component maps to a VTK component
+ * @param size     number of elements
+ * @throw Exception if the format cannot be mapped to VTK
+ */
+IVW_MODULE_VTK_API vtkSmartPointer<vtkDataArray> copyToVTK(const void* data,
+                                                           const DataFormatBase* format,
+                                                           size_t size);
+
+/**
+ * Creates a VTK data array holding a copy of the VolumeRAM representation of \p volume
+ */
+IVW_MODULE_VTK_API vtkSmartPointer<vtkDataArray> copyToVTK(const Volume& volume,
+                                                           TransferReport* report = nullptr);
+
+/**
+ * Creates a VTK data array holding a copy of the LayerRAM representation of \p layer
+ */
+IVW_MODULE_VTK_API vtkSmartPointer<vtkDataArray> copyToVTK(const Layer& layer,
+                                                           TransferReport* report = nullptr);
+
+/**
+ * Creates a VolumeRAM representation of \p dimensions from the values of \p array. If \p array
+ * is contiguous and its type has a matching Inviwo DataFormat and \p precision is either zero or
+ * matches the precision of the array, the representation refers to the memory of the VTK array
+ * and keeps a reference to it. Otherwise, the values are converted to a new representation with
+ * the requested precision.
+ *
+ * @param dimensions dimensions of the volume, has to match the number of tuples of \p array
+ * @param array      source array
+ * @param precision  requested precision in bits of each component, zero for same as input
+ * @param report     optional, set to describe whether the data was shared or copied
+ */
+IVW_MODULE_VTK_API std::shared_ptr<VolumeRAM> toVolumeRAM(size3_t dimensions, vtkDataArray* array,
+                                                          int precision = 0,
+                                                          TransferReport* report = nullptr);
+
+/**
+ * Creates a LayerRAM representation of \p dimensions from the values of \p array. Layer
+ * representations cannot refer to external memory, hence the data is always copied. If
+ * \p array is contiguous and no precision change is requested, the values are copied in bulk.
+ * @see toVolumeRAM
+ */
+IVW_MODULE_VTK_API std::shared_ptr<LayerRAM> toLayerRAM(size2_t dimensions, vtkDataArray* array,
+                                                        int precision = 0,
+                                                        TransferReport* report = nullptr);
+
+/**
+ * Creates a Buffer from the values of \p array. Buffers own their data, hence the data is always
+ * copied. If \p array is contiguous, the values are copied in bulk.
+ */
+IVW_MODULE_VTK_API std::shared_ptr<BufferBase> toBuffer(vtkDataArray* array,
+                                                        TransferReport* report = nullptr);
+
+}  // namespace vtk
+
+}  // namespace inviwo
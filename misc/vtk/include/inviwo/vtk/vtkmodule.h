@@ -31,6 +31,7 @@
 #include <inviwo/vtk/vtkmoduledefine.h>
 #include <inviwo/core/common/inviwomodule.h>
 #include <inviwo/vtk/util/vtksettings.h>
+#include <inviwo/vtk/util/vtkfiltercache.h>
 
 namespace inviwo {
 
@@ -40,6 +41,7 @@ public:
     virtual ~VTKModule() = default;
 
     VTKSettings settings;
+    vtk::FilterCache filterCache;
 };
 
 }  // namespace inviwo
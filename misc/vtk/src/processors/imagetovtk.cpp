@@ -35,6 +35,7 @@
 #include <inviwo/core/datastructures/image/layerram.h>
 
 #include <inviwo/core/util/glm.h>
+#include <inviwo/vtk/util/vtksharing.h>
 
 #include <vtkImageData.h>
 #include <vtkPointData.h>
@@ -90,10 +91,15 @@ ImageToVTK::ImageToVTK()
                   {0, ConstraintBehavior::Mutable}
 
       }
-    , transform_{"transform", "Transform", transformState<dmat4>()} {
+    , transform_{"transform", "Transform", transformState<dmat4>()}
+    , shareMemory_{"shareMemory", "Share Memory",
+                   "Let the VTK arrays refer to the layer data instead of copying it. VTK has no "
+                   "read only arrays, only enable this if no downstream filter modifies its input "
+                   "in place since that would change the Inviwo data as well."_help,
+                   false} {
 
     addPorts(inport_, outport_);
-    addProperties(layer_, layerIndex_);
+    addProperties(layer_, layerIndex_, shareMemory_);
 
     inport_.onChange([&]() {
         int layers = static_cast<int>(inport_.getData()->getNumberOfColorLayers());
@@ -124,106 +130,10 @@ void ImageToVTK::process() {
     data_->SetOrigin(glm::value_ptr(offset));
     data_->SetDirectionMatrix(glm::value_ptr(direction));
 
-    const auto vtkType = [&]() {
-        switch (layer->getDataFormat()->getId()) {
-            case DataFormatId::Int8:
-            case DataFormatId::Vec2Int8:
-            case DataFormatId::Vec3Int8:
-            case DataFormatId::Vec4Int8: {
-                return VTK_CHAR;
-            }
-            case DataFormatId::UInt8:
-                [[fallthrough]];
-            case DataFormatId::Vec2UInt8:
-                [[fallthrough]];
-            case DataFormatId::Vec3UInt8:
-                [[fallthrough]];
-            case DataFormatId::Vec4UInt8: {
-                return VTK_UNSIGNED_CHAR;
-            }
-            case DataFormatId::Int16:
-                [[fallthrough]];
-            case DataFormatId::Vec2Int16:
-                [[fallthrough]];
-            case DataFormatId::Vec3Int16:
-                [[fallthrough]];
-            case DataFormatId::Vec4Int16: {
-                return VTK_SHORT;
-            }
-            case DataFormatId::UInt16:
-                [[fallthrough]];
-            case DataFormatId::Vec2UInt16:
-                [[fallthrough]];
-            case DataFormatId::Vec3UInt16:
-                [[fallthrough]];
-            case DataFormatId::Vec4UInt16: {
-                return VTK_UNSIGNED_SHORT;
-            }
-            case DataFormatId::Int32:
-                [[fallthrough]];
-            case DataFormatId::Vec2Int32:
-                [[fallthrough]];
-            case DataFormatId::Vec3Int32:
-                [[fallthrough]];
-            case DataFormatId::Vec4Int32: {
-                return VTK_INT;
-            }
-            case DataFormatId::UInt32:
-                [[fallthrough]];
-            case DataFormatId::Vec2UInt32:
-                [[fallthrough]];
-            case DataFormatId::Vec3UInt32:
-                [[fallthrough]];
-            case DataFormatId::Vec4UInt32: {
-                return VTK_UNSIGNED_INT;
-            }
-            case DataFormatId::Int64:
-                [[fallthrough]];
-            case DataFormatId::Vec2Int64:
-                [[fallthrough]];
-            case DataFormatId::Vec3Int64:
-                [[fallthrough]];
-            case DataFormatId::Vec4Int64: {
-                return VTK_LONG;
-            }
-            case DataFormatId::UInt64:
-                [[fallthrough]];
-            case DataFormatId::Vec2UInt64:
-                [[fallthrough]];
-            case DataFormatId::Vec3UInt64:
-                [[fallthrough]];
-            case DataFormatId::Vec4UInt64: {
-                return VTK_UNSIGNED_LONG;
-            }
-            case DataFormatId::Float32:
-                [[fallthrough]];
-            case DataFormatId::Vec2Float32:
-                [[fallthrough]];
-            case DataFormatId::Vec3Float32:
-                [[fallthrough]];
-            case DataFormatId::Vec4Float32: {
-                return VTK_FLOAT;
-            }
-            case DataFormatId::Float64:
-                [[fallthrough]];
-            case DataFormatId::Vec2Float64:
-                [[fallthrough]];
-            case DataFormatId::Vec3Float64:
-                [[fallthrough]];
-            case DataFormatId::Vec4Float64: {
-                return VTK_DOUBLE;
-            }
-            default: {
-                throw Exception(SourceContext{}, "Cannot map type to VTK.");
-            }
-        }
-    }();
-
-    const auto nComp = layer->getDataFormat()->getComponents();
-    data_->AllocateScalars(vtkType, static_cast<int>(nComp));
-    void* dst = data_->GetScalarPointer();
-    const void* src = layer->getRepresentation<LayerRAM>()->getData();
-    std::memcpy(dst, src, glm::compMul(dim) * layer->getDataFormat()->getSizeInBytes());
+    // When sharing, the image keeps the layer alive
+    auto scalars = shareMemory_.get() ? vtk::shareWithVTK(*layer, image) : vtk::copyToVTK(*layer);
+    scalars->SetName("ImageScalars");
+    data_->GetPointData()->SetScalars(scalars);
 
     outport_.setData(data_);
 }
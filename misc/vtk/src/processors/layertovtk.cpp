@@ -33,6 +33,7 @@
 #include <inviwo/core/datastructures/image/layerram.h>
 
 #include <inviwo/core/util/glm.h>
+#include <inviwo/vtk/util/vtksharing.h>
 
 #include <vtkImageData.h>
 #include <vtkPointData.h>
@@ -52,9 +53,18 @@ const ProcessorInfo LayerToVTK::processorInfo_{
 
 const ProcessorInfo& LayerToVTK::getProcessorInfo() const { return processorInfo_; }
 
-LayerToVTK::LayerToVTK() : Processor{}, inport_{"inport"}, outport_{"outport", VTK_IMAGE_DATA} {
+LayerToVTK::LayerToVTK()
+    : Processor{}
+    , inport_{"inport"}
+    , outport_{"outport", VTK_IMAGE_DATA}
+    , shareMemory_{"shareMemory", "Share Memory",
+                   "Let the VTK arrays refer to the layer data instead of copying it. VTK has no "
+                   "read only arrays, only enable this if no downstream filter modifies its input "
+                   "in place since that would change the Inviwo data as well."_help,
+                   false} {
 
     addPorts(inport_, outport_);
+    addProperty(shareMemory_);
 }
 
 void LayerToVTK::process() {
@@ -78,106 +88,9 @@ void LayerToVTK::process() {
     data_->SetOrigin(glm::value_ptr(offset));
     data_->SetDirectionMatrix(glm::value_ptr(direction));
 
-    const auto vtkType = [&]() {
-        switch (layer->getDataFormat()->getId()) {
-            case DataFormatId::Int8:
-            case DataFormatId::Vec2Int8:
-            case DataFormatId::Vec3Int8:
-            case DataFormatId::Vec4Int8: {
-                return VTK_CHAR;
-            }
-            case DataFormatId::UInt8:
-                [[fallthrough]];
-            case DataFormatId::Vec2UInt8:
-                [[fallthrough]];
-            case DataFormatId::Vec3UInt8:
-                [[fallthrough]];
-            case DataFormatId::Vec4UInt8: {
-                return VTK_UNSIGNED_CHAR;
-            }
-            case DataFormatId::Int16:
-                [[fallthrough]];
-            case DataFormatId::Vec2Int16:
-                [[fallthrough]];
-            case DataFormatId::Vec3Int16:
-                [[fallthrough]];
-            case DataFormatId::Vec4Int16: {
-                return VTK_SHORT;
-            }
-            case DataFormatId::UInt16:
-                [[fallthrough]];
-            case DataFormatId::Vec2UInt16:
-                [[fallthrough]];
-            case DataFormatId::Vec3UInt16:
-                [[fallthrough]];
-            case DataFormatId::Vec4UInt16: {
-                return VTK_UNSIGNED_SHORT;
-            }
-            case DataFormatId::Int32:
-                [[fallthrough]];
-            case DataFormatId::Vec2Int32:
-                [[fallthrough]];
-            case DataFormatId::Vec3Int32:
-                [[fallthrough]];
-            case DataFormatId::Vec4Int32: {
-                return VTK_INT;
-            }
-            case DataFormatId::UInt32:
-                [[fallthrough]];
-            case DataFormatId::Vec2UInt32:
-                [[fallthrough]];
-            case DataFormatId::Vec3UInt32:
-                [[fallthrough]];
-            case DataFormatId::Vec4UInt32: {
-                return VTK_UNSIGNED_INT;
-            }
-            case DataFormatId::Int64:
-                [[fallthrough]];
-            case DataFormatId::Vec2Int64:
-                [[fallthrough]];
-            case DataFormatId::Vec3Int64:
-                [[fallthrough]];
-            case DataFormatId::Vec4Int64: {
-                return VTK_LONG;
-            }
-            case DataFormatId::UInt64:
-                [[fallthrough]];
-            case DataFormatId::Vec2UInt64:
-                [[fallthrough]];
-            case DataFormatId::Vec3UInt64:
-                [[fallthrough]];
-            case DataFormatId::Vec4UInt64: {
-                return VTK_UNSIGNED_LONG;
-            }
-            case DataFormatId::Float32:
-                [[fallthrough]];
-            case DataFormatId::Vec2Float32:
-                [[fallthrough]];
-            case DataFormatId::Vec3Float32:
-                [[fallthrough]];
-            case DataFormatId::Vec4Float32: {
-                return VTK_FLOAT;
-            }
-            case DataFormatId::Float64:
-                [[fallthrough]];
-            case DataFormatId::Vec2Float64:
-                [[fallthrough]];
-            case DataFormatId::Vec3Float64:
-                [[fallthrough]];
-            case DataFormatId::Vec4Float64: {
-                return VTK_DOUBLE;
-            }
-            default: {
-                throw Exception(SourceContext{}, "Cannot map type to VTK.");
-            }
-        }
-    }();
-
-    const auto nComp = layer->getDataFormat()->getComponents();
-    data_->AllocateScalars(vtkType, static_cast<int>(nComp));
-    void* dst = data_->GetScalarPointer();
-    const void* src = layer->getRepresentation<LayerRAM>()->getData();
-    std::memcpy(dst, src, glm::compMul(dim) * layer->getDataFormat()->getSizeInBytes());
+    auto scalars = shareMemory_.get() ? vtk::shareWithVTK(*layer, layer) : vtk::copyToVTK(*layer);
+    scalars->SetName("ImageScalars");
+    data_->GetPointData()->SetScalars(scalars);
 
     outport_.setData(data_);
 }
@@ -33,6 +33,7 @@
 #include <inviwo/core/util/glm.h>
 #include <inviwo/core/util/zip.h>
 #include <inviwo/core/util/exception.h>
+#include <inviwo/vtk/util/vtksharing.h>
 
 #include <vtkImageData.h>
 #include <vtkPointData.h>
@@ -50,7 +51,8 @@ const ProcessorInfo VolumeToVTK::processorInfo_{
     Tags::CPU | Tag{"VTK"} | Tag{"Volume"},  // Tags
     R"(Creates a vtkImageData dataset from a volume. The volume from the optional 
        inport are included as additional arrays. The volumes are required to have 
-       the same dimensions.)"_unindentHelp,
+       the same dimensions. With Share Memory enabled, the VTK arrays refer to
+       the volume data without copying it.)"_unindentHelp,
 };
 const ProcessorInfo& VolumeToVTK::getProcessorInfo() const { return processorInfo_; }
 
@@ -60,10 +62,15 @@ VolumeToVTK::VolumeToVTK()
     , optionalVolumes_("volumes")
     , outport_("outport", "vtkImageData")
     , space_{
-          "space", "Space", {{"data", "Data", Space::Data}, {"model", "Model", Space::Model}}, 1} {
+          "space", "Space", {{"data", "Data", Space::Data}, {"model", "Model", Space::Model}}, 1}
+    , shareMemory_{"shareMemory", "Share Memory",
+                   "Let the VTK arrays refer to the volume data instead of copying it. VTK has no "
+                   "read only arrays, only enable this if no downstream filter modifies its input "
+                   "in place since that would change the Inviwo data as well."_help,
+                   false} {
     addPorts(inport_, optionalVolumes_, outport_);
     optionalVolumes_.setOptional(true);
-    addProperty(space_);
+    addProperties(space_, shareMemory_);
 }
 
 void VolumeToVTK::process() {
@@ -104,123 +111,17 @@ void VolumeToVTK::process() {
             break;
     }
 
-    const auto vtkType = [&](DataFormatId formatId) {
-        switch (formatId) {
-            case DataFormatId::Int8:
-            case DataFormatId::Vec2Int8:
-            case DataFormatId::Vec3Int8:
-            case DataFormatId::Vec4Int8: {
-                return VTK_CHAR;
-            }
-            case DataFormatId::UInt8:
-                [[fallthrough]];
-            case DataFormatId::Vec2UInt8:
-                [[fallthrough]];
-            case DataFormatId::Vec3UInt8:
-                [[fallthrough]];
-            case DataFormatId::Vec4UInt8: {
-                return VTK_UNSIGNED_CHAR;
-            }
-            case DataFormatId::Int16:
-                [[fallthrough]];
-            case DataFormatId::Vec2Int16:
-                [[fallthrough]];
-            case DataFormatId::Vec3Int16:
-                [[fallthrough]];
-            case DataFormatId::Vec4Int16: {
-                return VTK_SHORT;
-            }
-            case DataFormatId::UInt16:
-                [[fallthrough]];
-            case DataFormatId::Vec2UInt16:
-                [[fallthrough]];
-            case DataFormatId::Vec3UInt16:
-                [[fallthrough]];
-            case DataFormatId::Vec4UInt16: {
-                return VTK_UNSIGNED_SHORT;
-            }
-            case DataFormatId::Int32:
-                [[fallthrough]];
-            case DataFormatId::Vec2Int32:
-                [[fallthrough]];
-            case DataFormatId::Vec3Int32:
-                [[fallthrough]];
-            case DataFormatId::Vec4Int32: {
-                return VTK_INT;
-            }
-            case DataFormatId::UInt32:
-                [[fallthrough]];
-            case DataFormatId::Vec2UInt32:
-                [[fallthrough]];
-            case DataFormatId::Vec3UInt32:
-                [[fallthrough]];
-            case DataFormatId::Vec4UInt32: {
-                return VTK_UNSIGNED_INT;
-            }
-            case DataFormatId::Int64:
-                [[fallthrough]];
-            case DataFormatId::Vec2Int64:
-                [[fallthrough]];
-            case DataFormatId::Vec3Int64:
-                [[fallthrough]];
-            case DataFormatId::Vec4Int64: {
-                return VTK_LONG;
-            }
-            case DataFormatId::UInt64:
-                [[fallthrough]];
-            case DataFormatId::Vec2UInt64:
-                [[fallthrough]];
-            case DataFormatId::Vec3UInt64:
-                [[fallthrough]];
-            case DataFormatId::Vec4UInt64: {
-                return VTK_UNSIGNED_LONG;
-            }
-            case DataFormatId::Float32:
-                [[fallthrough]];
-            case DataFormatId::Vec2Float32:
-                [[fallthrough]];
-            case DataFormatId::Vec3Float32:
-                [[fallthrough]];
-            case DataFormatId::Vec4Float32: {
-                return VTK_FLOAT;
-            }
-            case DataFormatId::Float64:
-                [[fallthrough]];
-            case DataFormatId::Vec2Float64:
-                [[fallthrough]];
-            case DataFormatId::Vec3Float64:
-                [[fallthrough]];
-            case DataFormatId::Vec4Float64: {
-                return VTK_DOUBLE;
-            }
-            default: {
-                throw Exception(SourceContext{}, "Cannot map type to VTK.");
-            }
-        }
-    };
-
     const auto nComp = volume->getDataFormat()->getComponents();
-    data_->AllocateScalars(vtkType(volume->getDataFormat()->getId()), static_cast<int>(nComp));
-    void* dst = data_->GetScalarPointer();
-    const void* src = volume->getRepresentation<VolumeRAM>()->getData();
-    std::memcpy(dst, src, glm::compMul(dim) * volume->getDataFormat()->getSizeInBytes());
+    auto scalars = shareMemory_.get() ? vtk::shareWithVTK(volume) : vtk::copyToVTK(*volume);
+    scalars->SetName("ImageScalars");
+    data_->GetPointData()->SetScalars(scalars);
 
     volumeData_.clear();
     for (auto&& [outport, v] : optionalVolumes_.getSourceVectorData()) {
-        auto* dataFormat = v->getDataFormat();
-
-        auto scalars = vtkSmartPointer<vtkDataArray>(
-            vtkDataArray::CreateDataArray(vtkType(dataFormat->getId())));
-        scalars->SetNumberOfComponents(static_cast<int>(dataFormat->getComponents()));
-        scalars->SetName(outport->getProcessor()->getIdentifier().c_str());
-        scalars->SetNumberOfTuples(glm::compMul(dim));
-
-        void* dstData = scalars->GetVoidPointer(0);
-        const void* srcData = v->getRepresentation<VolumeRAM>()->getData();
-        std::memcpy(dstData, srcData, glm::compMul(dim) * dataFormat->getSizeInBytes());
-
-        data_->GetPointData()->AddArray(scalars);
-        volumeData_.push_back(scalars);
+        auto array = shareMemory_.get() ? vtk::shareWithVTK(v) : vtk::copyToVTK(*v);
+        array->SetName(outport->getProcessor()->getIdentifier().c_str());
+        data_->GetPointData()->AddArray(array);
+        volumeData_.push_back(array);
     }
 
     vtkInformation* info = data_->GetPointData()->GetScalars()->GetInformation();
@@ -30,6 +30,8 @@
 #include <inviwo/vtk/processors/vtkfilecache.h>
 
 #include <modules/base/processors/filecache.h>
+#include <inviwo/core/common/inviwoapplication.h>
+#include <inviwo/core/util/formatconversion.h>
 
 #include <vtkSmartPointer.h>
 #include <vtkDataObject.h>
@@ -39,6 +41,8 @@
 #include <vtkType.h>
 #include <vtkDataObjectTypes.h>
 
+#include <fmt/chrono.h>
+
 namespace inviwo {
 
 // The Class Identifier has to be globally unique. Use a reverse DNS naming scheme
@@ -74,14 +78,46 @@ VTKFileCache::VTKFileCache()
                    }()
 
       }
+    , asyncWrite_{"asyncWrite", "Write in Background",
+                  "Write files on the thread pool instead of blocking the network, the data is "
+                  "kept in RAM until written"_help,
+                  true}
+    , compression_{"compression",
+                   "Compression",
+                   "Compressor used for the binary appended data of the written files"_help,
+                   {{"none", "None", Compression::None},
+                    {"lz4", "LZ4", Compression::LZ4},
+                    {"zlib", "ZLib", Compression::ZLib},
+                    {"lzma", "LZMA", Compression::LZMA}},
+                   2}
+    , ramBudget_{"ramBudget",
+                 "RAM Budget (MB)",
+                 "Maximum memory of the data kept in RAM, the least recently used data is "
+                 "evicted and reloaded from disk when needed"_help,
+                 1024,
+                 {0, ConstraintBehavior::Immutable},
+                 {16384, ConstraintBehavior::Ignore}}
+    , stats_{"stats", "Statistics", "Cache hits, misses and I/O timings"_help, "",
+             InvalidationLevel::Valid}
     , inport_{"inport", VTK_DATA_OBJECT, "data to cache"_help}
     , outport_{"outport", outportType_.getSelectedValue(), "cached data"_help}
-    , ram_{} {
+    , ram_{ramBudget_.get() << 20} {
 
     addPorts(inport_, outport_);
-    addProperties(enabled_, cacheDir_, refDir_, currentKey_, outportType_, ram_.capacity);
+    addProperties(enabled_, cacheDir_, refDir_, currentKey_, outportType_, asyncWrite_,
+                  compression_, ramBudget_, stats_);
+
+    stats_.setReadOnly(true);
+    stats_.setSerializationMode(PropertySerializationMode::None);
 
     outportType_.onChange([this]() { outport_.setTypeId(outportType_.getSelectedValue()); });
+    ramBudget_.onChange([this]() { ram_.setByteBudget(ramBudget_.get() << 20); });
+}
+
+VTKFileCache::~VTKFileCache() {
+    for (auto& [key, pending] : pendingWrites_) {
+        pending.wait();
+    }
 }
 
 std::optional<std::filesystem::path> VTKFileCache::pathForKey(std::string_view key) {
@@ -90,11 +126,10 @@ std::optional<std::filesystem::path> VTKFileCache::pathForKey(std::string_view k
 }
 
 bool VTKFileCache::hasCache(std::string_view key) {
-    return ram_.has(key) || pathForKey(key)
-                                .transform([](const std::filesystem::path& path) -> bool {
-                                    return std::filesystem::exists(path);
-                                })
-                                .value_or(false);
+    finishWrites();
+    if (ram_.has(key) || pendingWrites_.contains(std::string{key})) return true;
+    const auto path = pathForKey(key);
+    return path && std::filesystem::exists(*path);
 }
 
 void VTKFileCache::castAndSetOutportData(vtkDataObject* data) {
@@ -109,44 +144,140 @@ void VTKFileCache::castAndSetOutportData(vtkDataObject* data) {
     }
 }
 
+void VTKFileCache::write(vtkDataObject* data, const std::filesystem::path& path,
+                         Compression compression) {
+    const auto start = std::chrono::steady_clock::now();
+
+    // Write to a temporary file first such that a partially written file is never loaded
+    auto tmp = path;
+    tmp += ".tmp";
+
+    auto writer = vtkSmartPointer<vtkXMLDataSetWriter>::New();
+    writer->SetFileName(tmp.generic_string().c_str());
+    writer->SetInputData(data);
+    writer->SetDataModeToAppended();
+    writer->EncodeAppendedDataOff();
+    switch (compression) {
+        case Compression::None:
+            writer->SetCompressorTypeToNone();
+            break;
+        case Compression::LZ4:
+            writer->SetCompressorTypeToLZ4();
+            break;
+        case Compression::ZLib:
+            writer->SetCompressorTypeToZLib();
+            break;
+        case Compression::LZMA:
+            writer->SetCompressorTypeToLZMA();
+            break;
+    }
+    if (writer->Write() != 1) {
+        std::filesystem::remove(tmp);
+        throw Exception(SourceContext{}, "Could not write to vtk file: {:?g}", path);
+    }
+    std::filesystem::rename(tmp, path);
+
+    const std::scoped_lock lock{ioMutex_};
+    ioStats_.lastWrite = std::chrono::steady_clock::now() - start;
+}
+
+void VTKFileCache::waitForWrite(const std::string& key) {
+    if (auto it = pendingWrites_.find(key); it != pendingWrites_.end()) {
+        auto pending = std::move(it->second);
+        pendingWrites_.erase(it);
+        try {
+            pending.get();
+        } catch (const std::exception& e) {
+            log::exception(e);
+        }
+    }
+}
+
+void VTKFileCache::finishWrites() {
+    // Remove finished writes, a failed write is reported and its file is not considered cached
+    std::erase_if(pendingWrites_, [](auto& item) {
+        if (item.second.wait_for(std::chrono::seconds{0}) != std::future_status::ready) {
+            return false;
+        }
+        try {
+            item.second.get();
+        } catch (const std::exception& e) {
+            log::exception(e);
+        }
+        return true;
+    });
+}
+
+void VTKFileCache::updateStats() {
+    const std::scoped_lock lock{ioMutex_};
+    const auto ram = ram_.getStats();
+    stats_.set(fmt::format(
+        "RAM hits: {}, disk hits: {}, misses: {}, last read: {:.3}, last write: {:.3}, "
+        "RAM: {} of {}, writes pending: {}",
+        ioStats_.ramHits, ioStats_.diskHits, ioStats_.misses, ioStats_.lastRead,
+        ioStats_.lastWrite, util::formatBytesToString(ram.bytes),
+        util::formatBytesToString(ram.byteBudget), pendingWrites_.size()));
+}
+
 void VTKFileCache::process() {
+    finishWrites();
+
     if (loadedKey_ == key_) return;
 
     if (isCached_) {
         if (auto ramData = ram_.get(key_)) {
-            castAndSetOutportData(ramData->Get());
+            castAndSetOutportData(ramData->front());
             loadedKey_ = key_;
+            const std::scoped_lock lock{ioMutex_};
+            ++ioStats_.ramHits;
         } else if (auto maybePath = pathForKey(key_)) {
+            waitForWrite(key_);
+            const auto start = std::chrono::steady_clock::now();
             auto reader = vtkSmartPointer<vtkXMLGenericDataObjectReader>::New();
             reader->SetFileName(maybePath->generic_string().c_str());
             reader->Update();  // Process the file
-            auto diskData = reader->GetOutput();
+            auto diskData = vtkSmartPointer<vtkDataObject>{reader->GetOutput()};
             castAndSetOutportData(diskData);  // Return as vtkDataSet
-            ram_.add(key_, vtkSmartPointer<vtkDataObject>(diskData));
+            ram_.add(key_, {diskData});
             loadedKey_ = key_;
+            const std::scoped_lock lock{ioMutex_};
+            ioStats_.lastRead = std::chrono::steady_clock::now() - start;
+            ++ioStats_.diskHits;
         } else {
             throw Exception("No file found");
         }
     } else if (auto data = inport_.getData()) {
+        // Keep a shallow copy, the arrays are shared with the input but the upstream filter
+        // allocates new arrays when it reexecutes, it never changes them in place.
+        auto copy = vtkSmartPointer<vtkDataObject>::Take(data->NewInstance());
+        copy->ShallowCopy(data);
+
         if (auto maybePath = pathForKey(key_)) {
-            auto writer = vtkSmartPointer<vtkXMLDataSetWriter>::New();
-            writer->SetFileName(maybePath->generic_string().c_str());
-            writer->SetInputData(data);
-            if (writer->Write() != 1) {
-                throw Exception(SourceContext{}, "Could not write to vtk file: {:?g}", *maybePath);
+            waitForWrite(key_);
+            // The writer modifies the pipeline information of its input, hence it gets its own
+            // shallow copy that shares the arrays with the cached one
+            auto writeCopy = vtkSmartPointer<vtkDataObject>::Take(data->NewInstance());
+            writeCopy->ShallowCopy(copy);
+            if (asyncWrite_) {
+                pendingWrites_[key_] =
+                    dispatchPool([this, writeCopy, path = *maybePath, c = compression_.get()]() {
+                        write(writeCopy, path, c);
+                    }).share();
+            } else {
+                write(writeCopy, *maybePath, compression_.get());
             }
         }
         writeXML();
 
-        // We need to clone the data here, since the filter above might change the data later.
-        const auto clonedData = vtkSmartPointer<vtkDataObject>::New();
-        clonedData->DeepCopy(data);
-        ram_.add(key_, clonedData);
+        ram_.add(key_, {copy});
         castAndSetOutportData(data);
         loadedKey_ = key_;
+        const std::scoped_lock lock{ioMutex_};
+        ++ioStats_.misses;
     } else {
         throw Exception("Port had no data");
     }
+    updateStats();
 }
 
 }  // namespace inviwo
@@ -34,6 +34,7 @@
 #include <inviwo/core/util/utilities.h>
 
 #include <inviwo/vtk/util/arrayutils.h>
+#include <inviwo/vtk/util/vtksharing.h>
 
 #include <vtkImageData.h>
 #include <vtkPointData.h>
@@ -66,12 +67,17 @@ VTKToLayer::VTKToLayer()
                   {"high", "32 bit", 32},
                   {"full", "64 bit", 64}},
                  0}
+    , transfer_{"transfer", "Data Transfer",
+                "Shows whether the data was shared with VTK or had to be copied"_help, "",
+                InvalidationLevel::Valid}
     , information_("Information", "Data Information")
     , basis_("Basis", "Basis and Offset") {
 
     addPorts(inport_, outport_);
 
-    addProperties(source_, precision_, information_, basis_);
+    addProperties(source_, precision_, transfer_, information_, basis_);
+    transfer_.setReadOnly(true);
+    transfer_.setSerializationMode(PropertySerializationMode::None);
 }
 
 void VTKToLayer::updateSources(vtkDataSet* data) {
@@ -107,7 +113,9 @@ void VTKToLayer::process() {
     }
 
     if (inport_.isChanged() || source_.isModified() || precision_.isModified()) {
-        layer_ = vtk::vtkImageDataToLayer(vtkImg, source_.getSelectedValue(), precision_);
+        vtk::TransferReport report;
+        layer_ = vtk::vtkImageDataToLayer(vtkImg, source_.getSelectedValue(), precision_, &report);
+        transfer_.set(report.toString());
 
         const bool deserializing = getNetwork()->isDeserializing();
         basis_.updateForNewEntity(*layer_, deserializing);
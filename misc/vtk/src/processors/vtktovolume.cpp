@@ -35,6 +35,7 @@
 #include <inviwo/core/util/utilities.h>
 
 #include <inviwo/vtk/util/arrayutils.h>
+#include <inviwo/vtk/util/vtksharing.h>
 
 #include <regex>
 
@@ -69,11 +70,16 @@ VTKToVolume::VTKToVolume()
                   {"high", "32 bit", 32},
                   {"full", "64 bit", 64}},
                  0}
+    , transfer_{"transfer", "Data Transfer",
+                "Shows whether the data was shared with VTK or had to be copied"_help, "",
+                InvalidationLevel::Valid}
     , information_("Information", "Data information")
     , basis_("Basis", "Basis and Offset") {
     addPorts(inport_, outport_);
 
-    addProperties(source_, precision_, information_, basis_);
+    addProperties(source_, precision_, transfer_, information_, basis_);
+    transfer_.setReadOnly(true);
+    transfer_.setSerializationMode(PropertySerializationMode::None);
 }
 
 void VTKToVolume::updateSources(vtkDataSet* data) {
@@ -109,7 +115,10 @@ void VTKToVolume::process() {
     }
 
     if (inport_.isChanged() || source_.isModified() || precision_.isModified()) {
-        volume_ = vtk::vtkImageDataToVolume(vtkImg, source_.getSelectedValue(), precision_);
+        vtk::TransferReport report;
+        volume_ =
+            vtk::vtkImageDataToVolume(vtkImg, source_.getSelectedValue(), precision_, &report);
+        transfer_.set(report.toString());
 
         const bool deserializing = getNetwork()->isDeserializing();
         basis_.updateForNewEntity(*volume_, deserializing);
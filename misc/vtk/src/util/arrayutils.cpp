@@ -28,6 +28,7 @@
  *********************************************************************************/
 
 #include <inviwo/vtk/util/arrayutils.h>
+#include <inviwo/vtk/util/vtksharing.h>
 
 #include <inviwo/core/datastructures/image/layer.h>
 #include <inviwo/core/datastructures/volume/volume.h>
@@ -43,38 +44,14 @@
 
 namespace inviwo::vtk {
 
-std::shared_ptr<Layer> vtkImageDataToLayer(vtkImageData* vtkImage, int arrayIndex, int precision) {
+std::shared_ptr<Layer> vtkImageDataToLayer(vtkImageData* vtkImage, int arrayIndex, int precision,
+                                           TransferReport* report) {
     if (!vtkImage) return nullptr;
 
     const ivec2 dim = glm::make_vec2(vtkImage->GetDimensions());
     auto array = vtkImage->GetPointData()->GetArray(arrayIndex);
 
-    auto ram = [&]() {
-        if (precision == 8) {
-            return vtk::arrayToLayerRAM(static_cast<size2_t>(dim), array, [](auto item) {
-                using Dst = decltype(changePrecision<8>(item));
-                return static_cast<Dst>(item);
-            });
-        } else if (precision == 16) {
-            return vtk::arrayToLayerRAM(static_cast<size2_t>(dim), array, [](auto item) {
-                using Dst = decltype(changePrecision<16>(item));
-                return static_cast<Dst>(item);
-            });
-        } else if (precision == 32) {
-            return vtk::arrayToLayerRAM(static_cast<size2_t>(dim), array, [](auto item) {
-                using Dst = decltype(changePrecision<32>(item));
-                return static_cast<Dst>(item);
-            });
-        } else if (precision == 64) {
-            return vtk::arrayToLayerRAM(static_cast<size2_t>(dim), array, [](auto item) {
-                using Dst = decltype(changePrecision<64>(item));
-                return static_cast<Dst>(item);
-            });
-        } else {
-            return vtk::arrayToLayerRAM(static_cast<size2_t>(dim), array,
-                                        [](auto item) { return item; });
-        }
-    }();
+    auto ram = vtk::toLayerRAM(static_cast<size2_t>(dim), array, precision, report);
 
     if (ram->getDataFormatId() == DataFormatId::NotSpecialized) {
         throw Exception(SourceContext{},
@@ -127,38 +104,13 @@ std::shared_ptr<Layer> vtkImageDataToLayer(vtkImageData* vtkImage, int arrayInde
 }
 
 std::shared_ptr<Volume> vtkImageDataToVolume(vtkImageData* vtkImage, int arrayIndex,
-                                             int precision) {
+                                             int precision, TransferReport* report) {
     if (!vtkImage) return nullptr;
 
     const ivec3 dim = glm::make_vec3(vtkImage->GetDimensions());
     auto array = vtkImage->GetPointData()->GetArray(arrayIndex);
 
-    auto ram = [&]() {
-        if (precision == 8) {
-            return vtk::arrayToVolumeRAM(static_cast<size3_t>(dim), array, [](auto item) {
-                using Dst = decltype(vtk::changePrecision<8>(item));
-                return static_cast<Dst>(item);
-            });
-        } else if (precision == 16) {
-            return vtk::arrayToVolumeRAM(static_cast<size3_t>(dim), array, [](auto item) {
-                using Dst = decltype(vtk::changePrecision<16>(item));
-                return static_cast<Dst>(item);
-            });
-        } else if (precision == 32) {
-            return vtk::arrayToVolumeRAM(static_cast<size3_t>(dim), array, [](auto item) {
-                using Dst = decltype(vtk::changePrecision<32>(item));
-                return static_cast<Dst>(item);
-            });
-        } else if (precision == 64) {
-            return vtk::arrayToVolumeRAM(static_cast<size3_t>(dim), array, [](auto item) {
-                using Dst = decltype(vtk::changePrecision<64>(item));
-                return static_cast<Dst>(item);
-            });
-        } else {
-            return vtk::arrayToVolumeRAM(static_cast<size3_t>(dim), array,
-                                         [](auto item) { return item; });
-        }
-    }();
+    auto ram = vtk::toVolumeRAM(static_cast<size3_t>(dim), array, precision, report);
 
     if (ram->getDataFormatId() == DataFormatId::NotSpecialized) {
         throw Exception(SourceContext{},
@@ -34,10 +34,14 @@
 #include <inviwo/core/datastructures/buffer/buffer.h>
 #include <inviwo/core/interaction/events/pickingevent.h>
 #include <inviwo/vtk/util/arrayutils.h>
+#include <inviwo/vtk/util/vtksharing.h>
 
 #include <fmt/format.h>
 
+#include <cstring>
+
 #include <vtkType.h>
+#include <vtkAOSDataArrayTemplate.h>
 #include <vtkCellType.h>
 #include <vtkDataObject.h>
 #include <vtkDataSet.h>
@@ -46,6 +50,12 @@
 #include <vtkAbstractArray.h>
 #include <vtkArrayDispatch.h>
 #include <vtkDataArrayMeta.h>
+#include <vtkDataArrayRange.h>
+#include <vtkCellArray.h>
+#include <vtkPointSet.h>
+#include <vtkPoints.h>
+#include <vtkPolyData.h>
+#include <vtkUnstructuredGrid.h>
 
 namespace inviwo::utilvtk {
 
@@ -259,22 +269,110 @@ std::shared_ptr<BufferBase> vtkArrayToBuffer(vtkDataArray* array,
 
 std::shared_ptr<BufferBase> vtkPointArrayToBuffer(
     vtkDataArray* array, ArrayBufferMapper::BufferInfo::Transform* transform) {
+    if (!transform) {
+        // Untransformed point data can be copied in bulk
+        return vtk::toBuffer(array);
+    }
     auto repeat = [](int) { return 1; };
     return vtkArrayToBuffer(array, transform, repeat);
 }
 
+/**
+ * Number of points of each cell. Reads the sizes directly from the cell arrays of poly data and
+ * unstructured grids instead of calling the virtual GetCellSize for each cell.
+ */
+std::vector<int> cellSizes(vtkDataSet* dataSet) {
+    std::vector<int> sizes;
+    sizes.reserve(dataSet->GetNumberOfCells());
+
+    auto append = [&](vtkCellArray* cells) {
+        if (!cells) return;
+        for (vtkIdType i = 0; i < cells->GetNumberOfCells(); ++i) {
+            sizes.push_back(static_cast<int>(cells->GetCellSize(i)));
+        }
+    };
+
+    if (auto* grid = vtkUnstructuredGrid::SafeDownCast(dataSet); grid && grid->GetCells()) {
+        append(grid->GetCells());
+    } else if (auto* poly = vtkPolyData::SafeDownCast(dataSet)) {
+        // Cell ids of poly data are ordered as verts, lines, polys, and strips
+        append(poly->GetVerts());
+        append(poly->GetLines());
+        append(poly->GetPolys());
+        append(poly->GetStrips());
+    }
+
+    if (static_cast<vtkIdType>(sizes.size()) != dataSet->GetNumberOfCells()) {
+        sizes.clear();
+        for (vtkIdType i = 0; i < dataSet->GetNumberOfCells(); ++i) {
+            sizes.push_back(dataSet->GetCellSize(i));
+        }
+    }
+    return sizes;
+}
+
 std::shared_ptr<BufferBase> vtkCellArrayToBuffer(
     vtkDataArray* array, vtkDataSet* dataSet, ArrayBufferMapper::BufferInfo::Transform* transform) {
     // We need to repeat each Cell value for each Point.
-    auto repeat = [dataSet](int i) { return dataSet->GetCellSize(i); };
+    auto repeat = [sizes = cellSizes(dataSet)](int i) { return sizes[i]; };
     return vtkArrayToBuffer(array, transform, repeat);
 }
 
-auto pointTransformer(const OrdinalProperty<dmat4>& mat) {
-    return [m = mat.get()](auto val) {
-        using T = decltype(val);
-        return T{m * dvec4{val, 1.0}};
-    };
+/**
+ * Extract the points of \p data as glm::vec<3, T>. For point sets the points array is read
+ * directly, and copied in bulk if it already has the right type and no transform is applied.
+ * The \p range is updated with the range of the untransformed points.
+ */
+template <typename T>
+std::vector<glm::vec<3, T>> getPoints(vtkDataSet* data, const OrdinalProperty<dmat4>* transform,
+                                      dvec2& range) {
+    const auto nPoints = data->GetNumberOfPoints();
+    std::vector<glm::vec<3, T>> points(nPoints);
+    const dmat4 m = transform ? transform->get() : dmat4{1.0};
+
+    auto* pointSet = vtkPointSet::SafeDownCast(data);
+    vtkDataArray* array =
+        pointSet && pointSet->GetPoints() ? pointSet->GetPoints()->GetData() : nullptr;
+
+    bool done = false;
+    if (array && array->GetNumberOfComponents() == 3) {
+        auto worker = [&](auto* typedArray) {
+            using ArrayT = std::remove_pointer_t<decltype(typedArray)>;
+            if constexpr (std::is_same_v<ArrayT, vtkAOSDataArrayTemplate<T>>) {
+                if (!transform) {
+                    std::memcpy(points.data(), typedArray->GetPointer(0),
+                                nPoints * sizeof(glm::vec<3, T>));
+                    for (const auto& p : points) {
+                        range[0] = std::min(range[0], static_cast<double>(glm::compMin(p)));
+                        range[1] = std::max(range[1], static_cast<double>(glm::compMax(p)));
+                    }
+                    return;
+                }
+            }
+            const auto tuples = ::vtk::DataArrayTupleRange<3>(typedArray);
+            for (vtkIdType i = 0; i < nPoints; ++i) {
+                const auto tuple = tuples[i];
+                dvec3 p{tuple[0], tuple[1], tuple[2]};
+                range[0] = std::min(range[0], glm::compMin(p));
+                range[1] = std::max(range[1], glm::compMax(p));
+                if (transform) p = dvec3{m * dvec4{p, 1.0}};
+                points[i] = static_cast<glm::vec<3, T>>(p);
+            }
+        };
+        done = vtkArrayDispatch::Dispatch::Execute(array, worker);
+    }
+
+    if (!done) {
+        for (vtkIdType i = 0; i < nPoints; ++i) {
+            dvec3 p;
+            data->GetPoint(i, glm::value_ptr(p));
+            range[0] = std::min(range[0], glm::compMin(p));
+            range[1] = std::max(range[1], glm::compMax(p));
+            if (transform) p = dvec3{m * dvec4{p, 1.0}};
+            points[i] = static_cast<glm::vec<3, T>>(p);
+        }
+    }
+    return points;
 }
 
 Mesh::BufferVector ArrayBufferMapper::getBuffers(vtkDataSet* data) {
@@ -314,48 +412,14 @@ Mesh::BufferVector ArrayBufferMapper::getBuffers(vtkDataSet* data) {
             } else if (source.type == SourceType::Point) {
                 dvec2 range{std::numeric_limits<double>::max(),
                             std::numeric_limits<double>::lowest()};
+                const auto* transform = info.doTransform && info.transform.index() == 0
+                                            ? &std::get<0>(info.transform)
+                                            : nullptr;
                 if (source.index == 0) {
-                    std::vector<dvec3> points(data->GetNumberOfPoints());
-                    if (info.doTransform && info.transform.index() == 0) {
-                        auto trans = pointTransformer(std::get<0>(info.transform));
-                        for (vtkIdType i = 0; i < data->GetNumberOfPoints(); ++i) {
-                            data->GetPoint(i, glm::value_ptr(points[i]));
-                            range[0] = std::min(range[0], glm::compMin(points[i]));
-                            range[1] = std::max(range[1], glm::compMax(points[i]));
-                            points[i] = trans(points[i]);
-                        }
-                    } else {
-                        for (vtkIdType i = 0; i < data->GetNumberOfPoints(); ++i) {
-                            data->GetPoint(i, glm::value_ptr(points[i]));
-                            range[0] = std::min(range[0], glm::compMin(points[i]));
-                            range[1] = std::max(range[1], glm::compMax(points[i]));
-                        }
-                    }
+                    auto points = getPoints<double>(data, transform, range);
                     buffers.emplace_back(info.type, util::makeBuffer(std::move(points)));
                 } else {
-                    std::vector<vec3> points;
-                    points.reserve(data->GetNumberOfPoints());
-                    if (info.doTransform && info.transform.index() == 0) {
-                        auto trans = pointTransformer(std::get<0>(info.transform));
-                        for (vtkIdType i = 0; i < data->GetNumberOfPoints(); ++i) {
-                            dvec3 point;
-                            data->GetPoint(i, glm::value_ptr(point));
-                            range[0] = std::min(range[0], glm::compMin(point));
-                            range[1] = std::max(range[1], glm::compMax(point));
-                            point = trans(point);
-                            points.push_back(static_cast<vec3>(point));
-                        }
-
-                    } else {
-                        for (vtkIdType i = 0; i < data->GetNumberOfPoints(); ++i) {
-                            dvec3 point;
-                            data->GetPoint(i, glm::value_ptr(point));
-                            range[0] = std::min(range[0], glm::compMin(point));
-                            range[1] = std::max(range[1], glm::compMax(point));
-                            points.push_back(static_cast<vec3>(point));
-                        }
-                    }
-
+                    auto points = getPoints<float>(data, transform, range);
                     buffers.emplace_back(info.type, util::makeBuffer(std::move(points)));
                 }
                 info.range.set(range);
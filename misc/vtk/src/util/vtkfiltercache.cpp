@@ -0,0 +1,154 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/vtk/util/vtkfiltercache.h>
+
+#include <inviwo/core/util/formatconversion.h>
+
+#include <fmt/format.h>
+
+#include <vtkDataObject.h>
+
+namespace inviwo {
+
+namespace vtk {
+
+std::string FilterCache::Stats::toString() const {
+    return fmt::format("{} hits, {} misses, {} evictions, {} entries using {} of {}", hits, misses,
+                       evictions, entries, util::formatBytesToString(bytes),
+                       util::formatBytesToString(byteBudget));
+}
+
+FilterCache::FilterCache(size_t byteBudget) { stats_.byteBudget = byteBudget; }
+
+std::optional<FilterCache::Outputs> FilterCache::get(std::string_view key) {
+    const std::scoped_lock lock{mutex_};
+    if (!enabled_) return std::nullopt;
+
+    if (auto it = entries_.find(key); it != entries_.end()) {
+        lru_.splice(lru_.begin(), lru_, it->second);
+        ++stats_.hits;
+        return it->second->outputs;
+    }
+    return std::nullopt;
+}
+
+void FilterCache::add(std::string_view key, Outputs outputs) {
+    const auto bytes = memorySize(outputs);
+
+    const std::scoped_lock lock{mutex_};
+    if (!enabled_) return;
+
+    ++stats_.misses;
+    erase(key);
+    if (bytes > stats_.byteBudget) return;
+
+    evict(stats_.byteBudget - bytes);
+    lru_.push_front(Entry{std::string{key}, std::move(outputs), bytes});
+    entries_[lru_.front().key] = lru_.begin();
+    stats_.bytes += bytes;
+    stats_.entries = lru_.size();
+}
+
+bool FilterCache::has(std::string_view key) const {
+    const std::scoped_lock lock{mutex_};
+    return entries_.contains(key);
+}
+
+void FilterCache::remove(std::string_view key) {
+    const std::scoped_lock lock{mutex_};
+    erase(key);
+}
+
+void FilterCache::erase(std::string_view key) {
+    if (auto it = entries_.find(key); it != entries_.end()) {
+        auto entry = it->second;
+        stats_.bytes -= entry->bytes;
+        entries_.erase(it);
+        lru_.erase(entry);
+        stats_.entries = lru_.size();
+    }
+}
+
+void FilterCache::setEnabled(bool enabled) {
+    const std::scoped_lock lock{mutex_};
+    enabled_ = enabled;
+    if (!enabled_) evict(0);
+}
+
+bool FilterCache::isEnabled() const {
+    const std::scoped_lock lock{mutex_};
+    return enabled_;
+}
+
+void FilterCache::setByteBudget(size_t byteBudget) {
+    const std::scoped_lock lock{mutex_};
+    stats_.byteBudget = byteBudget;
+    evict(byteBudget);
+}
+
+size_t FilterCache::getByteBudget() const {
+    const std::scoped_lock lock{mutex_};
+    return stats_.byteBudget;
+}
+
+void FilterCache::clear() {
+    const std::scoped_lock lock{mutex_};
+    lru_.clear();
+    entries_.clear();
+    stats_ = Stats{.byteBudget = stats_.byteBudget};
+}
+
+FilterCache::Stats FilterCache::getStats() const {
+    const std::scoped_lock lock{mutex_};
+    return stats_;
+}
+
+size_t FilterCache::memorySize(const Outputs& outputs) {
+    size_t bytes = 0;
+    for (const auto& output : outputs) {
+        // GetActualMemorySize reports kibibytes
+        if (output) bytes += size_t{output->GetActualMemorySize()} * 1024;
+    }
+    return bytes;
+}
+
+void FilterCache::evict(size_t byteBudget) {
+    while (!lru_.empty() && stats_.bytes > byteBudget) {
+        stats_.bytes -= lru_.back().bytes;
+        entries_.erase(std::string_view{lru_.back().key});
+        lru_.pop_back();
+        ++stats_.evictions;
+    }
+    stats_.entries = lru_.size();
+}
+
+}  // namespace vtk
+
+}  // namespace inviwo
@@ -50,9 +50,23 @@ VTKSettings::VTKSettings()
                  {"7", "7", vtkLogger::VERBOSITY_7},
                  {"8", "8", vtkLogger::VERBOSITY_8},
                  {"9", "9", vtkLogger::VERBOSITY_9}},
-                3} {
+                3}
+    , filterCache{"filterCache", "Filter Output Cache",
+                  "Outputs of the VTK filter processors are memoized by filter, parameters and "
+                  "inputs, such that going back to a previously used state does not rerun the "
+                  "filter"_help}
+    , filterCacheEnabled{"filterCacheEnabled", "Enabled", true}
+    , filterCacheSize{"filterCacheSize",
+                      "Size (MB)",
+                      "Maximum memory used by the cached outputs, the least recently used outputs "
+                      "are evicted first"_help,
+                      512,
+                      {0, ConstraintBehavior::Immutable},
+                      {16384, ConstraintBehavior::Ignore}}
+    , clearFilterCache{"clearFilterCache", "Clear"} {
 
-    addProperties(globalWarningDisplay, verbosity);
+    filterCache.addProperties(filterCacheEnabled, filterCacheSize, clearFilterCache);
+    addProperties(globalWarningDisplay, verbosity, filterCache);
     load();
 }
 
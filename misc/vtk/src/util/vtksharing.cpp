@@ -0,0 +1,460 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/vtk/util/vtksharing.h>
+#include <inviwo/vtk/util/arrayutils.h>
+
+#include <inviwo/core/datastructures/buffer/buffer.h>
+#include <inviwo/core/datastructures/buffer/bufferramprecision.h>
+#include <inviwo/core/datastructures/image/layer.h>
+#include <inviwo/core/datastructures/image/layerramprecision.h>
+#include <inviwo/core/datastructures/volume/volume.h>
+#include <inviwo/core/datastructures/volume/volumeramprecision.h>
+#include <inviwo/core/util/exception.h>
+#include <inviwo/core/util/formatconversion.h>
+#include <inviwo/core/util/formatdispatching.h>
+
+#include <fmt/format.h>
+
+#include <vtkAOSDataArrayTemplate.h>
+#include <vtkArrayDispatch.h>
+#include <vtkCallbackCommand.h>
+#include <vtkCommand.h>
+#include <vtkDataArray.h>
+#include <vtkTypeTraits.h>
+
+#include <cstring>
+#include <type_traits>
+
+namespace inviwo::vtk {
+
+namespace {
+
+/*
+ * VTK uses char, long, and long long which do not all have an Inviwo DataFormat, map them onto
+ * the Inviwo type of the same size and signedness.
+ */
+template <typename V>
+struct InviwoComponent {
+    using type = V;
+};
+template <>
+struct InviwoComponent<char> {
+    using type = std::conditional_t<std::is_signed_v<char>, glm::i8, glm::u8>;
+};
+template <>
+struct InviwoComponent<long> {
+    using type = std::conditional_t<sizeof(long) == 4, glm::i32, glm::i64>;
+};
+template <>
+struct InviwoComponent<unsigned long> {
+    using type = std::conditional_t<sizeof(unsigned long) == 4, glm::u32, glm::u64>;
+};
+template <>
+struct InviwoComponent<long long> {
+    using type = glm::i64;
+};
+template <>
+struct InviwoComponent<unsigned long long> {
+    using type = glm::u64;
+};
+
+/*
+ * Inviwo Int8 components are stored as VTK_CHAR, all other types map to the VTK type of the same
+ * C++ type.
+ */
+template <typename C>
+using VTKComponent = std::conditional_t<std::is_same_v<C, glm::i8>, char, C>;
+
+template <typename Array>
+constexpr bool isAOS = false;
+template <typename V>
+constexpr bool isAOS<vtkAOSDataArrayTemplate<V>> = true;
+
+/*
+ * Keeps \p owner alive for the lifetime of \p array. The callback command is owned by the array
+ * and releases the client data, and with it the owner, when the array is destroyed.
+ */
+void attachOwner(vtkDataArray* array, std::shared_ptr<const void> owner) {
+    auto command = vtkSmartPointer<vtkCallbackCommand>::New();
+    command->SetClientData(new std::shared_ptr<const void>(std::move(owner)));
+    command->SetClientDataDeleteCallback(
+        [](void* clientData) { delete static_cast<std::shared_ptr<const void>*>(clientData); });
+    command->SetCallback([](vtkObject*, unsigned long, void*, void*) {});
+    array->AddObserver(vtkCommand::DeleteEvent, command);
+}
+
+/*
+ * A VolumeRAM referring to the memory of a VTK array. Clones get their own copy of the data.
+ */
+template <typename T>
+class VolumeRAMVTK : public VolumeRAMPrecision<T> {
+public:
+    VolumeRAMVTK(vtkSmartPointer<vtkDataArray> array, T* data, size3_t dimensions)
+        : VolumeRAMPrecision<T>(data, dimensions), array_{std::move(array)} {
+        this->removeDataOwnership();
+    }
+    virtual ~VolumeRAMVTK() = default;
+
+    virtual VolumeRAMPrecision<T>* clone() const override {
+        return new VolumeRAMPrecision<T>(*this);
+    }
+
+private:
+    vtkSmartPointer<vtkDataArray> array_;
+};
+
+template <typename C>
+std::shared_ptr<VolumeRAM> wrapVolumeRAM(vtkDataArray* array, C* data, size3_t dimensions) {
+    switch (array->GetNumberOfComponents()) {
+        case 1:
+            return std::make_shared<VolumeRAMVTK<C>>(array, data, dimensions);
+        case 2:
+            return std::make_shared<VolumeRAMVTK<glm::vec<2, C>>>(
+                array, reinterpret_cast<glm::vec<2, C>*>(data), dimensions);
+        case 3:
+            return std::make_shared<VolumeRAMVTK<glm::vec<3, C>>>(
+                array, reinterpret_cast<glm::vec<3, C>*>(data), dimensions);
+        case 4:
+            return std::make_shared<VolumeRAMVTK<glm::vec<4, C>>>(
+                array, reinterpret_cast<glm::vec<4, C>*>(data), dimensions);
+        default:
+            return nullptr;
+    }
+}
+
+template <typename Repr, typename C, typename Dims>
+std::shared_ptr<Repr> copyToRAM(int nComp, const C* data, Dims dimensions) {
+    auto copy = [&]<typename T>() -> std::shared_ptr<Repr> {
+        using Precision = std::conditional_t<std::is_same_v<Repr, VolumeRAM>,
+                                             VolumeRAMPrecision<T>, LayerRAMPrecision<T>>;
+        auto ram = std::make_shared<Precision>(dimensions);
+        std::memcpy(ram->getDataTyped(), data, glm::compMul(dimensions) * sizeof(T));
+        return ram;
+    };
+    switch (nComp) {
+        case 1:
+            return copy.template operator()<C>();
+        case 2:
+            return copy.template operator()<glm::vec<2, C>>();
+        case 3:
+            return copy.template operator()<glm::vec<3, C>>();
+        case 4:
+            return copy.template operator()<glm::vec<4, C>>();
+        default:
+            return nullptr;
+    }
+}
+
+template <size_t Precision>
+auto changePrecisionTo() {
+    return [](auto item) {
+        using Dst = decltype(vtk::changePrecision<Precision>(item));
+        return static_cast<Dst>(item);
+    };
+}
+
+/*
+ * Element-wise conversion of any VTK array, used when the memory cannot be shared or copied in
+ * bulk.
+ */
+template <typename Convert>
+auto convertWithPrecision(int precision, Convert convert) {
+    if (precision == 8) {
+        return convert(changePrecisionTo<8>());
+    } else if (precision == 16) {
+        return convert(changePrecisionTo<16>());
+    } else if (precision == 32) {
+        return convert(changePrecisionTo<32>());
+    } else if (precision == 64) {
+        return convert(changePrecisionTo<64>());
+    } else {
+        return convert([](auto item) { return item; });
+    }
+}
+
+std::string copyReason(vtkDataArray* array, int precision) {
+    if (!isContiguous(array)) {
+        return fmt::format("'{}' is not a contiguous array ({})", array->GetName(),
+                           array->GetClassName());
+    } else if (array->GetNumberOfComponents() > 4) {
+        return fmt::format("'{}' has more than four components", array->GetName());
+    } else if (precision != 0 && precision != 8 * array->GetDataTypeSize()) {
+        return fmt::format("precision changed from {} to {} bits", 8 * array->GetDataTypeSize(),
+                           precision);
+    } else {
+        return fmt::format("'{}' has no matching data format", array->GetName());
+    }
+}
+
+size_t byteSize(vtkDataArray* array) {
+    return static_cast<size_t>(array->GetNumberOfValues()) *
+           static_cast<size_t>(array->GetDataTypeSize());
+}
+
+}  // namespace
+
+void TransferReport::shared(size_t numBytes) {
+    mode = Mode::Shared;
+    bytes = numBytes;
+    reason.clear();
+}
+
+void TransferReport::copied(size_t numBytes, std::string_view why) {
+    mode = Mode::Copied;
+    bytes = numBytes;
+    reason = why;
+}
+
+std::string TransferReport::toString() const {
+    if (mode == Mode::Shared) {
+        return fmt::format("Shared {} (no copy)", util::formatBytesToString(bytes));
+    } else {
+        return fmt::format("Copied {} ({})", util::formatBytesToString(bytes), reason);
+    }
+}
+
+int toVTKType(const DataFormatBase* format) {
+    return dispatching::singleDispatch<int, dispatching::filter::All>(
+        format->getId(), [&]<typename T>() -> int {
+            using C = util::value_type_t<T>;
+            if constexpr (std::is_integral_v<C> || std::is_floating_point_v<C>) {
+                return vtkTypeTraits<VTKComponent<C>>::VTKTypeID();
+            } else {
+                throw Exception(SourceContext{}, "Cannot map type '{}' to VTK.",
+                                format->getString());
+            }
+        });
+}
+
+bool isContiguous(vtkDataArray* array) {
+    return array && array->HasStandardMemoryLayout();
+}
+
+vtkSmartPointer<vtkDataArray> shareWithVTK(const void* data, const DataFormatBase* format,
+                                           size_t size, std::shared_ptr<const void> owner) {
+    return dispatching::singleDispatch<vtkSmartPointer<vtkDataArray>, dispatching::filter::All>(
+        format->getId(), [&]<typename T>() -> vtkSmartPointer<vtkDataArray> {
+            using C = util::value_type_t<T>;
+            if constexpr (std::is_integral_v<C> || std::is_floating_point_v<C>) {
+                using V = VTKComponent<C>;
+                constexpr auto nComp = util::extent_v<T>;
+                auto array = vtkSmartPointer<vtkAOSDataArrayTemplate<V>>::New();
+                array->SetNumberOfComponents(static_cast<int>(nComp));
+                // save = 1, VTK will not try to free the memory
+                array->SetArray(const_cast<V*>(static_cast<const V*>(data)),
+                                static_cast<vtkIdType>(size * nComp), 1);
+                attachOwner(array, std::move(owner));
+                return array;
+            } else {
+                throw Exception(SourceContext{}, "Cannot map type '{}' to VTK.",
+                                format->getString());
+            }
+        });
+}
+
+vtkSmartPointer<vtkDataArray> copyToVTK(const void* data, const DataFormatBase* format,
+                                        size_t size) {
+    return dispatching::singleDispatch<vtkSmartPointer<vtkDataArray>, dispatching::filter::All>(
+        format->getId(), [&]<typename T>() -> vtkSmartPointer<vtkDataArray> {
+            using C = util::value_type_t<T>;
+            if constexpr (std::is_integral_v<C> || std::is_floating_point_v<C>) {
+                using V = VTKComponent<C>;
+                constexpr auto nComp = util::extent_v<T>;
+                auto array = vtkSmartPointer<vtkAOSDataArrayTemplate<V>>::New();
+                array->SetNumberOfComponents(static_cast<int>(nComp));
+                array->SetNumberOfTuples(static_cast<vtkIdType>(size));
+                std::memcpy(array->GetPointer(0), data, size * sizeof(T));
+                return array;
+            } else {
+                throw Exception(SourceContext{}, "Cannot map type '{}' to VTK.",
+                                format->getString());
+            }
+        });
+}
+
+vtkSmartPointer<vtkDataArray> shareWithVTK(std::shared_ptr<const Volume> volume,
+                                           TransferReport* report) {
+    const auto* ram = volume->getRepresentation<VolumeRAM>();
+    const auto size = glm::compMul(ram->getDimensions());
+    const auto* format = ram->getDataFormat();
+    auto array = shareWithVTK(ram->getData(), format, size, volume);
+    if (report) report->shared(size * format->getSizeInBytes());
+    return array;
+}
+
+vtkSmartPointer<vtkDataArray> shareWithVTK(const Layer& layer, std::shared_ptr<const void> owner,
+                                           TransferReport* report) {
+    const auto* ram = layer.getRepresentation<LayerRAM>();
+    const auto size = glm::compMul(ram->getDimensions());
+    const auto* format = ram->getDataFormat();
+    auto array = shareWithVTK(ram->getData(), format, size, std::move(owner));
+    if (report) report->shared(size * format->getSizeInBytes());
+    return array;
+}
+
+vtkSmartPointer<vtkDataArray> copyToVTK(const Volume& volume, TransferReport* report) {
+    const auto* ram = volume.getRepresentation<VolumeRAM>();
+    const auto size = glm::compMul(ram->getDimensions());
+    const auto* format = ram->getDataFormat();
+    auto array = copyToVTK(ram->getData(), format, size);
+    if (report) report->copied(size * format->getSizeInBytes(), "sharing disabled");
+    return array;
+}
+
+vtkSmartPointer<vtkDataArray> copyToVTK(const Layer& layer, TransferReport* report) {
+    const auto* ram = layer.getRepresentation<LayerRAM>();
+    const auto size = glm::compMul(ram->getDimensions());
+    const auto* format = ram->getDataFormat();
+    auto array = copyToVTK(ram->getData(), format, size);
+    if (report) report->copied(size * format->getSizeInBytes(), "sharing disabled");
+    return array;
+}
+
+std::shared_ptr<VolumeRAM> toVolumeRAM(size3_t dimensions, vtkDataArray* array, int precision,
+                                       TransferReport* report) {
+    if (!array) return nullptr;
+    if (static_cast<vtkIdType>(glm::compMul(dimensions)) != array->GetNumberOfTuples()) {
+        throw Exception(SourceContext{}, "Invalid dims, expected {} tuples got {}",
+                        glm::compMul(dimensions), array->GetNumberOfTuples());
+    }
+
+    std::shared_ptr<VolumeRAM> ram;
+    auto share = [&](auto* typedArray) {
+        using ArrayT = std::remove_pointer_t<decltype(typedArray)>;
+        using V = typename ArrayT::ValueType;
+        using C = typename InviwoComponent<V>::type;
+        if constexpr (isAOS<ArrayT> && sizeof(C) == sizeof(V)) {
+            if (precision == 0 || precision == static_cast<int>(8 * sizeof(V))) {
+                ram = wrapVolumeRAM<C>(array, reinterpret_cast<C*>(typedArray->GetPointer(0)),
+                                       dimensions);
+            }
+        }
+    };
+    vtkArrayDispatch::Dispatch::Execute(array, share);
+
+    if (ram && ram->getDataFormatId() != DataFormatId::NotSpecialized) {
+        if (report) report->shared(byteSize(array));
+        return ram;
+    }
+
+    ram = convertWithPrecision(precision, [&](auto convert) -> std::shared_ptr<VolumeRAM> {
+        return vtk::arrayToVolumeRAM(dimensions, array, convert);
+    });
+    if (report) {
+        report->copied(glm::compMul(dimensions) * ram->getDataFormat()->getSizeInBytes(),
+                       copyReason(array, precision));
+    }
+    return ram;
+}
+
+std::shared_ptr<LayerRAM> toLayerRAM(size2_t dimensions, vtkDataArray* array, int precision,
+                                     TransferReport* report) {
+    if (!array) return nullptr;
+    if (static_cast<vtkIdType>(glm::compMul(dimensions)) != array->GetNumberOfTuples()) {
+        throw Exception(SourceContext{}, "Invalid dims, expected {} tuples got {}",
+                        glm::compMul(dimensions), array->GetNumberOfTuples());
+    }
+
+    std::shared_ptr<LayerRAM> ram;
+    auto bulkCopy = [&](auto* typedArray) {
+        using ArrayT = std::remove_pointer_t<decltype(typedArray)>;
+        using V = typename ArrayT::ValueType;
+        using C = typename InviwoComponent<V>::type;
+        if constexpr (isAOS<ArrayT> && sizeof(C) == sizeof(V)) {
+            if (precision == 0 || precision == static_cast<int>(8 * sizeof(V))) {
+                ram = copyToRAM<LayerRAM>(typedArray->GetNumberOfComponents(),
+                                          reinterpret_cast<const C*>(typedArray->GetPointer(0)),
+                                          dimensions);
+            }
+        }
+    };
+    vtkArrayDispatch::Dispatch::Execute(array, bulkCopy);
+
+    if (ram && ram->getDataFormatId() != DataFormatId::NotSpecialized) {
+        if (report) report->copied(byteSize(array), "layers cannot refer to VTK memory");
+        return ram;
+    }
+
+    ram = convertWithPrecision(precision, [&](auto convert) -> std::shared_ptr<LayerRAM> {
+        return vtk::arrayToLayerRAM(dimensions, array, convert);
+    });
+    if (report) {
+        report->copied(glm::compMul(dimensions) * ram->getDataFormat()->getSizeInBytes(),
+                       copyReason(array, precision));
+    }
+    return ram;
+}
+
+std::shared_ptr<BufferBase> toBuffer(vtkDataArray* array, TransferReport* report) {
+    if (!array) return nullptr;
+
+    std::shared_ptr<BufferBase> buffer;
+    auto bulkCopy = [&](auto* typedArray) {
+        using ArrayT = std::remove_pointer_t<decltype(typedArray)>;
+        using V = typename ArrayT::ValueType;
+        using C = typename InviwoComponent<V>::type;
+        if constexpr (isAOS<ArrayT> && sizeof(C) == sizeof(V)) {
+            const auto* begin = reinterpret_cast<const C*>(typedArray->GetPointer(0));
+            const auto nTuples = static_cast<size_t>(typedArray->GetNumberOfTuples());
+            auto copy = [&]<typename T>() {
+                const auto* data = reinterpret_cast<const T*>(begin);
+                buffer = util::makeBuffer(std::vector<T>(data, data + nTuples));
+            };
+            switch (typedArray->GetNumberOfComponents()) {
+                case 1:
+                    copy.template operator()<C>();
+                    break;
+                case 2:
+                    copy.template operator()<glm::vec<2, C>>();
+                    break;
+                case 3:
+                    copy.template operator()<glm::vec<3, C>>();
+                    break;
+                case 4:
+                    copy.template operator()<glm::vec<4, C>>();
+                    break;
+                default:
+                    break;
+            }
+        }
+    };
+    vtkArrayDispatch::Dispatch::Execute(array, bulkCopy);
+
+    if (buffer) {
+        if (report) report->copied(byteSize(array), "buffers cannot refer to VTK memory");
+        return buffer;
+    }
+
+    buffer = vtk::arrayToBuffer(array, [](auto item) { return item; }, [](int) { return 1; });
+    if (report) report->copied(byteSize(array), copyReason(array, 0));
+    return buffer;
+}
+
+}  // namespace inviwo::vtk
@@ -94,7 +94,10 @@ private:
 
 vtkStandardNewMacro(InviwoOutputWindow);
 
-VTKModule::VTKModule(InviwoApplication* app) : InviwoModule(app, "VTK"), settings{} {
+VTKModule::VTKModule(InviwoApplication* app)
+    : InviwoModule(app, "VTK")
+    , settings{}
+    , filterCache{settings.filterCacheSize.get() << 20} {
 
     // see https://vtk.org/doc/nightly/html/classvtkLogger.html
     vtkLogger::AddCallback("inviwolog", &logCallback, nullptr,
@@ -112,6 +115,13 @@ VTKModule::VTKModule(InviwoApplication* app) : InviwoModule(app, "VTK"), setting
                                settings.verbosity.getSelectedValue());
     });
 
+    filterCache.setEnabled(settings.filterCacheEnabled);
+    settings.filterCacheEnabled.onChange(
+        [this]() { filterCache.setEnabled(settings.filterCacheEnabled); });
+    settings.filterCacheSize.onChange(
+        [this]() { filterCache.setByteBudget(settings.filterCacheSize.get() << 20); });
+    settings.clearFilterCache.onChange([this]() { filterCache.clear(); });
+
     // Processors
     registerProcessor<ImageToVTK>();
     registerProcessor<LayerToVTK>();
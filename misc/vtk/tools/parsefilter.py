@@ -199,6 +199,10 @@ if __name__ == '__main__':
             trait="ttk::OutportDataTypeFunc outportDataTypeFunc = ttk::getOutportDataType;",
             include="#include <inviwo/ttk/util/ttkprocessorutils.h>"
         ))
+        traits.append(vtkwrapping.CustomTrait(
+            trait="ttk::ExecutionScopeFunc executionScopeFunc = ttk::threadBudgetScope;",
+            include="#include <inviwo/ttk/util/ttkprocessorutils.h>"
+        ))
 
     vtkwrapping.generatefiles.generate_files(
         destination=config.destination,
@@ -294,7 +294,7 @@ def generate_source_files(data: vtkdata.FilterData, uriPrefix: str, *,
     uri = f'{uriPrefix}.{data.className}' if uriPrefix else data.className
 
     traits: str = "\n    ".join(t.trait for t in customTraits)
-    includes: str = "\n".join(t.include for t in customTraits)
+    includes: str = "\n".join(dict.fromkeys(t.include for t in customTraits))
 
     source = cpptemplates.sourceTemplate.format(
         customIncludes=includes,
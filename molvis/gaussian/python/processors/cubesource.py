@@ -93,6 +93,11 @@ class CubeSource(ivw.Processor):
             "radiusScaling", "Radius Scaling", 0.25, 0.0, 2.0, 0.01)
         self.addProperty(self.radiusScaling)
 
+        # Cube files of crystals cover one unit cell, molecules are not periodic
+        self.periodic = ivw.properties.BoolProperty(
+            "periodic", "Periodic Bonds", False)
+        self.addProperty(self.periodic)
+
         self.wrapX = ivw.properties.OptionPropertyInt(
             "wrapX", "Wrapping X",
             [ivw.properties.IntOption("clamp", "Clamp", ivw.data.Wrapping.Clamp),
@@ -169,8 +174,16 @@ Loads CUBE files stemming from [Gaussian](https://www.gaussian.com) calculations
                                                       modelmat=ivw.glm.mat4(1.0))
 
         offset = ivw.glm.dvec3(self.volume.offset) if self.centerData.value else ivw.glm.dvec3(0)
-        self.molecule = molviscommon.createMolecularStructure(
-            pos=self.atomPos, elements=self.atomTypes, basis=None, offset=offset)
+        if self.periodic.value:
+            # The rows of the basis array are the lattice vectors of the volume
+            basis = np.array(self.volume.basis, dtype=np.float64)
+            fractional = np.asarray(self.atomPos, dtype=np.float64) @ np.linalg.inv(basis)
+            self.molecule = molviscommon.createMolecularStructure(
+                pos=fractional, elements=self.atomTypes, basis=self.volume.basis, offset=offset,
+                periodic=True)
+        else:
+            self.molecule = molviscommon.createMolecularStructure(
+                pos=self.atomPos, elements=self.atomTypes, basis=None, offset=offset)
 
         self.volumeOutport.setData(self.volume)
         self.meshOutport.setData(self.mesh)
@@ -95,6 +95,23 @@ IVW_MODULE_MOLVISBASE_API PeptideType getPeptideType(AminoAcid residue, AminoAci
 IVW_MODULE_MOLVISBASE_API PeptideType getPeptideType(std::string_view resName,
                                                      std::string_view nextResName);
 
+/**
+ * Whether an element takes part in the covalent bond heuristics, false for metals and noble gases.
+ */
+IVW_MODULE_MOLVISBASE_API bool formsCovalentBonds(Element element);
+
+/**
+ * The bond heuristics used by computeCovalentBonds(). Two atoms are bonded if their distance lies
+ * in between (r_1 + r_2 - 0.5) and (r_1 + r_2 + 0.3) where r_i is the covalent radius of atom i.
+ */
+IVW_MODULE_MOLVISBASE_API bool covalentBondHeuristics(Element element1, const dvec3& pos1,
+                                                      Element element2, const dvec3& pos2);
+
+/**
+ * The longest distance between two atoms accepted as a bond by covalentBondHeuristics().
+ */
+IVW_MODULE_MOLVISBASE_API double covalentBondMaxDistance(Element element1, Element element2);
+
 /**
  * Determine covalent bonds based on heuristics. A bond is valid if the distance between two
  * atoms lies in between (r_1 + r_2 - 0.5) and (r_1 + r_2 + 0.3) where r_i is the covalent radius of
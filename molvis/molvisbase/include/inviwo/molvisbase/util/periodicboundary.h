@@ -0,0 +1,134 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+#pragma once
+
+#include <inviwo/molvisbase/molvisbasemoduledefine.h>
+
+#include <inviwo/molvisbase/datastructures/molecularstructure.h>
+#include <inviwo/core/util/glmvec.h>
+#include <inviwo/core/util/glmmat.h>
+
+#include <vector>
+
+namespace inviwo {
+
+namespace molvis {
+
+/**
+ * Periodic images of a set of atoms. All atom attributes of an image are copied from its source
+ * atom, i.e. the atom of the original set it was created from.
+ */
+struct IVW_MODULE_MOLVISBASE_API PeriodicImages {
+    Atoms atoms;
+    std::vector<size_t> sourceIndices;  //!< index of the source atom of each image
+};
+
+/**
+ * A covalent bond across periodic boundaries. The bond connects atom @p first with the image of
+ * atom @p second that is shifted by @p image unit cells.
+ */
+struct IVW_MODULE_MOLVISBASE_API PeriodicBond {
+    size_t first;
+    size_t second;
+    ivec3 image;
+};
+
+/**
+ * Duplicates atoms lying within @p margin of a face of the unit cell so that they show up on both
+ * sides of the cell. Atom positions are given in fractional coordinates, the unit cell being the
+ * unit cube. An atom is shifted by -1, 0, or 1 cell along each axis and every shifted position
+ * within [-margin, 1 + margin] is kept. Positions outside the extended cell are dropped.
+ *
+ * @param atoms   atoms with positions in fractional coordinates
+ * @param margin  fraction of the cell, all atoms are returned unchanged if margin <= 0
+ * @return atom images in fractional coordinates
+ */
+IVW_MODULE_MOLVISBASE_API PeriodicImages replicateMargins(const Atoms& atoms, double margin);
+
+/**
+ * Creates a supercell by repeating the unit cell @p repeats times along each axis. Atom positions
+ * are given in fractional coordinates and remain relative to the unit cell, that is the positions
+ * of the supercell range from 0 to @p repeats. The atoms of the first cell come first followed by
+ * the other cells in x, y, z order.
+ *
+ * @param atoms    atoms with positions in fractional coordinates
+ * @param repeats  number of cells along each axis
+ * @return atom images in fractional coordinates
+ * @throws Exception if any of the repeats is 0
+ */
+IVW_MODULE_MOLVISBASE_API PeriodicImages expandSupercell(const Atoms& atoms,
+                                                         const size3_t& repeats);
+
+/**
+ * Determine covalent bonds of atoms given in fractional coordinates of the unit cell @p cell.
+ * Distances are measured in Cartesian coordinates, periodic boundaries are not considered.
+ *
+ * @param atoms  requires only atom positions (fractional) and atomic numbers
+ * @param cell   basis of the unit cell, the columns are the lattice vectors
+ * @return list of covalent bonds
+ * @throws Exception if sizes of positions and atomic numbers do not match
+ * @see computeCovalentBonds(const Atoms&)
+ */
+IVW_MODULE_MOLVISBASE_API std::vector<Bond> computeCovalentBonds(const Atoms& atoms,
+                                                                 const dmat3& cell);
+
+/**
+ * Determine covalent bonds in a periodic crystal using the same heuristics as
+ * computeCovalentBonds(). Atoms are given in fractional coordinates of the unit cell @p cell and
+ * bonds are found between all periodic images of the atoms. In cells wider than twice the bond
+ * length along each axis this corresponds to the minimum image convention. In smaller cells an
+ * atom may bond to several images of another atom, or to images of itself, and each of those is
+ * reported as a separate bond. Each bond is reported once.
+ *
+ * @param atoms  requires only atom positions (fractional) and atomic numbers
+ * @param cell   basis of the unit cell, the columns are the lattice vectors
+ * @return list of bonds, the image shift is relative to the given, possibly unwrapped, positions
+ * @throws Exception if sizes of positions and atomic numbers do not match, or if the cell is
+ *         degenerate
+ */
+IVW_MODULE_MOLVISBASE_API std::vector<PeriodicBond> computePeriodicCovalentBonds(
+    const Atoms& atoms, const dmat3& cell);
+
+/**
+ * Maps periodic bonds onto periodic images of the same atoms, for example the result of
+ * replicateMargins() or expandSupercell(). Two images are bonded if their source atoms form one of
+ * the @p bonds and the images are shifted relative to each other by the image shift of that bond.
+ * Bonds to images that are not part of @p images are dropped.
+ *
+ * @param atoms   the source atoms, in fractional coordinates
+ * @param images  periodic images of @p atoms, in fractional coordinates
+ * @param bonds   periodic bonds of @p atoms, see computePeriodicCovalentBonds()
+ * @return bonds between the atoms of @p images
+ */
+IVW_MODULE_MOLVISBASE_API std::vector<Bond> computeImageBonds(
+    const Atoms& atoms, const PeriodicImages& images, const std::vector<PeriodicBond>& bonds);
+
+}  // namespace molvis
+
+}  // namespace inviwo
@@ -54,18 +54,6 @@ T square(T a) {
     return a * a;
 }
 
-bool covalentBondHeuristics(Element element1, const dvec3& pos1, Element element2,
-                            const dvec3& pos2) {
-    const dvec3 delta{pos2 - pos1};
-    const double distSq = glm::dot(delta, delta);
-
-    const double covalentDist =
-        element::covalentRadius(element1) + element::covalentRadius(element2);
-    const double dMinSq = square(covalentDist - 0.5);
-    const double dMaxSq = square(covalentDist + 0.3);
-    return (dMinSq < distSq) && (distSq < dMaxSq);
-}
-
 template <typename T, typename Pred>
 auto find_if_opt(T& cont, Pred pred) -> std::optional<typename T::value_type> {
     using std::begin;
@@ -81,6 +69,29 @@ auto find_if_opt(T& cont, Pred pred) -> std::optional<typename T::value_type> {
 
 }  // namespace
 
+bool formsCovalentBonds(Element element) {
+    const std::array<Element, 6> nobleGases = {Element::He, Element::Ne, Element::Ar,
+                                               Element::Kr, Element::Xe, Element::Rn};
+    return !element::isMetallic(element) &&
+           std::find(nobleGases.begin(), nobleGases.end(), element) == nobleGases.end();
+}
+
+bool covalentBondHeuristics(Element element1, const dvec3& pos1, Element element2,
+                            const dvec3& pos2) {
+    const dvec3 delta{pos2 - pos1};
+    const double distSq = glm::dot(delta, delta);
+
+    const double covalentDist =
+        element::covalentRadius(element1) + element::covalentRadius(element2);
+    const double dMinSq = square(covalentDist - 0.5);
+    const double dMaxSq = square(covalentDist + 0.3);
+    return (dMinSq < distSq) && (distSq < dMaxSq);
+}
+
+double covalentBondMaxDistance(Element element1, Element element2) {
+    return element::covalentRadius(element1) + element::covalentRadius(element2) + 0.3;
+}
+
 std::optional<Residue> findResidue(const MolecularData& data, int residueId, int chainId) {
     return find_if_opt(data.residues,
                        [&](auto& r) { return (r.id == residueId) && (r.chainId == chainId); });
@@ -189,17 +200,9 @@ std::vector<Bond> computeCovalentBonds(const Atoms& atoms) {
                                       atoms.atomicNumbers[atom2], atoms.positions[atom2]);
     };
 
-    auto isNobleGas = [](Element symbol) {
-        const std::array<Element, 6> nobleGases = {Element::He, Element::Ne, Element::Ar,
-                                                   Element::Kr, Element::Xe, Element::Rn};
-        return std::find(nobleGases.begin(), nobleGases.end(), symbol) != nobleGases.end();
-    };
-
     std::vector<Bond> bonds;
     for (auto&& [atom1, pos] : util::enumerate(atoms.positions)) {
-        if (element::isMetallic(atoms.atomicNumbers[atom1]) ||
-            isNobleGas(atoms.atomicNumbers[atom1]))
-            continue;
+        if (!formsCovalentBonds(atoms.atomicNumbers[atom1])) continue;
 
         const auto minCell = cellCoord(pos - maxCovalentBondLength);
         const auto maxCell = cellCoord(pos + maxCovalentBondLength);
@@ -0,0 +1,287 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/molvisbase/util/periodicboundary.h>
+#include <inviwo/molvisbase/util/molvisutils.h>
+#include <inviwo/molvisbase/util/atomicelement.h>
+#include <inviwo/core/util/exception.h>
+#include <inviwo/core/util/indexmapper.h>
+#include <inviwo/core/util/stdextensions.h>
+#include <inviwo/core/util/zip.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <map>
+#include <numeric>
+#include <optional>
+#include <tuple>
+
+namespace inviwo {
+
+namespace molvis {
+
+namespace {
+
+template <typename T>
+std::vector<T> gather(const std::vector<T>& src, const std::vector<size_t>& indices) {
+    if (src.empty()) return {};
+    std::vector<T> dst;
+    dst.reserve(indices.size());
+    for (auto i : indices) {
+        dst.push_back(src[i]);
+    }
+    return dst;
+}
+
+PeriodicImages createImages(const Atoms& atoms, std::vector<dvec3> positions,
+                            std::vector<size_t> sourceIndices) {
+    PeriodicImages images;
+    images.atoms.positions = std::move(positions);
+    images.atoms.serialNumbers = gather(atoms.serialNumbers, sourceIndices);
+    images.atoms.bFactors = gather(atoms.bFactors, sourceIndices);
+    images.atoms.modelIds = gather(atoms.modelIds, sourceIndices);
+    images.atoms.chainIds = gather(atoms.chainIds, sourceIndices);
+    images.atoms.residueIds = gather(atoms.residueIds, sourceIndices);
+    images.atoms.atomicNumbers = gather(atoms.atomicNumbers, sourceIndices);
+    images.atoms.fullNames = gather(atoms.fullNames, sourceIndices);
+    images.sourceIndices = std::move(sourceIndices);
+    return images;
+}
+
+void checkAtomicNumbers(const Atoms& atoms) {
+    if (atoms.positions.size() != atoms.atomicNumbers.size()) {
+        throw Exception(SourceContext{},
+                        "Number of atoms ({}) does not match size of atomic numbers ({})",
+                        atoms.positions.size(), atoms.atomicNumbers.size());
+    }
+}
+
+// integer division rounding towards negative infinity
+int floorDiv(int a, int b) { return a / b - (a % b != 0 && (a < 0) != (b < 0) ? 1 : 0); }
+
+}  // namespace
+
+PeriodicImages replicateMargins(const Atoms& atoms, double margin) {
+    std::vector<size_t> sourceIndices(atoms.positions.size());
+    std::iota(sourceIndices.begin(), sourceIndices.end(), size_t{0});
+    if (margin <= 0.0) {
+        return createImages(atoms, atoms.positions, std::move(sourceIndices));
+    }
+
+    sourceIndices.clear();
+    std::vector<dvec3> positions;
+    positions.reserve(atoms.positions.size());
+    sourceIndices.reserve(atoms.positions.size());
+
+    for (auto&& [i, pos] : util::enumerate(atoms.positions)) {
+        // The shifted coordinates within the extended cell, determined separately for each axis.
+        // An image is created for every combination of them.
+        std::array<std::array<double, 3>, 3> coords{};
+        std::array<size_t, 3> counts{};
+        for (glm::length_t axis = 0; axis < 3; ++axis) {
+            for (const double shift : {-1.0, 0.0, 1.0}) {
+                const double x = pos[axis] + shift;
+                if (x > -margin && x < 1.0 + margin) {
+                    coords[axis][counts[axis]++] = x;
+                }
+            }
+        }
+        for (size_t ix = 0; ix < counts[0]; ++ix) {
+            for (size_t iy = 0; iy < counts[1]; ++iy) {
+                for (size_t iz = 0; iz < counts[2]; ++iz) {
+                    positions.emplace_back(coords[0][ix], coords[1][iy], coords[2][iz]);
+                    sourceIndices.push_back(i);
+                }
+            }
+        }
+    }
+    return createImages(atoms, std::move(positions), std::move(sourceIndices));
+}
+
+PeriodicImages expandSupercell(const Atoms& atoms, const size3_t& repeats) {
+    if (glm::any(glm::equal(repeats, size3_t{0}))) {
+        throw Exception(SourceContext{}, "Invalid supercell size ({}, {}, {})", repeats.x,
+                        repeats.y, repeats.z);
+    }
+
+    const size_t count = atoms.positions.size() * glm::compMul(repeats);
+    std::vector<dvec3> positions;
+    std::vector<size_t> sourceIndices;
+    positions.reserve(count);
+    sourceIndices.reserve(count);
+
+    for (size_t z = 0; z < repeats.z; ++z) {
+        for (size_t y = 0; y < repeats.y; ++y) {
+            for (size_t x = 0; x < repeats.x; ++x) {
+                const dvec3 shift{x, y, z};
+                for (auto&& [i, pos] : util::enumerate(atoms.positions)) {
+                    positions.push_back(pos + shift);
+                    sourceIndices.push_back(i);
+                }
+            }
+        }
+    }
+    return createImages(atoms, std::move(positions), std::move(sourceIndices));
+}
+
+std::vector<Bond> computeCovalentBonds(const Atoms& atoms, const dmat3& cell) {
+    checkAtomicNumbers(atoms);
+
+    Atoms cartesian;
+    cartesian.positions =
+        util::transform(atoms.positions, [&](const dvec3& p) { return cell * p; });
+    cartesian.atomicNumbers = atoms.atomicNumbers;
+    return computeCovalentBonds(cartesian);
+}
+
+std::vector<PeriodicBond> computePeriodicCovalentBonds(const Atoms& atoms, const dmat3& cell) {
+    if (atoms.positions.empty()) return {};
+    checkAtomicNumbers(atoms);
+
+    const double volume = std::abs(glm::determinant(cell));
+    if (volume < std::numeric_limits<double>::epsilon()) {
+        throw Exception(SourceContext{}, "Degenerate unit cell, volume is {}", volume);
+    }
+
+    // The element with the largest covalent radius bounds the length of all bonds
+    std::optional<Element> largest;
+    for (auto elem : atoms.atomicNumbers) {
+        if (formsCovalentBonds(elem) &&
+            (!largest || element::covalentRadius(elem) > element::covalentRadius(*largest))) {
+            largest = elem;
+        }
+    }
+    if (!largest) return {};
+    const double maxBondLength = covalentBondMaxDistance(*largest, *largest);
+
+    // Bin the atoms, wrapped into the unit cell, into a grid whose bins are at least as wide as
+    // the longest possible bond. The width of the cell along an axis is its extent perpendicular
+    // to the plane spanned by the other two lattice vectors.
+    ivec3 bins{1};
+    ivec3 range{1};
+    for (glm::length_t axis = 0; axis < 3; ++axis) {
+        const double width =
+            volume / glm::length(glm::cross(cell[(axis + 1) % 3], cell[(axis + 2) % 3]));
+        bins[axis] = std::max(1, static_cast<int>(width / maxBondLength));
+        // bins to search in each direction, more than one if the cell is smaller than a bond
+        range[axis] = static_cast<int>(std::ceil(maxBondLength / (width / bins[axis])));
+    }
+
+    std::vector<dvec3> wrapped(atoms.positions.size());
+    std::vector<ivec3> cellOffsets(atoms.positions.size());
+    std::vector<ivec3> binCoords(atoms.positions.size());
+    util::IndexMapper3D im(size3_t{bins});
+    std::vector<std::vector<size_t>> binData(glm::compMul(size3_t{bins}));
+
+    for (auto&& [i, pos] : util::enumerate(atoms.positions)) {
+        if (!formsCovalentBonds(atoms.atomicNumbers[i])) continue;
+
+        const dvec3 offset{glm::floor(pos)};
+        cellOffsets[i] = ivec3{offset};
+        wrapped[i] = pos - offset;
+        binCoords[i] = glm::clamp(ivec3{wrapped[i] * dvec3{bins}}, ivec3{0}, bins - 1);
+        binData[im(size3_t{binCoords[i]})].push_back(i);
+    }
+
+    auto positive = [](const ivec3& v) {
+        return v.x > 0 || (v.x == 0 && (v.y > 0 || (v.y == 0 && v.z > 0)));
+    };
+
+    std::vector<PeriodicBond> bonds;
+    for (auto&& [atom1, elem1] : util::enumerate(atoms.atomicNumbers)) {
+        if (!formsCovalentBonds(elem1)) continue;
+
+        const auto& pos1 = wrapped[atom1];
+
+        for (int z = -range.z; z <= range.z; ++z) {
+            for (int y = -range.y; y <= range.y; ++y) {
+                for (int x = -range.x; x <= range.x; ++x) {
+                    const ivec3 bin = binCoords[atom1] + ivec3{x, y, z};
+                    const ivec3 shift{floorDiv(bin.x, bins.x), floorDiv(bin.y, bins.y),
+                                      floorDiv(bin.z, bins.z)};
+                    const ivec3 target = bin - shift * bins;
+
+                    for (auto atom2 : binData[im(size3_t{target})]) {
+                        // report each bond once, bonds to the image of the atom itself only for
+                        // one of the two opposite shifts
+                        if (atom2 < atom1 || (atom2 == atom1 && !positive(shift))) continue;
+
+                        const dvec3 delta = cell * (wrapped[atom2] + dvec3{shift} - pos1);
+                        if (covalentBondHeuristics(elem1, dvec3{0.0},
+                                                   atoms.atomicNumbers[atom2], delta)) {
+                            bonds.push_back(
+                                {atom1, atom2, shift + cellOffsets[atom1] - cellOffsets[atom2]});
+                        }
+                    }
+                }
+            }
+        }
+    }
+    return bonds;
+}
+
+std::vector<Bond> computeImageBonds(const Atoms& atoms, const PeriodicImages& images,
+                                    const std::vector<PeriodicBond>& bonds) {
+    if (images.atoms.positions.size() != images.sourceIndices.size()) {
+        throw Exception(SourceContext{},
+                        "Number of images ({}) does not match size of source indices ({})",
+                        images.atoms.positions.size(), images.sourceIndices.size());
+    }
+
+    // Images by source atom and cell shift relative to the source atom
+    using Key = std::tuple<size_t, int, int, int>;
+    std::map<Key, size_t> imageIndex;
+    std::vector<ivec3> imageShifts(images.sourceIndices.size());
+    for (auto&& [i, source] : util::enumerate(images.sourceIndices)) {
+        const auto shift = ivec3{glm::round(images.atoms.positions[i] - atoms.positions[source])};
+        imageShifts[i] = shift;
+        imageIndex.emplace(Key{source, shift.x, shift.y, shift.z}, i);
+    }
+
+    std::vector<std::vector<const PeriodicBond*>> bondsOf(atoms.positions.size());
+    for (const auto& bond : bonds) bondsOf[bond.first].push_back(&bond);
+
+    std::vector<Bond> imageBonds;
+    for (auto&& [i, source] : util::enumerate(images.sourceIndices)) {
+        for (const auto* bond : bondsOf[source]) {
+            const auto shift = imageShifts[i] + bond->image;
+            if (auto it = imageIndex.find(Key{bond->second, shift.x, shift.y, shift.z});
+                it != imageIndex.end()) {
+                imageBonds.emplace_back(i, it->second);
+            }
+        }
+    }
+    return imageBonds;
+}
+
+}  // namespace molvis
+
+}  // namespace inviwo
@@ -0,0 +1,174 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <inviwo/molvisbase/util/periodicboundary.h>
+#include <inviwo/core/util/exception.h>
+#include <inviwo/core/util/zip.h>
+
+#include <algorithm>
+#include <numeric>
+
+namespace inviwo {
+
+namespace {
+
+molvis::Atoms makeAtoms(std::vector<dvec3> positions, std::vector<Element> elements) {
+    molvis::Atoms atoms;
+    atoms.positions = std::move(positions);
+    atoms.atomicNumbers = std::move(elements);
+    atoms.serialNumbers.resize(atoms.positions.size());
+    std::iota(atoms.serialNumbers.begin(), atoms.serialNumbers.end(), 1);
+    return atoms;
+}
+
+}  // namespace
+
+TEST(PeriodicBoundary, ReplicateMargins) {
+    const auto atoms = makeAtoms({{0.5, 0.5, 0.5}, {0.02, 0.5, 0.5}, {0.01, 0.99, 0.5}},
+                                 {Element::C, Element::O, Element::H});
+
+    const auto images = molvis::replicateMargins(atoms, 0.05);
+    // center atom once, face atom twice, edge atom four times
+    ASSERT_EQ(images.atoms.positions.size(), 7u);
+    ASSERT_EQ(images.sourceIndices.size(), 7u);
+    EXPECT_EQ(std::count(images.sourceIndices.begin(), images.sourceIndices.end(), 1u), 2);
+    EXPECT_EQ(std::count(images.sourceIndices.begin(), images.sourceIndices.end(), 2u), 4);
+
+    for (auto&& [pos, src, serial, elem] :
+         util::zip(images.atoms.positions, images.sourceIndices, images.atoms.serialNumbers,
+                   images.atoms.atomicNumbers)) {
+        EXPECT_EQ(serial, atoms.serialNumbers[src]);
+        EXPECT_EQ(elem, atoms.atomicNumbers[src]);
+        const dvec3 shift = pos - atoms.positions[src];
+        EXPECT_EQ(shift, glm::round(shift));
+        EXPECT_TRUE(glm::all(glm::greaterThan(pos, dvec3{-0.05})));
+        EXPECT_TRUE(glm::all(glm::lessThan(pos, dvec3{1.05})));
+    }
+    EXPECT_TRUE(images.atoms.bFactors.empty());
+
+    const auto unchanged = molvis::replicateMargins(atoms, 0.0);
+    EXPECT_EQ(unchanged.atoms.positions, atoms.positions);
+}
+
+TEST(PeriodicBoundary, ExpandSupercell) {
+    const auto atoms = makeAtoms({{0.25, 0.5, 0.5}, {0.75, 0.5, 0.5}}, {Element::C, Element::C});
+
+    const auto images = molvis::expandSupercell(atoms, size3_t{3, 2, 1});
+    ASSERT_EQ(images.atoms.positions.size(), 12u);
+    EXPECT_EQ(images.atoms.positions[0], atoms.positions[0]);
+    EXPECT_EQ(images.atoms.positions[3], atoms.positions[1] + dvec3{1, 0, 0});
+    EXPECT_EQ(images.atoms.positions[11], atoms.positions[1] + dvec3{2, 1, 0});
+    EXPECT_EQ(images.sourceIndices[11], 1u);
+
+    EXPECT_THROW(molvis::expandSupercell(atoms, size3_t{1, 0, 1}), Exception);
+}
+
+TEST(PeriodicBoundary, CartesianBonds) {
+    // 1.54 Å C-C bond in a 10 Å cubic cell
+    const dmat3 cell{10.0};
+    const auto atoms = makeAtoms({{0.4, 0.5, 0.5}, {0.554, 0.5, 0.5}}, {Element::C, Element::C});
+
+    const auto bonds = molvis::computeCovalentBonds(atoms, cell);
+    ASSERT_EQ(bonds.size(), 1u);
+    EXPECT_EQ(bonds[0], molvis::Bond(0, 1));
+}
+
+TEST(PeriodicBoundary, BondsAcrossBoundary) {
+    const dmat3 cell{10.0};
+    // both atoms 0.77 Å from the cell face at x = 0
+    const auto atoms = makeAtoms({{0.077, 0.5, 0.5}, {0.923, 0.5, 0.5}, {0.5, 0.5, 0.5}},
+                                 {Element::C, Element::C, Element::C});
+
+    EXPECT_TRUE(molvis::computeCovalentBonds(atoms, cell).empty());
+
+    const auto bonds = molvis::computePeriodicCovalentBonds(atoms, cell);
+    ASSERT_EQ(bonds.size(), 1u);
+    EXPECT_EQ(bonds[0].first, 0u);
+    EXPECT_EQ(bonds[0].second, 1u);
+    EXPECT_EQ(bonds[0].image, ivec3(-1, 0, 0));
+
+    // the shift refers to the given, unwrapped, positions
+    auto shifted = atoms;
+    shifted.positions[1] -= dvec3{1.0, 0.0, 0.0};
+    const auto shiftedBonds = molvis::computePeriodicCovalentBonds(shifted, cell);
+    ASSERT_EQ(shiftedBonds.size(), 1u);
+    EXPECT_EQ(shiftedBonds[0].image, ivec3(0, 0, 0));
+}
+
+TEST(PeriodicBoundary, BondsInSmallCell) {
+    // a chain of carbon atoms, one atom per 1.5 Å cell, bonds to both neighboring images
+    const dmat3 cell{dvec3{1.5, 0.0, 0.0}, dvec3{0.0, 10.0, 0.0}, dvec3{0.0, 0.0, 10.0}};
+    const auto atoms = makeAtoms({{0.0, 0.5, 0.5}}, {Element::C});
+
+    const auto bonds = molvis::computePeriodicCovalentBonds(atoms, cell);
+    ASSERT_EQ(bonds.size(), 1u);
+    EXPECT_EQ(bonds[0].first, 0u);
+    EXPECT_EQ(bonds[0].second, 0u);
+    EXPECT_EQ(bonds[0].image, ivec3(1, 0, 0));
+
+    EXPECT_THROW(molvis::computePeriodicCovalentBonds(atoms, dmat3{0.0}), Exception);
+}
+
+TEST(PeriodicBoundary, ImageBonds) {
+    const dmat3 cell{10.0};
+    const auto atoms = makeAtoms({{0.077, 0.5, 0.5}, {0.923, 0.5, 0.5}, {0.5, 0.5, 0.5}},
+                                 {Element::C, Element::C, Element::C});
+    const auto bonds = molvis::computePeriodicCovalentBonds(atoms, cell);
+    const auto images = molvis::replicateMargins(atoms, 0.1);
+    ASSERT_EQ(images.atoms.positions.size(), 5u);
+
+    auto find = [&](const dvec3& pos) {
+        const auto it = std::find_if(
+            images.atoms.positions.begin(), images.atoms.positions.end(),
+            [&](const dvec3& p) { return glm::distance(p, pos) < 1e-9; });
+        return static_cast<size_t>(std::distance(images.atoms.positions.begin(), it));
+    };
+
+    auto ordered = [](size_t a, size_t b) { return molvis::Bond{std::min(a, b), std::max(a, b)}; };
+
+    // both atoms next to the face at x = 0 are bonded to the image on the other side
+    auto imageBonds = molvis::computeImageBonds(atoms, images, bonds);
+    for (auto& bond : imageBonds) bond = ordered(bond.first, bond.second);
+    std::sort(imageBonds.begin(), imageBonds.end());
+    std::vector<molvis::Bond> expected{ordered(find({0.077, 0.5, 0.5}), find({-0.077, 0.5, 0.5})),
+                                       ordered(find({1.077, 0.5, 0.5}), find({0.923, 0.5, 0.5}))};
+    std::sort(expected.begin(), expected.end());
+    EXPECT_EQ(imageBonds, expected);
+
+    // without images across the boundary there is nothing to bond to
+    EXPECT_TRUE(
+        molvis::computeImageBonds(atoms, molvis::replicateMargins(atoms, 0.0), bonds).empty());
+}
+
+}  // namespace inviwo
@@ -33,12 +33,15 @@
 #include <pybind11/functional.h>
 #include <pybind11/stl.h>
 #include <pybind11/stl_bind.h>
+#include <pybind11/numpy.h>
 
 #include <inviwo/core/datastructures/geometry/mesh.h>
+#include <inviwo/core/util/exception.h>
 
 #include <inviwo/molvisbase/datastructures/molecularstructure.h>
 #include <inviwo/molvisbase/datastructures/molecularstructuretraits.h>
 #include <inviwo/molvisbase/util/molvisutils.h>
+#include <inviwo/molvisbase/util/periodicboundary.h>
 #include <inviwo/molvisbase/util/atomicelement.h>
 #include <inviwo/molvisbase/util/aminoacid.h>
 #include <inviwo/molvisbase/util/chain.h>
@@ -315,7 +318,24 @@ void exposeMolVisUtil(pybind11::module& m) {
         .def("findChainId", &findChain, py::arg("data"), py::arg("chainId"))
         .def("getGlobalAtomIndex", &getGlobalAtomIndex, py::arg("atoms"), py::arg("fullAtomName"),
              py::arg("residueId"), py::arg("chainId"))
-        .def("computeCovalentBonds", &computeCovalentBonds, py::arg("atoms"))
+        .def("computeCovalentBonds", py::overload_cast<const Atoms&>(&computeCovalentBonds),
+             py::arg("atoms"))
+        .def(
+            "computeCovalentBonds",
+            [](const Atoms& atoms, const mat3& basis) {
+                return computeCovalentBonds(atoms, dmat3{basis});
+            },
+            py::arg("atoms"), py::arg("basis"))
+        .def(
+            "computePeriodicCovalentBonds",
+            [](const Atoms& atoms, const mat3& basis) {
+                return computePeriodicCovalentBonds(atoms, dmat3{basis});
+            },
+            py::arg("atoms"), py::arg("basis"))
+        .def("replicateMargins", &replicateMargins, py::arg("atoms"), py::arg("margin"))
+        .def("expandSupercell", &expandSupercell, py::arg("atoms"), py::arg("repeats"))
+        .def("computeImageBonds", &computeImageBonds, py::arg("atoms"), py::arg("images"),
+             py::arg("bonds"))
         .def("getAtomicNumbers", &getAtomicNumbers, py::arg("fullNames"))
         .def("createMesh", &createMesh, py::arg("structure"), py::arg("enablePicking") = false,
              py::arg("globalStartId") = 0);
@@ -345,6 +365,16 @@ void exposeMolVis(pybind11::module& m) {
         .def_readwrite("residueids", &Atoms::residueIds)
         .def_readwrite("atomicnumbers", &Atoms::atomicNumbers)
         .def_readwrite("fullnames", &Atoms::fullNames)
+        .def("setPositionArray",
+             [](Atoms& a, py::array_t<double, py::array::c_style | py::array::forcecast> arr) {
+                 // sets all positions from an N x 3 array, avoids creating a dvec3 per atom
+                 if (arr.ndim() != 2 || arr.shape(1) != 3) {
+                     throw Exception(SourceContext{}, "Expected an N x 3 array of positions");
+                 }
+                 a.positions.resize(static_cast<size_t>(arr.shape(0)));
+                 std::copy_n(arr.data(), a.positions.size() * 3,
+                             reinterpret_cast<double*>(a.positions.data()));
+             })
         .def("__len__", [](Atoms& a) { return a.positions.size(); })
         .def("__repr__", [](Atoms& a) {
             return fmt::format(
@@ -355,6 +385,35 @@ void exposeMolVis(pybind11::module& m) {
                 a.chainIds.size(), a.residueIds.size(), a.atomicNumbers.size(), a.fullNames.size());
         });
 
+    py::classh<PeriodicImages>(m, "PeriodicImages")
+        .def(py::init([](Atoms atoms, std::vector<size_t> sourceIndices) -> PeriodicImages {
+                 return {std::move(atoms), std::move(sourceIndices)};
+             }),
+             py::arg("atoms"), py::arg("sourceindices"))
+        .def_readonly("atoms", &PeriodicImages::atoms)
+        .def_readonly("sourceindices", &PeriodicImages::sourceIndices)
+        .def("positionArray",
+             [](const PeriodicImages& p) {
+                 // copy of the positions as N x 3 array, avoids converting each dvec3
+                 py::array_t<double> arr({p.atoms.positions.size(), size_t{3}});
+                 std::copy_n(reinterpret_cast<const double*>(p.atoms.positions.data()),
+                             p.atoms.positions.size() * 3, arr.mutable_data());
+                 return arr;
+             })
+        .def("__len__", [](const PeriodicImages& p) { return p.atoms.positions.size(); })
+        .def("__repr__", [](const PeriodicImages& p) {
+            return fmt::format("<PeriodicImages: {} atom(s)>", p.atoms.positions.size());
+        });
+
+    py::classh<PeriodicBond>(m, "PeriodicBond")
+        .def_readonly("first", &PeriodicBond::first)
+        .def_readonly("second", &PeriodicBond::second)
+        .def_readonly("image", &PeriodicBond::image)
+        .def("__repr__", [](const PeriodicBond& b) {
+            return fmt::format("<PeriodicBond: {} - {} ({}, {}, {})>", b.first, b.second,
+                               b.image.x, b.image.y, b.image.z);
+        });
+
     py::classh<Residue>(m, "Residue")
         .def(py::init())
         .def(py::init([](int id, AminoAcid aminoacid, const std::string& fullname,
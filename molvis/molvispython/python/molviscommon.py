@@ -33,19 +33,46 @@ import ivwmolvis
 
 import ivwmolvis.atomicelement as atomicelement
 
-import itertools
 import numpy
 from typing import List
-from collections.abc import Callable
 
 
-def _adjustMargins(pos, margin: float, func: Callable[[List[float]], None]):
-    if margin > 0.0:
-        for shift in itertools.product([-1, 0, 1], repeat=3):
-            if all([x + s > -margin and x + s < 1 + margin for s, x in zip(shift, pos)]):
-                func([x + s for s, x in zip(shift, pos)])
-    else:
-        func(pos)
+def _createAtoms(pos, elements: List[atomicelement.element]):
+    """
+    Atoms with the given positions, passed to the native side as one N x 3 array, and elements.
+    """
+    atoms = ivwmolvis.Atoms()
+    atoms.setPositionArray(numpy.asarray(pos, dtype=numpy.float64).reshape(-1, 3))
+    atoms.serialnumbers = ivw.glm.intVector(range(len(elements)))
+    atoms.atomicnumbers = list(elements)
+    return atoms
+
+
+def _createImages(atoms: ivwmolvis.Atoms, margin: float, repeats=(1, 1, 1)):
+    """
+    Replicate the atoms, in fractional coordinates, into a supercell of repeats unit cells and
+    duplicate the ones within margin distance of a face of the supercell. The replication is done
+    natively, see ivwmolvis.util.expandSupercell and ivwmolvis.util.replicateMargins.
+    """
+    repeats = (int(repeats[0]), int(repeats[1]), int(repeats[2]))
+    if repeats == (1, 1, 1):
+        return ivwmolvis.util.replicateMargins(atoms, margin)
+
+    supercell = ivwmolvis.util.expandSupercell(atoms, ivw.glm.size3_t(*repeats))
+    if margin <= 0.0:
+        return supercell
+
+    # The margins are relative to the supercell, replicate in its fractional coordinates
+    scale = numpy.array(repeats, dtype=numpy.float64)
+    supercellSource = numpy.array(supercell.sourceindices, dtype=numpy.uint64)
+    elements = list(atoms.atomicnumbers)
+    scaled = _createAtoms(supercell.positionArray() / scale,
+                          [elements[i] for i in supercellSource])
+    images = ivwmolvis.util.replicateMargins(scaled, margin)
+    source = supercellSource[numpy.array(images.sourceindices, dtype=numpy.uint64)]
+    return ivwmolvis.PeriodicImages(
+        _createAtoms(images.positionArray() * scale, [elements[i] for i in source]),
+        [int(i) for i in source])
 
 
 def createMesh(pos: List[numpy.array],
@@ -54,7 +81,8 @@ def createMesh(pos: List[numpy.array],
                pm: ivw.PickingMapper = None,
                margin: float = 0.0,
                radiusscaling: float = 1.0,
-               colormap: atomicelement.Colormap = atomicelement.Colormap.RasmolCPKnew):
+               colormap: atomicelement.Colormap = atomicelement.Colormap.RasmolCPKnew,
+               repeats=(1, 1, 1)):
     """
     Create a sphere Mesh from a list of 3D positions.
 
@@ -67,31 +95,18 @@ def createMesh(pos: List[numpy.array],
                        of a [0,0,0]-[1,1,1] cube will be duplicated
     :param radiusscaling:  scaling factor for sphere radii
     :param colormap:   colormap
+    :param repeats:    number of unit cells of the supercell along each axis, positions have to be
+                       fractional if larger than one
     :return: inviwopy.data.Mesh
     """
-    position = []
-    color = []
-    radius = []
-    picking = []
-    index = []
-
-    if pm:
-        pm.resize(len(elements))
+    images = _createImages(_createAtoms(pos, elements), margin, repeats)
+    source = numpy.array(images.sourceindices, dtype=numpy.uint32)
 
-    for i, p in enumerate(pos):
-        c = numpy.array(atomicelement.color(elements[i], colormap=colormap))
-        r = atomicelement.vdwRadius(elements[i]) * radiusscaling
-        pi = pm.pickingId(i) if pm else None
-
-        def addVertex(vertexpos):
-            position.append(vertexpos)
-            color.append(c)
-            radius.append(r)
-            if pi:
-                picking.append(pi)
-            index.append(i)
-
-        _adjustMargins(p, margin, addVertex)
+    # per atom attributes, each duplicate uses the ones of its source atom
+    color = numpy.array([atomicelement.color(e, colormap=colormap) for e in elements],
+                        dtype=numpy.float32)
+    radius = numpy.array([atomicelement.vdwRadius(e) * radiusscaling for e in elements],
+                         dtype=numpy.float32)
 
     mesh = ivw.data.Mesh()
     if basis:
@@ -99,16 +114,19 @@ def createMesh(pos: List[numpy.array],
     mesh.offset = ivw.glm.vec3(offset)
 
     mesh.addBuffer(ivw.data.BufferType.PositionAttrib, ivw.data.Buffer(
-        numpy.array(position).astype(numpy.float32)))
+        images.positionArray().astype(numpy.float32)))
     mesh.addBuffer(ivw.data.BufferType.ColorAttrib, ivw.data.Buffer(
-        numpy.array(color).astype(numpy.float32)))
+        numpy.ascontiguousarray(color[source])))
     mesh.addBuffer(ivw.data.BufferType.RadiiAttrib, ivw.data.Buffer(
-        numpy.array(radius).astype(numpy.float32)))
+        numpy.ascontiguousarray(radius[source])))
     if pm:
+        pm.resize(len(elements))
+        picking = numpy.array([pm.pickingId(i) for i in range(len(elements))],
+                              dtype=numpy.uint32)
         mesh.addBuffer(ivw.data.BufferType.PickingAttrib, ivw.data.Buffer(
-            numpy.array(picking).astype(numpy.uint32)))
+            numpy.ascontiguousarray(picking[source])))
     mesh.addBuffer(ivw.data.BufferType.IndexAttrib, ivw.data.Buffer(
-        numpy.array(index).astype(numpy.uint32)))
+        numpy.arange(len(source), dtype=numpy.uint32)))
     return mesh
 
 
@@ -116,37 +134,34 @@ def createMolecularStructure(pos: List[numpy.array],
                              elements: List[atomicelement.element],
                              margin: float = 0.0,
                              basis: ivw.glm.mat3 = None,
-                             offset: ivw.glm.vec3 = ivw.glm.vec3(0, 0, 0)):
+                             offset: ivw.glm.vec3 = ivw.glm.vec3(0, 0, 0),
+                             periodic: bool = False,
+                             repeats=(1, 1, 1)):
     """
     Create a molecular representation from a list of 3D positions.
 
-    :param pos:        list of 3D positions
+    :param pos:        list of 3D positions, in fractional coordinates if a basis is given
     :param elements:   atomic elements matching each position
     :param margin:     if larger than 0, positions within margin distance to a boundingbox surface
                        of a [0,0,0]-[1,1,1] cube will be duplicated
+    :param basis:      basis of the unit cell, bond lengths are measured in the spanned space
     :param offset:     offset of the created mesh
+    :param periodic:   if a basis is given, treat the unit cell as periodic and also create bonds
+                       across its boundary, see ivwmolvis.util.computePeriodicCovalentBonds
+    :param repeats:    number of unit cells of the supercell along each axis
     :return: ivwmolvis.MolecularStructure
     """
-
-    positions: ivw.glm.dvec3Vector = ivw.glm.dvec3Vector()
-    serialnumbers: ivw.glm.intVector = ivw.glm.intVector()
-    atomicnumbers: list = []
-    for i, p in enumerate(pos):
-        element = elements[i]
-
-        def addAtom(atompos):
-            positions.append(ivw.glm.dvec3(atompos))
-            serialnumbers.append(i)
-            atomicnumbers.append(element)
-
-        _adjustMargins(p, margin, addAtom)
-
-    atoms = ivwmolvis.Atoms()
-    atoms.positions = positions
-    atoms.serialnumbers = serialnumbers
-    atoms.atomicnumbers = atomicnumbers
-    bonds = ivwmolvis.util.computeCovalentBonds(atoms)
-    ms = ivwmolvis.MolecularStructure(ivwmolvis.MolecularData(source="chgcar_file", atoms=atoms,
+    atoms = _createAtoms(pos, elements)
+    images = _createImages(atoms, margin, repeats)
+    if basis and periodic:
+        periodicBonds = ivwmolvis.util.computePeriodicCovalentBonds(atoms, ivw.glm.mat3(basis))
+        bonds = ivwmolvis.util.computeImageBonds(atoms, images, periodicBonds)
+    elif basis:
+        bonds = ivwmolvis.util.computeCovalentBonds(images.atoms, ivw.glm.mat3(basis))
+    else:
+        bonds = ivwmolvis.util.computeCovalentBonds(images.atoms)
+    ms = ivwmolvis.MolecularStructure(ivwmolvis.MolecularData(source="chgcar_file",
+                                                              atoms=images.atoms,
                                                               residues=[], chains=[],
                                                               bonds=bonds))
     if basis:
@@ -106,6 +106,10 @@ class ChgcarSource(ivw.Processor):
             max=(0.5, ivw.properties.ConstraintBehavior.Editable), increment=0.01)
         self.addProperty(self.margin)
 
+        self.supercell = ivw.properties.IntVec3Property(
+            "supercell", "Supercell", ivw.glm.ivec3(1), ivw.glm.ivec3(1), ivw.glm.ivec3(10))
+        self.addProperty(self.supercell)
+
         self.radiusScaling = ivw.properties.FloatProperty(
             "radiusScaling", "Radius Scaling", 0.25, 0.0, 2.0, 0.01)
         self.addProperty(self.radiusScaling)
@@ -183,7 +187,8 @@ Loads CHGCAR files stemming from [VASP](https://www.vasp.at) calculations.
             basis=self.volume.basis, offset=self.volume.offset,
             pm=self.pm, margin=self.margin.value,
             radiusscaling=self.radiusScaling.value,
-            colormap=ivwmolvis.atomicelement.Colormap(self.colormap.value)
+            colormap=ivwmolvis.atomicelement.Colormap(self.colormap.value),
+            repeats=self.supercell.value
         )
 
         self.dataframe = molviscommon.createDataFrame(pos=self.atomPos, elements=self.atomTypes,
@@ -192,7 +197,8 @@ Loads CHGCAR files stemming from [VASP](https://www.vasp.at) calculations.
         offset = ivw.glm.dvec3(self.volume.offset) if self.centerData.value else ivw.glm.dvec3(0)
         self.molecule = molviscommon.createMolecularStructure(
             pos=self.atomPos, elements=self.atomTypes, margin=self.margin.value,
-            basis=self.volume.basis, offset=offset)
+            basis=self.volume.basis, offset=offset, periodic=True,
+            repeats=self.supercell.value)
 
         self.volumeOutport.setData(self.volume)
         self.meshOutport.setData(self.mesh)
@@ -0,0 +1,88 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+#pragma once
+
+#include <inviwo/tensorvisbase/tensorvisbasemoduledefine.h>
+#include <inviwo/tensorvisbase/datastructures/tensorfield2d.h>
+#include <inviwo/core/common/inviwo.h>
+
+#include <cstdint>
+#include <memory>
+
+namespace inviwo {
+
+class Layer;
+
+namespace tensorutil {
+
+struct IVW_MODULE_TENSORVISBASE_API HyperLICSettings {
+    /// Size of the output layer, zero uses the dimensions of the tensor field
+    size2_t dimensions{0};
+    /// Half length of the box kernel in integration steps, the full kernel is 2L + 1 steps
+    size_t kernelLength = 20;
+    /// Steps traced in each direction per streamline, at least the kernel length. Longer
+    /// streamlines are shared by more pixels, which reduces the number of lines to trace.
+    size_t streamlineLength = 60;
+    /// Integration step length in output pixels
+    double stepLength = 0.5;
+    /// Follow the minor instead of the major eigenvectors
+    bool minor = false;
+    /// Edge length of the square tiles that are distributed over the thread pool
+    size_t tileSize = 64;
+    /// Number of parallel jobs on the thread pool, zero uses the pool default
+    size_t threads = 0;
+    /// Seed of the white noise that is convolved
+    std::uint32_t seed = 0;
+    /// Value of pixels where the tensor field vanishes
+    float background = 0.0f;
+};
+
+struct IVW_MODULE_TENSORVISBASE_API HyperLICStats {
+    size_t streamlines = 0;
+    size_t samples = 0;
+};
+
+/**
+ * Line integral convolution of white noise along the major or minor eigenvector field of a 2D
+ * tensor field, computed on the CPU. The output is split into tiles that are processed in
+ * parallel. Following FastLIC, every traced streamline is longer than the kernel and its
+ * convolution is evaluated incrementally at all of its samples, so a single line provides values
+ * for all pixels it passes through. A pixel is only seeded if no earlier streamline of its tile
+ * covered it. Streamlines only write to pixels of their own tile, which keeps the result
+ * independent of the number of threads.
+ *
+ * @return a single channel float layer covering the extent of the tensor field
+ */
+IVW_MODULE_TENSORVISBASE_API std::shared_ptr<Layer> hyperLIC(const TensorField2D& tensorField,
+                                                             const HyperLICSettings& settings,
+                                                             HyperLICStats* stats = nullptr);
+
+}  // namespace tensorutil
+
+}  // namespace inviwo
@@ -46,6 +46,39 @@ IVW_MODULE_TENSORVISBASE_API std::shared_ptr<TensorField3D> getSlice3D(
     const size_t sliceNumber);
 }  // namespace detail
 
+/**
+ * A planar grid of sample positions in the texture space [0,1]^3 of a tensor field. Sample (i, j)
+ * lies at origin + uAxis * i / (dimensions.x - 1) + vAxis * j / (dimensions.y - 1), the axes
+ * may be oblique to the grid of the field.
+ */
+struct IVW_MODULE_TENSORVISBASE_API SlicePlane {
+    dvec3 origin{0.0, 0.0, 0.5};
+    dvec3 uAxis{1.0, 0.0, 0.0};
+    dvec3 vAxis{0.0, 1.0, 0.0};
+    size2_t dimensions{64, 64};
+
+    dvec3 position(size2_t pixel) const;
+};
+
+/**
+ * Extracts a plane of trilinearly interpolated tensors, computed in parallel. The tensors are
+ * projected onto the plane using an orthonormal basis of the u axis and the part of the v axis
+ * orthogonal to it. Samples outside of the field are zero.
+ * @param threads number of parallel jobs on the thread pool, zero uses the pool default
+ */
+IVW_MODULE_TENSORVISBASE_API std::shared_ptr<TensorField2D> obliqueSlice(
+    const TensorField3D& tensorField, const SlicePlane& plane, size_t threads = 0);
+
+/**
+ * Extracts `count` copies of `plane`, each moved by `step` (in texture space) from the previous
+ * one, as a 3D field of dimensions (plane.dimensions, count) in a single parallel pass. When the
+ * step moves an integral number of voxels along each axis, the interpolation weights of the first
+ * plane are reused for all planes.
+ */
+IVW_MODULE_TENSORVISBASE_API std::shared_ptr<TensorField3D> obliqueSliceStack(
+    const TensorField3D& tensorField, const SlicePlane& plane, const dvec3& step, size_t count,
+    size_t threads = 0);
+
 template <unsigned int N>
 auto slice(std::shared_ptr<const TensorField3D> inTensorField, const CartesianCoordinateAxis axis,
            const size_t sliceNumber) {
@@ -33,6 +33,8 @@
 #include <inviwo/tensorvisbase/tensorvisbasemoduledefine.h>
 #include <inviwo/core/datastructures/geometry/basicmesh.h>
 #include <functional>
+#include <span>
+#include <vector>
 
 namespace inviwo {
 /**
@@ -44,17 +46,39 @@ class IVW_MODULE_TENSORVISBASE_API DeformableSphere {
 public:
     DeformableSphere() = delete;
     DeformableSphere(const size_t& numTheta, const size_t& numPhi, const vec4& color = vec4(1.f));
+    DeformableSphere(const DeformableSphere&) = default;
+    DeformableSphere(DeformableSphere&&) = default;
+    DeformableSphere& operator=(const DeformableSphere&) = default;
+    DeformableSphere& operator=(DeformableSphere&&) = default;
     virtual ~DeformableSphere() = default;
 
     void deform(const std::function<void(vec3& vertex)>& lambda, const bool& normalize = true);
     void deform(const std::function<void(vec3& vertex, vec4& color)>& lambda,
                 const bool& normalize = true);
     void transform(const vec3& pos, const vec3& scale);
-    std::shared_ptr<BasicMesh> getGeometry();
+    void setBasis(const mat3& basis);
+    std::shared_ptr<BasicMesh> getGeometry() const;
+
+    /**
+     * Write the sphere into preallocated buffers with the basis and the transformation applied,
+     * offsetting the indices by \p vertexOffset. The buffers must hold at least
+     * numberOfVertices() vertices and numberOfIndices() indices.
+     */
+    void write(std::span<vec3> vertices, std::span<vec3> normals, std::span<vec3> texCoords,
+               std::span<vec4> colors, std::span<uint32_t> indices, uint32_t vertexOffset) const;
+
+    static size_t numberOfVertices(size_t numTheta, size_t numPhi);
+    static size_t numberOfIndices(size_t numTheta, size_t numPhi);
 
 private:
+    std::vector<vec3> vertices_;
+    std::vector<vec3> normals_;
+    std::vector<vec3> texCoords_;
+    std::vector<vec4> colors_;
+    std::vector<uint32_t> indices_;
     std::vector<size3_t> faces_;
-    std::shared_ptr<BasicMesh> mesh_;
+    mat3 basis_{1.0f};
+    mat4 worldMatrix_{1.0f};
 
     void createSphere(const size_t& numTheta, const size_t& numPhi, const vec4& color);
     void calculateNormals();
@@ -316,8 +316,8 @@ public:
     }
 
     template <typename T, typename S>
-    void addMetaData(const S& data, TensorFeature type) {
-        auto metaData = std::make_unique<T>(data, type);
+    void addMetaData(S&& data, TensorFeature type) {
+        auto metaData = std::make_unique<T>(std::forward<S>(data), type);
         metaData_.insert(std::make_pair(T::id(), std::move(metaData)));
     }
 
@@ -564,8 +564,8 @@ struct FrobeniusNorm : MetaDataType<glm::f64> {
 struct HillYieldCriterion : MetaDataType<glm::f64> {
     HillYieldCriterion() = default;
 
-    explicit HillYieldCriterion(const std::vector<double>& data, TensorFeature type)
-        : MetaDataType(data, type){};
+    explicit HillYieldCriterion(std::vector<double> data, TensorFeature type)
+        : MetaDataType(std::move(data), type){};
 
     HillYieldCriterion* clone() const final { return new HillYieldCriterion(data_, type_); }
 
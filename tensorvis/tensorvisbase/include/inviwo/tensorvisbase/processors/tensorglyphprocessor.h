@@ -34,14 +34,25 @@
 #include <inviwo/core/processors/processor.h>
 #include <inviwo/tensorvisbase/tensorvisbasemoduledefine.h>
 #include <inviwo/core/ports/dataoutport.h>
+#include <inviwo/core/ports/meshport.h>
 #include <inviwo/core/properties/compositeproperty.h>
+#include <inviwo/core/properties/optionproperty.h>
+#include <inviwo/core/properties/ordinalproperty.h>
 #include <inviwo/tensorvisbase/ports/tensorfieldport.h>
 #include <inviwo/tensorvisbase/properties/tensorglyphproperty.h>
 
 namespace inviwo {
 
 class Mesh;
+class BasicMesh;
 
+/**
+ * Generates one glyph per non-zero tensor of the input field. In the "Separate meshes" mode every
+ * glyph is output as its own mesh, in the "Merged mesh" mode all glyphs are baked into a single
+ * mesh. The merged mesh is preallocated and filled in parallel, which keeps both generation and
+ * rendering practical for large fields. A voxel stride and a minimum Frobenius norm can be used
+ * to thin out the glyphs.
+ */
 class IVW_MODULE_TENSORVISBASE_API TensorGlyphProcessor : public Processor {
 public:
     TensorGlyphProcessor();
@@ -54,8 +65,19 @@ public:
     static const ProcessorInfo processorInfo_;
 
 private:
+    enum class OutputMode { Separate, Merged };
+
+    std::vector<size3_t> selectVoxels(const TensorField3D& tensorField) const;
+    std::shared_ptr<BasicMesh> mergeGlyphs(std::shared_ptr<const TensorField3D> tensorField,
+                                           const std::vector<size3_t>& voxels);
+
     TensorField3DInport inport_;
     DataOutport<std::vector<std::shared_ptr<Mesh>>> outport_;
+    MeshOutport meshOutport_;
+
+    OptionProperty<OutputMode> outputMode_;
+    IntSizeTProperty stride_;
+    DoubleProperty minNorm_;
 
     TensorGlyphProperty glyphParameters_;
 };
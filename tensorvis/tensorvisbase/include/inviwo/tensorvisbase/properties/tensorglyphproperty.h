@@ -37,6 +37,11 @@
 #include <inviwo/core/properties/boolproperty.h>
 #include <inviwo/core/properties/ordinalproperty.h>
 #include <inviwo/core/datastructures/geometry/typedmesh.h>
+#include <inviwo/tensorvisbase/datastructures/deformablesphere.h>
+
+#include <span>
+#include <utility>
+#include <vector>
 
 namespace inviwo {
 
@@ -92,6 +97,23 @@ public:
                                                      const float size,
                                                      const dvec4& color = dvec4(1.)) const;
 
+    /**
+     * Number of vertices and indices of a glyph generated from a tensor field. All glyphs share
+     * the topology of the deformed base shape, hence the size only depends on the glyph type and
+     * resolution.
+     */
+    std::pair<size_t, size_t> glyphSize() const;
+
+    /**
+     * Write the glyph of generateGlyph(tensorField, index, pos) into preallocated buffers holding
+     * at least glyphSize() vertices and indices. The model and world transformations of the glyph
+     * are baked into the vertices and the indices are offset by \p vertexOffset.
+     */
+    void writeGlyph(std::shared_ptr<const TensorField3D> tensorField, size_t index,
+                    const dvec3 pos, std::span<vec3> vertices, std::span<vec3> normals,
+                    std::span<vec3> texCoords, std::span<vec4> colors,
+                    std::span<uint32_t> indices, uint32_t vertexOffset);
+
 protected:
     // Properties go here
     OptionProperty<GlyphType> glyphType_;
@@ -123,9 +145,14 @@ private:
     std::pair<bool, dvec3> intersectTriangle(const dvec2& coord,
                                              const std::array<dvec2, 3>& tri_verts);
 
-    const std::shared_ptr<BasicMesh> generateSuperquadric(
-        std::shared_ptr<const TensorField3D> tensorField, size_t index, const dvec3 pos,
-        const dvec4& color, const float size);
+    /// The spheres making up the glyph of a tensor, empty for glyph types not supported
+    std::vector<DeformableSphere> generateSpheres(std::shared_ptr<const TensorField3D> tensorField,
+                                                  size_t index, const dvec3 pos,
+                                                  const dvec4& color, const float size);
+
+    DeformableSphere generateSuperquadric(std::shared_ptr<const TensorField3D> tensorField,
+                                          size_t index, const dvec3 pos, const dvec4& color,
+                                          const float size);
 
     const std::shared_ptr<BasicMesh> generateSuperquadric(const dmat3& tensor, const dvec3& pos,
                                                           const float size,
@@ -135,13 +162,12 @@ private:
                                                           const dvec3& pos, const float size,
                                                           const dvec4& color = dvec4(1.)) const;
 
-    const std::shared_ptr<BasicMesh> generateReynolds(
-        std::shared_ptr<const TensorField3D> tensorField, size_t index, const dvec3 pos,
-        const float size);
+    DeformableSphere generateReynolds(std::shared_ptr<const TensorField3D> tensorField,
+                                      size_t index, const dvec3 pos, const float size);
 
-    const std::shared_ptr<BasicMesh> generateQuadric(
-        std::shared_ptr<const TensorField3D> tensorField, size_t index, const dvec3 pos,
-        const dvec4& color, const float size);
+    DeformableSphere generateQuadric(std::shared_ptr<const TensorField3D> tensorField,
+                                     size_t index, const dvec3 pos, const dvec4& color,
+                                     const float size);
 
     const std::shared_ptr<BasicMesh> generateCube(const dmat3& tensor, const dvec3& pos,
                                                   const float size,
@@ -151,21 +177,15 @@ private:
                                                       const float size,
                                                       const dvec4& color = dvec4(1.)) const;
 
-    const std::shared_ptr<BasicMesh> generateHWY(std::shared_ptr<const TensorField3D> tensorField,
-                                                 size_t index, const dvec3 pos, const dvec4& color,
-                                                 const float size);
-
-    const std::shared_ptr<BasicMesh> generateCombinedReynoldsHWY(
-        std::shared_ptr<const TensorField3D> tensorField, size_t index, const dvec3 pos,
-        const dvec4& color, const float size);
+    DeformableSphere generateHWY(std::shared_ptr<const TensorField3D> tensorField, size_t index,
+                                 const dvec3 pos, const dvec4& color, const float size);
 
-    const std::shared_ptr<BasicMesh> generateSuperquadricExtended(
-        std::shared_ptr<const TensorField3D> tensorField, size_t index, const dvec3 pos,
-        const float size);
+    DeformableSphere generateSuperquadricExtended(std::shared_ptr<const TensorField3D> tensorField,
+                                                  size_t index, const dvec3 pos,
+                                                  const float size);
 
-    std::shared_ptr<BasicMesh> createSuperquadric(const std::array<double, 3>& eigenValues,
-                                                  const dvec3& pos, const float size,
-                                                  const dvec4& color) const;
+    DeformableSphere createSuperquadric(const std::array<double, 3>& eigenValues, const dvec3& pos,
+                                        const float size, const dvec4& color) const;
 
     //    static constexpr std::array<std::array<dvec2, 3>, 10> tri_uv{
     //        {{dvec2(0.00, 0.00), dvec2(0.50, 0.00), dvec2(0.25, 0.25)},
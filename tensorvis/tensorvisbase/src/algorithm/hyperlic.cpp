@@ -0,0 +1,263 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/tensorvisbase/algorithm/hyperlic.h>
+#include <inviwo/core/datastructures/image/layer.h>
+#include <inviwo/core/datastructures/image/layerramprecision.h>
+#include <inviwo/core/util/foreach.h>
+#include <inviwo/core/util/zip.h>
+
+#include <algorithm>
+#include <atomic>
+#include <random>
+#include <vector>
+
+namespace inviwo::tensorutil {
+
+namespace {
+
+/**
+ * Eigenvector directions in output pixel space, sampled bilinearly with the sign ambiguity of the
+ * eigenvectors resolved against a reference direction.
+ */
+class DirectionField {
+public:
+    DirectionField(const TensorField2D& tensorField, size2_t outDims, bool minor)
+        : dims_{tensorField.getDimensions()}
+        , toField_{dvec2{dims_} / dvec2{outDims}}
+        , directions_(minor ? tensorField.minorEigenVectors()
+                            : tensorField.majorEigenVectors()) {
+
+        // Eigenvectors are given in the physical space of the field, scale them to output pixels
+        const auto pixelsPerUnit = dvec2{outDims} / tensorField.getExtent();
+        const auto& tensors = tensorField.tensors();
+        for (size_t i = 0; i < directions_.size(); ++i) {
+            const auto d = directions_[i] * pixelsPerUnit;
+            const auto l = glm::length(d);
+            directions_[i] = (l > 0.0 && tensors[i] != dmat2{0.0}) ? d / l : dvec2{0.0};
+        }
+    }
+
+    /// The direction of the nearest field sample
+    dvec2 nearest(const dvec2& pos) const {
+        const auto f = glm::clamp(size2_t(pos * toField_), size2_t{0}, dims_ - size_t{1});
+        return directions_[f.x + f.y * dims_.x];
+    }
+
+    /// Bilinear sample aligned with `ref`, zero where the field vanishes
+    dvec2 operator()(const dvec2& pos, const dvec2& ref) const {
+        // Field samples sit at cell centers
+        const auto f = glm::clamp(pos * toField_ - 0.5, dvec2{0.0}, dvec2{dims_ - size_t{1}});
+        const auto i0 = size2_t(f);
+        const auto i1 = glm::min(i0 + size_t{1}, dims_ - size_t{1});
+        const auto t = f - dvec2{i0};
+
+        const auto aligned = [&](size_t x, size_t y) {
+            const auto& d = directions_[x + y * dims_.x];
+            return glm::dot(d, ref) < 0.0 ? -d : d;
+        };
+        const auto d = glm::mix(glm::mix(aligned(i0.x, i0.y), aligned(i1.x, i0.y), t.x),
+                                glm::mix(aligned(i0.x, i1.y), aligned(i1.x, i1.y), t.x), t.y);
+        const auto l = glm::length(d);
+        return l > 1e-12 ? d / l : dvec2{0.0};
+    }
+
+private:
+    size2_t dims_;
+    dvec2 toField_;
+    std::vector<dvec2> directions_;
+};
+
+struct Tile {
+    size2_t begin;
+    size2_t end;
+    bool contains(const size2_t& p) const {
+        return p.x >= begin.x && p.y >= begin.y && p.x < end.x && p.y < end.y;
+    }
+};
+
+class Tracer {
+public:
+    Tracer(const DirectionField& field, const std::vector<float>& noise, size2_t dims,
+           const HyperLICSettings& settings)
+        : field_{field}
+        , noise_{noise}
+        , dims_{dims}
+        , kernel_{settings.kernelLength}
+        , length_{std::max(settings.streamlineLength, settings.kernelLength)}
+        , step_{settings.stepLength} {
+        line_.reserve(2 * length_ + 1);
+        prefix_.reserve(2 * length_ + 2);
+    }
+
+    /**
+     * Traces the streamline through the center of `seed` and adds the convolution at each of
+     * its samples to the pixels of `tile`. Returns the number of samples along the line.
+     */
+    size_t trace(const size2_t& seed, const Tile& tile, std::vector<float>& sum,
+                 std::vector<std::uint32_t>& hits) {
+        const dvec2 start = dvec2{seed} + 0.5;
+        const auto dir = field_.nearest(start);
+
+        backward_.clear();
+        line_.clear();
+        integrate(start, -dir, backward_);
+        line_.assign(backward_.rbegin(), backward_.rend());
+        line_.push_back(start);
+        integrate(start, dir, line_);
+
+        // Running box filter over the noise along the line, via prefix sums
+        prefix_.assign(1, 0.0);
+        for (const auto& p : line_) {
+            const auto& n = noise_[pixelIndex(p)];
+            prefix_.push_back(prefix_.back() + n);
+        }
+        const auto n = line_.size();
+        for (size_t c = 0; c < n; ++c) {
+            const auto lo = c > kernel_ ? c - kernel_ : 0;
+            const auto hi = std::min(n - 1, c + kernel_);
+            const auto value = (prefix_[hi + 1] - prefix_[lo]) / static_cast<double>(hi - lo + 1);
+
+            const auto pixel = size2_t(line_[c]);
+            if (!tile.contains(pixel)) continue;
+            const auto index = pixel.x + pixel.y * dims_.x;
+            sum[index] += static_cast<float>(value);
+            ++hits[index];
+        }
+        return n;
+    }
+
+private:
+    void integrate(dvec2 pos, dvec2 dir, std::vector<dvec2>& out) const {
+        if (dir == dvec2{0.0}) return;
+        for (size_t i = 0; i < length_; ++i) {
+            // Midpoint method
+            const auto k1 = field_(pos, dir);
+            if (k1 == dvec2{0.0}) break;
+            const auto k2 = field_(pos + 0.5 * step_ * k1, k1);
+            if (k2 == dvec2{0.0}) break;
+            pos += step_ * k2;
+            dir = k2;
+            if (pos.x < 0.0 || pos.y < 0.0 || pos.x >= static_cast<double>(dims_.x) ||
+                pos.y >= static_cast<double>(dims_.y)) {
+                break;
+            }
+            out.push_back(pos);
+        }
+    }
+
+    size_t pixelIndex(const dvec2& p) const {
+        const auto pixel = glm::min(size2_t(p), dims_ - size_t{1});
+        return pixel.x + pixel.y * dims_.x;
+    }
+
+    const DirectionField& field_;
+    const std::vector<float>& noise_;
+    size2_t dims_;
+    size_t kernel_;
+    size_t length_;
+    double step_;
+
+    std::vector<dvec2> backward_;
+    std::vector<dvec2> line_;
+    std::vector<double> prefix_;
+};
+
+}  // namespace
+
+std::shared_ptr<Layer> hyperLIC(const TensorField2D& tensorField, const HyperLICSettings& settings,
+                                HyperLICStats* stats) {
+    const size2_t dims = glm::compMul(settings.dimensions) > 0 ? settings.dimensions
+                                                               : tensorField.getDimensions();
+
+    auto ram = std::make_shared<LayerRAMPrecision<float>>(dims);
+    auto layer = std::make_shared<Layer>(ram);
+    layer->dataMap.dataRange = dvec2{0.0, 1.0};
+    layer->dataMap.valueRange = dvec2{0.0, 1.0};
+    layer->setBasis(dmat3{tensorField.getBasis()});
+    layer->setOffset(dvec3{tensorField.getOffset(), 0.0});
+    layer->setSwizzleMask(swizzlemasks::defaultData(1));
+
+    if (glm::compMul(dims) == 0) return layer;
+
+    const DirectionField field{tensorField, dims, settings.minor};
+
+    std::vector<float> noise(glm::compMul(dims));
+    {
+        std::mt19937 gen{settings.seed};
+        std::uniform_real_distribution<float> dist{0.0f, 1.0f};
+        std::generate(noise.begin(), noise.end(), [&]() { return dist(gen); });
+    }
+
+    std::vector<float> sum(noise.size(), 0.0f);
+    std::vector<std::uint32_t> hits(noise.size(), 0);
+
+    const auto tileSize = std::max<size_t>(settings.tileSize, 1);
+    const size2_t tiles = (dims + tileSize - size_t{1}) / tileSize;
+    const size_t tileCount = glm::compMul(tiles);
+
+    std::atomic<size_t> streamlines{0};
+    std::atomic<size_t> samples{0};
+
+    const auto traceTile = [&](size_t t) {
+        const size2_t begin = size2_t{t % tiles.x, t / tiles.x} * tileSize;
+        const Tile tile{begin, glm::min(begin + tileSize, dims)};
+
+        Tracer tracer{field, noise, dims, settings};
+        size_t tileLines = 0;
+        size_t tileSamples = 0;
+        for (size_t y = tile.begin.y; y < tile.end.y; ++y) {
+            for (size_t x = tile.begin.x; x < tile.end.x; ++x) {
+                if (hits[x + y * dims.x] > 0) continue;
+                tileSamples += tracer.trace(size2_t{x, y}, tile, sum, hits);
+                ++tileLines;
+            }
+        }
+        streamlines += tileLines;
+        samples += tileSamples;
+    };
+    util::forEachParallel(util::make_sequence(size_t{0}, tileCount, size_t{1}), traceTile,
+                          settings.threads);
+
+    auto data = ram->getView();
+    for (size_t i = 0; i < noise.size(); ++i) {
+        const auto pixel = size2_t{i % dims.x, i / dims.x};
+        data[i] = field.nearest(dvec2{pixel} + 0.5) == dvec2{0.0}
+                      ? settings.background
+                      : sum[i] / static_cast<float>(std::max<std::uint32_t>(hits[i], 1));
+    }
+
+    if (stats) {
+        stats->streamlines = streamlines;
+        stats->samples = samples;
+    }
+    return layer;
+}
+
+}  // namespace inviwo::tensorutil
@@ -28,33 +28,220 @@
  *********************************************************************************/
 
 #include <inviwo/tensorvisbase/algorithm/tensorfieldslicing.h>
-#include <inviwo/core/util/indexmapper.h>
+#include <inviwo/core/util/exception.h>
+#include <inviwo/core/util/foreach.h>
+#include <inviwo/core/util/zip.h>
 #include <inviwo/tensorvisbase/util/tensorutil.h>
 
+#include <algorithm>
+#include <array>
+
 namespace inviwo {
-namespace detail {
-std::shared_ptr<TensorField2D> getSlice2D(std::shared_ptr<const TensorField3D> inTensorField,
-                                          const CartesianCoordinateAxis axis,
-                                          const size_t sliceNumber) {
-    auto fieldDimensions = inTensorField->getDimensions();
-    size2_t dimensions{0};
+
+namespace {
+
+/**
+ * Calls func(src, srcStride, count, dstOffset) for each contiguous run of the axis aligned slice,
+ * a single block for Z, one row per z for Y, and one strided column per z for X.
+ */
+template <typename Func>
+void forEachSliceRun(const TensorField3D& field, CartesianCoordinateAxis axis, size_t sliceNumber,
+                     Func func) {
+    const auto dims = field.getDimensions();
+    const auto* data = field.tensors().data();
+    const auto sliceSize = dims.x * dims.y;
 
     switch (axis) {
         case CartesianCoordinateAxis::X:
-            dimensions = size2_t(fieldDimensions.y, fieldDimensions.z);
+            for (size_t z = 0; z < dims.z; ++z) {
+                func(data + sliceNumber + z * sliceSize, dims.x, dims.y, z * dims.y);
+            }
             break;
         case CartesianCoordinateAxis::Y:
-            dimensions = size2_t(fieldDimensions.x, fieldDimensions.z);
+            for (size_t z = 0; z < dims.z; ++z) {
+                func(data + sliceNumber * dims.x + z * sliceSize, size_t{1}, dims.x, z * dims.x);
+            }
             break;
         case CartesianCoordinateAxis::Z:
-            dimensions = size2_t(fieldDimensions.x, fieldDimensions.y);
+            func(data + sliceNumber * sliceSize, size_t{1}, sliceSize, size_t{0});
             break;
     }
+}
+
+void checkSliceNumber(const TensorField3D& field, CartesianCoordinateAxis axis,
+                      size_t sliceNumber) {
+    const auto dims = field.getDimensions();
+    const auto size = axis == CartesianCoordinateAxis::X   ? dims.x
+                      : axis == CartesianCoordinateAxis::Y ? dims.y
+                                                           : dims.z;
+    if (sliceNumber >= size) {
+        throw Exception(SourceContext{}, "Slice {} out of range for a field of size {}",
+                        sliceNumber, size);
+    }
+}
+
+/// Trilinear interpolation stencil at a continuous index position
+struct Stencil {
+    glm::i64vec3 base{0};
+    dvec3 frac{0.0};
+    std::array<double, 8> weights{};
+
+    Stencil() = default;
+    explicit Stencil(const dvec3& pos) {
+        // Snap positions within rounding error of a voxel, so that the border of the field is
+        // not lost to a tiny negative fraction
+        constexpr double eps = 1e-9;
+        const auto rounded = glm::round(pos);
+        const auto p = glm::mix(pos, rounded, glm::lessThan(glm::abs(pos - rounded), dvec3{eps}));
+        base = glm::i64vec3{glm::floor(p)};
+        frac = p - dvec3{base};
+
+        for (size_t k = 0; k < 8; ++k) {
+            weights[k] = ((k & 1) ? frac.x : 1.0 - frac.x) * ((k & 2) ? frac.y : 1.0 - frac.y) *
+                         ((k & 4) ? frac.z : 1.0 - frac.z);
+        }
+    }
+
+    /// Interpolates with the corner moved by `shift` voxels, zero if that leaves the field
+    dmat3 sample(const std::vector<dmat3>& data, const size3_t& dims,
+                 const glm::i64vec3& shift = glm::i64vec3{0}) const {
+        const auto b = base + shift;
+        const auto last = glm::i64vec3{dims} - std::int64_t{1};
+        for (glm::length_t a = 0; a < 3; ++a) {
+            if (b[a] < 0 || b[a] + (frac[a] > 0.0 ? 1 : 0) > last[a]) return dmat3{0.0};
+        }
+
+        const auto b1 = glm::min(b + std::int64_t{1}, last);
+        const std::array<size_t, 2> xs{static_cast<size_t>(b.x), static_cast<size_t>(b1.x)};
+        const std::array<size_t, 2> ys{static_cast<size_t>(b.y), static_cast<size_t>(b1.y)};
+        const std::array<size_t, 2> zs{static_cast<size_t>(b.z), static_cast<size_t>(b1.z)};
+
+        dmat3 res{0.0};
+        for (size_t k = 0; k < 8; ++k) {
+            if (weights[k] == 0.0) continue;
+            const auto index = xs[k & 1] + dims.x * (ys[(k >> 1) & 1] + dims.y * zs[k >> 2]);
+            res += weights[k] * data[index];
+        }
+        return res;
+    }
+};
+
+dvec3 toIndex(const dvec3& texturePos, const size3_t& dims) {
+    return texturePos * dvec3{dims - size_t{1}};
+}
+
+}  // namespace
+
+dvec3 SlicePlane::position(size2_t pixel) const {
+    const auto denom = dvec2{glm::max(dimensions, size2_t{2}) - size_t{1}};
+    return origin + uAxis * (static_cast<double>(pixel.x) / denom.x) +
+           vAxis * (static_cast<double>(pixel.y) / denom.y);
+}
+
+std::shared_ptr<TensorField2D> obliqueSlice(const TensorField3D& tensorField,
+                                            const SlicePlane& plane, size_t threads) {
+    const auto dims = tensorField.getDimensions();
+    const auto& data = tensorField.tensors();
+
+    // Orthonormal basis of the plane in the physical space of the field
+    const dmat3 basis{tensorField.getBasis()};
+    const auto uPhys = basis * plane.uAxis;
+    const auto vPhys = basis * plane.vAxis;
+    const auto e1 = glm::normalize(uPhys);
+    const auto e2 = glm::normalize(vPhys - glm::dot(vPhys, e1) * e1);
+    const std::array<dvec3, 2> e{e1, e2};
+
+    std::vector<dmat2> sliceData(glm::compMul(plane.dimensions));
+    const auto projectRow = [&](size_t y) {
+        for (size_t x = 0; x < plane.dimensions.x; ++x) {
+            const Stencil stencil{toIndex(plane.position(size2_t{x, y}), dims)};
+            const auto tensor = stencil.sample(data, dims);
+
+            dmat2 projected;
+            for (glm::length_t c = 0; c < 2; ++c) {
+                const auto tc = tensor * e[c];
+                for (glm::length_t r = 0; r < 2; ++r) {
+                    projected[c][r] = glm::dot(e[r], tc);
+                }
+            }
+            sliceData[x + y * plane.dimensions.x] = projected;
+        }
+    };
+    util::forEachParallel(util::make_sequence(size_t{0}, plane.dimensions.y, size_t{1}),
+                          projectRow, threads);
+
+    return std::make_shared<TensorField2D>(plane.dimensions, sliceData,
+                                           dvec2{glm::length(uPhys), glm::length(vPhys)});
+}
+
+std::shared_ptr<TensorField3D> obliqueSliceStack(const TensorField3D& tensorField,
+                                                 const SlicePlane& plane, const dvec3& step,
+                                                 size_t count, size_t threads) {
+    const auto dims = tensorField.getDimensions();
+    const auto& data = tensorField.tensors();
+    const size3_t outDims{plane.dimensions, count};
+    const auto planeSize = glm::compMul(plane.dimensions);
+
+    const auto indexStep = toIndex(step, dims);
+    const auto roundedStep = glm::round(indexStep);
+    const bool integralStep =
+        glm::all(glm::lessThan(glm::abs(indexStep - roundedStep), dvec3{1e-9}));
+
+    std::vector<Stencil> stencils;
+    if (integralStep) {
+        stencils.resize(planeSize);
+        const auto stencilRow = [&](size_t y) {
+            for (size_t x = 0; x < plane.dimensions.x; ++x) {
+                stencils[x + y * plane.dimensions.x] =
+                    Stencil{toIndex(plane.position(size2_t{x, y}), dims)};
+            }
+        };
+        util::forEachParallel(util::make_sequence(size_t{0}, plane.dimensions.y, size_t{1}),
+                              stencilRow, threads);
+    }
+
+    std::vector<dmat3> stackData(glm::compMul(outDims));
+    const auto sampleRow = [&](size_t row) {
+        const auto k = row / plane.dimensions.y;
+        const auto y = row % plane.dimensions.y;
+        auto* dst = stackData.data() + k * planeSize + y * plane.dimensions.x;
+
+        if (integralStep) {
+            const auto shift = glm::i64vec3{roundedStep} * static_cast<std::int64_t>(k);
+            const auto* src = stencils.data() + y * plane.dimensions.x;
+            for (size_t x = 0; x < plane.dimensions.x; ++x) {
+                dst[x] = src[x].sample(data, dims, shift);
+            }
+        } else {
+            const auto offset = step * static_cast<double>(k);
+            for (size_t x = 0; x < plane.dimensions.x; ++x) {
+                const Stencil stencil{toIndex(plane.position(size2_t{x, y}) + offset, dims)};
+                dst[x] = stencil.sample(data, dims);
+            }
+        }
+    };
+    util::forEachParallel(util::make_sequence(size_t{0}, count * plane.dimensions.y, size_t{1}),
+                          sampleRow, threads);
+
+    const dmat3 basis{tensorField.getBasis()};
+    const auto stackBasis =
+        mat3{dmat3{basis * plane.uAxis, basis * plane.vAxis,
+                   basis * step * static_cast<double>(std::max<size_t>(count, 2) - 1)}};
 
-    util::IndexMapper2D indexMapper(dimensions);
+    auto stack = std::make_shared<TensorField3D>(outDims, std::move(stackData));
+    stack->setBasis(stackBasis);
+    stack->setOffset(vec3{basis * plane.origin + dvec3{tensorField.getOffset()}});
+    return stack;
+}
 
-    std::vector<dmat2> sliceData;
-    sliceData.resize(dimensions.x * dimensions.y);
+namespace detail {
+std::shared_ptr<TensorField2D> getSlice2D(std::shared_ptr<const TensorField3D> inTensorField,
+                                          const CartesianCoordinateAxis axis,
+                                          const size_t sliceNumber) {
+    checkSliceNumber(*inTensorField, axis, sliceNumber);
+
+    auto fieldDimensions = inTensorField->getDimensions();
+    size2_t dimensions{0};
 
     const vec3 sourceExtent{inTensorField->getExtent()};
     const vec3 sourceOffset{inTensorField->getOffset()};
@@ -64,40 +251,31 @@ std::shared_ptr<TensorField2D> getSlice2D(std::shared_ptr<const TensorField3D> i
 
     switch (axis) {
         case CartesianCoordinateAxis::X:
-            for (size_t z = 0; z < dimensions.y; z++) {
-                for (size_t y = 0; y < dimensions.x; y++) {
-                    auto x = sliceNumber;
-                    sliceData[indexMapper(size2_t(y, z))] =
-                        tensorutil::getProjectedTensor(inTensorField->at(x, y, z).second, axis);
-                }
-            }
+            dimensions = size2_t(fieldDimensions.y, fieldDimensions.z);
             extent = vec2{sourceExtent.y, sourceExtent.z};
             offset = vec2{sourceOffset.y, sourceOffset.z};
             break;
         case CartesianCoordinateAxis::Y:
-            for (size_t z = 0; z < dimensions.y; z++) {
-                for (size_t x = 0; x < dimensions.x; x++) {
-                    auto y = sliceNumber;
-                    sliceData[indexMapper(size2_t(x, z))] =
-                        tensorutil::getProjectedTensor(inTensorField->at(x, y, z).second, axis);
-                }
-            }
+            dimensions = size2_t(fieldDimensions.x, fieldDimensions.z);
             extent = vec2{sourceExtent.x, sourceExtent.z};
             offset = vec2{sourceOffset.x, sourceOffset.z};
             break;
         case CartesianCoordinateAxis::Z:
-            for (size_t y = 0; y < dimensions.y; y++) {
-                for (size_t x = 0; x < dimensions.x; x++) {
-                    auto z = sliceNumber;
-                    sliceData[indexMapper(size2_t(x, y))] =
-                        tensorutil::getProjectedTensor(inTensorField->at(x, y, z).second, axis);
-                }
-            }
+            dimensions = size2_t(fieldDimensions.x, fieldDimensions.y);
             extent = vec2{sourceExtent.x, sourceExtent.y};
             offset = vec2{sourceOffset.x, sourceOffset.y};
             break;
     }
 
+    std::vector<dmat2> sliceData(dimensions.x * dimensions.y);
+    forEachSliceRun(*inTensorField, axis, sliceNumber,
+                    [&](const dmat3* src, size_t stride, size_t count, size_t dstOffset) {
+                        auto* dst = sliceData.data() + dstOffset;
+                        for (size_t i = 0; i < count; ++i) {
+                            dst[i] = tensorutil::getProjectedTensor(src[i * stride], axis);
+                        }
+                    });
+
     auto tensorField = std::make_shared<TensorField2D>(dimensions, sliceData, extent);
     tensorField->setOffset(offset);
 
@@ -107,67 +285,48 @@ std::shared_ptr<TensorField2D> getSlice2D(std::shared_ptr<const TensorField3D> i
 std::shared_ptr<TensorField3D> getSlice3D(std::shared_ptr<const TensorField3D> inTensorField,
                                           const CartesianCoordinateAxis axis,
                                           const size_t sliceNumber) {
+    checkSliceNumber(*inTensorField, axis, sliceNumber);
+
     auto fieldDimensions = inTensorField->getDimensions();
     size3_t dimensions{0};
     float frac{0.0f};
 
     auto stepSize = inTensorField->getSpacing<float>();
-
-    switch (axis) {
-        case CartesianCoordinateAxis::X:
-            dimensions = size3_t(1, fieldDimensions.y, fieldDimensions.z);
-            frac = static_cast<float>(sliceNumber) * stepSize.x;
-            break;
-        case CartesianCoordinateAxis::Y:
-            dimensions = size3_t(fieldDimensions.x, 1, fieldDimensions.z);
-            frac = static_cast<float>(sliceNumber) * stepSize.y;
-            break;
-        case CartesianCoordinateAxis::Z:
-            dimensions = size3_t(fieldDimensions.x, fieldDimensions.y, 1);
-            frac = static_cast<float>(sliceNumber) * stepSize.z;
-            break;
-    }
-
-    util::IndexMapper3D indexMapper(dimensions);
-
-    std::vector<dmat3> sliceData{};
-    sliceData.resize(dimensions.x * dimensions.y * dimensions.z);
     mat3 basis{inTensorField->getBasis()};
     vec3 offset{inTensorField->getOffset()};
 
     switch (axis) {
         case CartesianCoordinateAxis::X:
-            for (size_t z = 0; z < dimensions.z; z++) {
-                for (size_t y = 0; y < dimensions.y; y++) {
-                    auto x = sliceNumber;
-                    sliceData[indexMapper(size3_t(0, y, z))] = inTensorField->at(x, y, z).second;
-                }
-            }
+            dimensions = size3_t(1, fieldDimensions.y, fieldDimensions.z);
+            frac = static_cast<float>(sliceNumber) * stepSize.x;
             basis[0] = vec3{0.0f};
             offset.x += frac;
             break;
         case CartesianCoordinateAxis::Y:
-            for (size_t z = 0; z < dimensions.z; z++) {
-                for (size_t x = 0; x < dimensions.x; x++) {
-                    auto y = sliceNumber;
-                    sliceData[indexMapper(size3_t(x, 0, z))] = inTensorField->at(x, y, z).second;
-                }
-            }
+            dimensions = size3_t(fieldDimensions.x, 1, fieldDimensions.z);
+            frac = static_cast<float>(sliceNumber) * stepSize.y;
             basis[1] = vec3{0.0f};
             offset.y += frac;
             break;
         case CartesianCoordinateAxis::Z:
-            for (size_t y = 0; y < dimensions.y; y++) {
-                for (size_t x = 0; x < dimensions.x; x++) {
-                    auto z = sliceNumber;
-                    sliceData[indexMapper(size3_t(x, y, 0))] = inTensorField->at(x, y, z).second;
-                }
-            }
+            dimensions = size3_t(fieldDimensions.x, fieldDimensions.y, 1);
+            frac = static_cast<float>(sliceNumber) * stepSize.z;
             basis[2] = vec3{0.0f};
             offset.z += frac;
             break;
     }
 
+    std::vector<dmat3> sliceData(dimensions.x * dimensions.y * dimensions.z);
+    forEachSliceRun(*inTensorField, axis, sliceNumber,
+                    [&](const dmat3* src, size_t stride, size_t count, size_t dstOffset) {
+                        auto* dst = sliceData.data() + dstOffset;
+                        if (stride == 1) {
+                            std::copy(src, src + count, dst);
+                        } else {
+                            for (size_t i = 0; i < count; ++i) dst[i] = src[i * stride];
+                        }
+                    });
+
     auto tensorField =
         std::make_shared<TensorField3D>(dimensions, sliceData, inTensorField->getExtent(), frac);
 
@@ -29,6 +29,8 @@
 
 #include <inviwo/tensorvisbase/datastructures/deformablesphere.h>
 
+#include <algorithm>
+
 namespace inviwo {
 
 DeformableSphere::DeformableSphere(const size_t& numTheta, const size_t& numPhi,
@@ -40,29 +42,20 @@ DeformableSphere::DeformableSphere(const size_t& numTheta, const size_t& numPhi,
 
 void DeformableSphere::createSphere(const size_t& numTheta, const size_t& numPhi,
                                     const vec4& color) {
-    mesh_ = std::make_shared<BasicMesh>();
-
-    auto nFaces = (numPhi - 3) * (numTheta - 1) * 2 + (numPhi - 3) * 2 + 2 * ((numTheta - 1) + 1);
+    const auto nFaces = numberOfIndices(numTheta, numPhi) / 3;
 
-    auto indexBuffer = mesh_->addIndexBuffer(DrawType::Triangles, ConnectivityType::None);
-    indexBuffer->getDataContainer().reserve(nFaces * 3);
+    indices_.clear();
+    indices_.reserve(nFaces * 3);
 
     auto nIndices = (numPhi - 1) * numTheta + 2;
     std::vector<uint32_t> addedIndices;
     addedIndices.reserve(nIndices);
 
-    auto& vertices =
-        mesh_->getEditableVertices()->getEditableRAMRepresentation()->getDataContainer();
-    auto& normals = mesh_->getEditableNormals()->getEditableRAMRepresentation()->getDataContainer();
-    auto& texCoords =
-        mesh_->getEditableTexCoords()->getEditableRAMRepresentation()->getDataContainer();
-    auto& colors = mesh_->getEditableColors()->getEditableRAMRepresentation()->getDataContainer();
-
-    auto totalVertices = (numPhi - 1) * numTheta + 2;  // 2 extreme points
-    vertices.reserve(totalVertices);
-    normals.reserve(totalVertices);
-    texCoords.reserve(totalVertices);
-    colors.reserve(totalVertices);
+    const auto totalVertices = numberOfVertices(numTheta, numPhi);
+    vertices_.reserve(totalVertices);
+    normals_.reserve(totalVertices);
+    texCoords_.reserve(totalVertices);
+    colors_.reserve(totalVertices);
 
     faces_.clear();
     faces_.reserve(nFaces);
@@ -80,11 +73,11 @@ void DeformableSphere::createSphere(const size_t& numTheta, const size_t& numPhi
     };
     auto addVertex = [&](const vec3& vertex, const vec3& texCoord, const vec3& normal,
                          const vec4& color) -> auto {
-        vertices.emplace_back(vertex);
-        normals.emplace_back(normal);
-        texCoords.emplace_back(texCoord);
-        colors.emplace_back(color);
-        return static_cast<uint32_t>(vertices.size() - 1);
+        vertices_.emplace_back(vertex);
+        normals_.emplace_back(normal);
+        texCoords_.emplace_back(texCoord);
+        colors_.emplace_back(color);
+        return static_cast<uint32_t>(vertices_.size() - 1);
     };
 
     // Generate main geometry body
@@ -145,14 +138,14 @@ void DeformableSphere::createSphere(const size_t& numTheta, const size_t& numPhi
             auto idx5 = firstItemInSecondRow + i;
             auto idx6 = firstItemInSecondRow + 1 + i;
 
-            indexBuffer->add(addedIndices.at(idx1));
-            indexBuffer->add(addedIndices.at(idx2));
-            indexBuffer->add(addedIndices.at(idx3));
+            indices_.push_back(addedIndices.at(idx1));
+            indices_.push_back(addedIndices.at(idx2));
+            indices_.push_back(addedIndices.at(idx3));
             faces_.emplace_back(addedIndices.at(idx1), addedIndices.at(idx2),
                                 addedIndices.at(idx3));
-            indexBuffer->add(addedIndices.at(idx4));
-            indexBuffer->add(addedIndices.at(idx5));
-            indexBuffer->add(addedIndices.at(idx6));
+            indices_.push_back(addedIndices.at(idx4));
+            indices_.push_back(addedIndices.at(idx5));
+            indices_.push_back(addedIndices.at(idx6));
             faces_.emplace_back(addedIndices.at(idx4), addedIndices.at(idx5),
                                 addedIndices.at(idx6));
         }
@@ -164,16 +157,16 @@ void DeformableSphere::createSphere(const size_t& numTheta, const size_t& numPhi
         auto lastItemInFirstRow = (j * numTheta) + (numTheta - 1);
         auto lastItemInSecondRow = ((j + 1) * numTheta) + (numTheta - 1);
 
-        indexBuffer->add(addedIndices.at(lastItemInSecondRow));
-        indexBuffer->add(addedIndices.at(firstItemInFirstRow));
-        indexBuffer->add(addedIndices.at(lastItemInFirstRow));
+        indices_.push_back(addedIndices.at(lastItemInSecondRow));
+        indices_.push_back(addedIndices.at(firstItemInFirstRow));
+        indices_.push_back(addedIndices.at(lastItemInFirstRow));
         faces_.emplace_back(addedIndices.at(lastItemInSecondRow),
                             addedIndices.at(firstItemInFirstRow),
                             addedIndices.at(lastItemInFirstRow));
 
-        indexBuffer->add(addedIndices.at(firstItemInFirstRow));
-        indexBuffer->add(addedIndices.at(lastItemInSecondRow));
-        indexBuffer->add(addedIndices.at(firstItemInSecondRow));
+        indices_.push_back(addedIndices.at(firstItemInFirstRow));
+        indices_.push_back(addedIndices.at(lastItemInSecondRow));
+        indices_.push_back(addedIndices.at(firstItemInSecondRow));
         faces_.emplace_back(addedIndices.at(firstItemInFirstRow),
                             addedIndices.at(lastItemInSecondRow),
                             addedIndices.at(firstItemInSecondRow));
@@ -184,15 +177,15 @@ void DeformableSphere::createSphere(const size_t& numTheta, const size_t& numPhi
     auto extremePoint1 = addedIndices.at(addedIndices.size() - 2);
 
     for (size_t i = 0; i < numTheta - 1; i++) {
-        indexBuffer->add(extremePoint1);
-        indexBuffer->add(addedIndices.at(i));
-        indexBuffer->add(addedIndices.at((i + 1)));
+        indices_.push_back(extremePoint1);
+        indices_.push_back(addedIndices.at(i));
+        indices_.push_back(addedIndices.at((i + 1)));
         faces_.emplace_back(extremePoint1, addedIndices.at(i), addedIndices.at((i + 1)));
     }
 
-    indexBuffer->add(extremePoint1);
-    indexBuffer->add(addedIndices.at(numTheta - 1));
-    indexBuffer->add(0);
+    indices_.push_back(extremePoint1);
+    indices_.push_back(addedIndices.at(numTheta - 1));
+    indices_.push_back(0);
     faces_.emplace_back(extremePoint1, addedIndices.at(numTheta - 1), addedIndices.at(0));
 
     // Tesselate second extreme point
@@ -200,17 +193,17 @@ void DeformableSphere::createSphere(const size_t& numTheta, const size_t& numPhi
     auto extremePoint2 = addedIndices.at(addedIndices.size() - 1);
 
     for (size_t i = 0; i < numTheta - 1; i++) {
-        indexBuffer->add(extremePoint2);
-        indexBuffer->add(addedIndices.at((i + 1) + numTheta * (numPhi - 3)));
-        indexBuffer->add(addedIndices.at(i + numTheta * (numPhi - 3)));
+        indices_.push_back(extremePoint2);
+        indices_.push_back(addedIndices.at((i + 1) + numTheta * (numPhi - 3)));
+        indices_.push_back(addedIndices.at(i + numTheta * (numPhi - 3)));
         faces_.emplace_back(extremePoint2, addedIndices.at((i + 1) + numTheta * (numPhi - 3)),
                             addedIndices.at(i + numTheta * (numPhi - 3)));
     }
 
-    indexBuffer->add(extremePoint2);
+    indices_.push_back(extremePoint2);
 
-    indexBuffer->add(addedIndices.at(numTheta * (numPhi - 2) - numTheta));
-    indexBuffer->add(addedIndices.at(numTheta * (numPhi - 2) - 1));
+    indices_.push_back(addedIndices.at(numTheta * (numPhi - 2) - numTheta));
+    indices_.push_back(addedIndices.at(numTheta * (numPhi - 2) - 1));
 
     faces_.emplace_back(extremePoint2, addedIndices.at(numTheta * (numPhi - 2) - numTheta),
                         addedIndices.at(numTheta * (numPhi - 2) - 1));
@@ -218,20 +211,17 @@ void DeformableSphere::createSphere(const size_t& numTheta, const size_t& numPhi
 
 void DeformableSphere::deform(const std::function<void(vec3& vertex)>& lambda,
                               const bool& normalize) {
-    auto& vertices =
-        mesh_->getEditableVertices()->getEditableRAMRepresentation()->getDataContainer();
-
     if (normalize) {
         auto maxDist = std::numeric_limits<float>::lowest();
-        for (auto& v : vertices) {
+        for (auto& v : vertices_) {
             lambda(v);
             maxDist = glm::max(glm::length(v), maxDist);
         }
-        for (auto& v : vertices) {
+        for (auto& v : vertices_) {
             v /= maxDist;
         }
     } else {
-        for (auto& v : vertices) {
+        for (auto& v : vertices_) {
             lambda(v);
         }
     }
@@ -241,25 +231,21 @@ void DeformableSphere::deform(const std::function<void(vec3& vertex)>& lambda,
 
 void DeformableSphere::deform(const std::function<void(vec3& vertex, vec4& color)>& lambda,
                               const bool& normalize) {
-    auto& vertices =
-        mesh_->getEditableVertices()->getEditableRAMRepresentation()->getDataContainer();
-    auto& colors = mesh_->getEditableColors()->getEditableRAMRepresentation()->getDataContainer();
-
     if (normalize) {
         auto maxDist = std::numeric_limits<float>::lowest();
         size_t i = 0;
-        for (auto& v : vertices) {
-            lambda(v, colors[i]);
+        for (auto& v : vertices_) {
+            lambda(v, colors_[i]);
             maxDist = glm::max(glm::length(v), maxDist);
             i++;
         }
-        for (auto& v : vertices) {
+        for (auto& v : vertices_) {
             v /= maxDist;
         }
     } else {
         size_t i = 0;
-        for (auto& v : vertices) {
-            lambda(v, colors[i]);
+        for (auto& v : vertices_) {
+            lambda(v, colors_[i]);
             i++;
         }
     }
@@ -271,41 +257,73 @@ void DeformableSphere::transform(const vec3& pos, const vec3& scale) {
     auto translation = glm::translate(pos);
     auto scaling = glm::scale(vec3(scale));
 
-    mesh_->setWorldMatrix(mat4(1) * translation * scaling);
+    worldMatrix_ = mat4(1) * translation * scaling;
 }
 
-std::shared_ptr<BasicMesh> DeformableSphere::getGeometry() {
-    return std::make_shared<BasicMesh>(*mesh_);
+void DeformableSphere::setBasis(const mat3& basis) { basis_ = basis; }
+
+std::shared_ptr<BasicMesh> DeformableSphere::getGeometry() const {
+    auto mesh = std::make_shared<BasicMesh>();
+    mesh->getEditableVertices()->getEditableRAMRepresentation()->getDataContainer() = vertices_;
+    mesh->getEditableNormals()->getEditableRAMRepresentation()->getDataContainer() = normals_;
+    mesh->getEditableTexCoords()->getEditableRAMRepresentation()->getDataContainer() = texCoords_;
+    mesh->getEditableColors()->getEditableRAMRepresentation()->getDataContainer() = colors_;
+    mesh->addIndexBuffer(DrawType::Triangles, ConnectivityType::None)->getDataContainer() =
+        indices_;
+    mesh->setBasis(basis_);
+    mesh->setWorldMatrix(worldMatrix_);
+    return mesh;
 }
 
-void DeformableSphere::calculateNormals() {
-    auto& vertices =
-        mesh_->getEditableVertices()->getEditableRAMRepresentation()->getDataContainer();
-    auto& normals = mesh_->getEditableNormals()->getEditableRAMRepresentation()->getDataContainer();
+void DeformableSphere::write(std::span<vec3> vertices, std::span<vec3> normals,
+                             std::span<vec3> texCoords, std::span<vec4> colors,
+                             std::span<uint32_t> indices, uint32_t vertexOffset) const {
+    // Bake the basis and the world transformation into the vertices
+    const mat4 m = worldMatrix_ * mat4(basis_);
+    const mat3 n = glm::transpose(glm::inverse(mat3(m)));
+
+    for (size_t v = 0; v < vertices_.size(); ++v) {
+        vertices[v] = vec3(m * vec4(vertices_[v], 1.0f));
+        normals[v] = glm::normalize(n * normals_[v]);
+    }
+    std::copy(texCoords_.begin(), texCoords_.end(), texCoords.begin());
+    std::copy(colors_.begin(), colors_.end(), colors.begin());
+    std::transform(indices_.begin(), indices_.end(), indices.begin(),
+                   [&](uint32_t index) { return index + vertexOffset; });
+}
+
+size_t DeformableSphere::numberOfVertices(size_t numTheta, size_t numPhi) {
+    return (numPhi - 2) * numTheta + 2;  // 2 extreme points
+}
 
-    for (auto& normal : normals) {
+size_t DeformableSphere::numberOfIndices(size_t numTheta, size_t numPhi) {
+    return 3 * ((numPhi - 3) * (numTheta - 1) * 2 + (numPhi - 3) * 2 + 2 * numTheta);
+}
+
+void DeformableSphere::calculateNormals() {
+    for (auto& normal : normals_) {
         normal = vec3(0.f);
     }
 
     for (const auto& face : faces_) {
-        auto v1 = vertices[face.x];
-        auto v2 = vertices[face.y];
-        auto v3 = vertices[face.z];
+        auto v1 = vertices_[face.x];
+        auto v2 = vertices_[face.y];
+        auto v3 = vertices_[face.z];
 
         auto edge1 = v2 - v1;
         auto edge2 = v3 - v1;
 
         auto faceNormal = glm::cross(edge1, edge2);
 
-        normals[face.x] += faceNormal;
-        normals[face.y] += faceNormal;
-        normals[face.z] += faceNormal;
+        normals_[face.x] += faceNormal;
+        normals_[face.y] += faceNormal;
+        normals_[face.z] += faceNormal;
     }
 
     size_t i = 0;
-    for (auto& normal : normals) {
+    for (auto& normal : normals_) {
         normal = glm::normalize(normal);
-        auto cosAlpha = glm::dot(normal, glm::normalize(vertices[i]));
+        auto cosAlpha = glm::dot(normal, glm::normalize(vertices_[i]));
 
         if (cosAlpha < 0.f) {
             normal = -normal;
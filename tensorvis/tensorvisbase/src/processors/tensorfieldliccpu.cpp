@@ -0,0 +1,98 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/tensorvisbase/processors/tensorfieldliccpu.h>
+#include <inviwo/tensorvisbase/algorithm/hyperlic.h>
+#include <inviwo/core/datastructures/image/layer.h>
+
+namespace inviwo {
+
+// The Class Identifier has to be globally unique. Use a reverse DNS naming scheme
+const ProcessorInfo TensorFieldLICCPU::processorInfo_{
+    "org.inviwo.TensorFieldLICCPU",  // Class identifier
+    "Tensor Field LIC CPU",          // Display name
+    "Tensor Visualization",          // Category
+    CodeState::Experimental,         // Code state
+    Tags::CPU | Tag{"Tensor"},       // Tags
+    R"(Computes a hyperLIC image of the major or minor eigenvector field of a 2D tensor field
+    on the CPU, for use where no OpenGL context is available. The image is computed tile
+    parallel, and every streamline is reused for all pixels it passes through.)"_unindentHelp,
+};
+
+const ProcessorInfo& TensorFieldLICCPU::getProcessorInfo() const { return processorInfo_; }
+
+TensorFieldLICCPU::TensorFieldLICCPU()
+    : Processor()
+    , inport_("inport")
+    , outport_("outport")
+    , outputDimensions_{"outputDimensions", "Output Dimensions",
+                        util::ordinalCount(size2_t{512}, size2_t{4096})
+                            .set("Size of the LIC image, zero uses the size of the field"_help)}
+    , kernelLength_{"kernelLength", "Kernel Length",
+                    util::ordinalCount(size_t{20}, size_t{200})
+                        .set("Half length of the convolution kernel in integration steps"_help)}
+    , streamlineLength_{"streamlineLength", "Streamline Length",
+                        util::ordinalCount(size_t{60}, size_t{1000})
+                            .set("Steps traced in each direction per streamline. Longer "
+                                 "streamlines are reused by more pixels, at least the kernel "
+                                 "length is used"_help)}
+    , stepLength_{"stepLength",
+                  "Step Length",
+                  "Integration step length in pixels"_help,
+                  0.5,
+                  {0.05, ConstraintBehavior::Immutable},
+                  {2.0, ConstraintBehavior::Ignore}}
+    , minor_{"useMinor", "Use minor eigenvectors", false}
+    , seed_{"seed", "Noise Seed", 0, 0, 1000}
+    , background_{"background", "Background",
+                  util::ordinalScale(0.0f, 1.0f)
+                      .set("Value where the tensor field vanishes"_help)}
+    , threads_{"threads", "Threads",
+               util::ordinalCount(size_t{0}, size_t{64})
+                   .set("Number of parallel jobs, zero uses the default of the thread pool"_help)} {
+
+    addPorts(inport_, outport_);
+    addProperties(outputDimensions_, kernelLength_, streamlineLength_, stepLength_, minor_, seed_,
+                  background_, threads_);
+}
+
+void TensorFieldLICCPU::process() {
+    const tensorutil::HyperLICSettings settings{.dimensions = outputDimensions_.get(),
+                                                .kernelLength = kernelLength_.get(),
+                                                .streamlineLength = streamlineLength_.get(),
+                                                .stepLength = stepLength_.get(),
+                                                .minor = minor_.get(),
+                                                .threads = threads_.get(),
+                                                .seed = static_cast<std::uint32_t>(seed_.get()),
+                                                .background = background_.get()};
+
+    outport_.setData(tensorutil::hyperLIC(*inport_.getData(), settings));
+}
+
+}  // namespace inviwo
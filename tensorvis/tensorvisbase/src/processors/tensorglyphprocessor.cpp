@@ -29,6 +29,11 @@
 
 #include <inviwo/tensorvisbase/processors/tensorglyphprocessor.h>
 #include <inviwo/tensorvisbase/util/tensorutil.h>
+#include <inviwo/core/datastructures/geometry/basicmesh.h>
+#include <inviwo/core/util/foreach.h>
+
+#include <limits>
+#include <span>
 
 namespace inviwo {
 
@@ -47,13 +52,26 @@ TensorGlyphProcessor::TensorGlyphProcessor()
     : Processor()
     , inport_("inport")
     , outport_("outport")
+    , meshOutport_("mesh")
+    , outputMode_{"outputMode",
+                  "Output mode",
+                  "Output one mesh per glyph, or all glyphs merged into a single mesh"_help,
+                  {{"separate", "Separate meshes", OutputMode::Separate},
+                   {"merged", "Merged mesh", OutputMode::Merged}},
+                  0}
+    , stride_("stride", "Stride", "Generate a glyph for every n-th voxel along each axis"_help, 1,
+              {1, ConstraintBehavior::Immutable}, {16, ConstraintBehavior::Ignore})
+    , minNorm_("minNorm", "Minimum norm",
+               "Skip tensors with a Frobenius norm below this threshold"_help, 0.0,
+               {0.0, ConstraintBehavior::Immutable}, {1.0, ConstraintBehavior::Ignore})
     , glyphParameters_("glyphParameters", "Glyph parameters")
 
 {
     addPort(outport_);
+    addPort(meshOutport_);
     addPort(inport_);
 
-    addProperty(glyphParameters_);
+    addProperties(outputMode_, stride_, minNorm_, glyphParameters_);
 }
 
 void TensorGlyphProcessor::process() {
@@ -61,34 +79,111 @@ void TensorGlyphProcessor::process() {
 
     auto tensorField = inport_.getData();
 
-    auto dimensions = tensorField->getDimensions();
-
-    util::IndexMapper3D indexMapper(dimensions);
+    const auto voxels = selectVoxels(*tensorField);
 
-    auto comp = glm::zero<dmat3>();
+    if (outputMode_.get() == OutputMode::Merged) {
+        outport_.clear();
+        meshOutport_.setData(mergeGlyphs(tensorField, voxels));
+        return;
+    }
 
-    auto meshes = new std::vector<std::shared_ptr<Mesh>>();
+    util::IndexMapper3D indexMapper(tensorField->getDimensions());
 
     const vec3 voxelDist{tensorField->getSpacing()};
     const vec3 offset{tensorField->getOffset()};
 
-    for (size_t z = 0; z < dimensions.z; z++) {
-        for (size_t y = 0; y < dimensions.y; y++) {
-            for (size_t x = 0; x < dimensions.x; x++) {
-                const auto& tensor = tensorField->at(size3_t(x, y, z)).second;
-                if (tensor == comp) continue;
-                const auto index = indexMapper(size3_t(x, y, z));
+    auto meshes = std::make_shared<std::vector<std::shared_ptr<Mesh>>>(voxels.size());
 
-                // const auto dpos = tensorField->getNormalizedVolumePosition(index);
-                // const auto pos = vec3(dpos);
+    util::forEachParallel(voxels, [&](const size3_t& voxel, size_t i) {
+        const vec3 pos{voxelDist * vec3{voxel} + offset};
+        (*meshes)[i] = glyphParameters_.generateGlyph(tensorField, indexMapper(voxel), pos);
+    });
+
+    meshOutport_.clear();
+    outport_.setData(meshes);
+}
 
-                const vec3 pos{voxelDist * vec3{x, y, z} + offset};
+std::vector<size3_t> TensorGlyphProcessor::selectVoxels(const TensorField3D& tensorField) const {
+    const auto dimensions = tensorField.getDimensions();
+    const auto stride = std::max<size_t>(stride_.get(), 1);
+    const auto minNormSquared = minNorm_.get() * minNorm_.get();
+    const auto comp = glm::zero<dmat3>();
 
-                meshes->emplace_back(glyphParameters_.generateGlyph(tensorField, index, pos));
+    std::vector<size3_t> voxels;
+    voxels.reserve(glm::compMul((dimensions + stride - size_t{1}) / stride));
+
+    for (size_t z = 0; z < dimensions.z; z += stride) {
+        for (size_t y = 0; y < dimensions.y; y += stride) {
+            for (size_t x = 0; x < dimensions.x; x += stride) {
+                const auto& tensor = tensorField.at(size3_t(x, y, z)).second;
+                if (tensor == comp) continue;
+
+                double normSquared = 0.0;
+                for (glm::length_t i = 0; i < 3; ++i) {
+                    normSquared += glm::dot(tensor[i], tensor[i]);
+                }
+                if (normSquared < minNormSquared) continue;
+
+                voxels.emplace_back(x, y, z);
             }
         }
     }
+    return voxels;
+}
 
-    outport_.setData(meshes);
+std::shared_ptr<BasicMesh> TensorGlyphProcessor::mergeGlyphs(
+    std::shared_ptr<const TensorField3D> tensorField, const std::vector<size3_t>& voxels) {
+
+    auto merged = std::make_shared<BasicMesh>();
+    auto mergedIndices = merged->addIndexBuffer(DrawType::Triangles, ConnectivityType::None);
+    if (voxels.empty()) return merged;
+
+    // All glyphs share the topology of the deformed base shape, so the size of the merged
+    // buffers is known up front and each glyph is written directly at its offset.
+    const auto glyphSize = glyphParameters_.glyphSize();
+    const size_t glyphVertices = glyphSize.first;
+    const size_t glyphIndices = glyphSize.second;
+    if (glyphVertices == 0) return merged;
+
+    if (glyphVertices * voxels.size() > std::numeric_limits<uint32_t>::max()) {
+        throw Exception(IVW_CONTEXT, "Too many glyph vertices ({}) for a single mesh",
+                        glyphVertices * voxels.size());
+    }
+
+    auto& vertices =
+        merged->getEditableVertices()->getEditableRAMRepresentation()->getDataContainer();
+    auto& normals =
+        merged->getEditableNormals()->getEditableRAMRepresentation()->getDataContainer();
+    auto& texCoords =
+        merged->getEditableTexCoords()->getEditableRAMRepresentation()->getDataContainer();
+    auto& colors = merged->getEditableColors()->getEditableRAMRepresentation()->getDataContainer();
+    auto& indices = mergedIndices->getDataContainer();
+
+    vertices.resize(glyphVertices * voxels.size());
+    normals.resize(glyphVertices * voxels.size());
+    texCoords.resize(glyphVertices * voxels.size());
+    colors.resize(glyphVertices * voxels.size());
+    indices.resize(glyphIndices * voxels.size());
+
+    util::IndexMapper3D indexMapper(tensorField->getDimensions());
+
+    const vec3 voxelDist{tensorField->getSpacing()};
+    const vec3 offset{tensorField->getOffset()};
+
+    util::forEachParallel(voxels, [&](const size3_t& voxel, size_t i) {
+        const vec3 pos{voxelDist * vec3{voxel} + offset};
+        const auto vertexOffset = i * glyphVertices;
+        glyphParameters_.writeGlyph(
+            tensorField, indexMapper(voxel), pos,
+            std::span{vertices}.subspan(vertexOffset, glyphVertices),
+            std::span{normals}.subspan(vertexOffset, glyphVertices),
+            std::span{texCoords}.subspan(vertexOffset, glyphVertices),
+            std::span{colors}.subspan(vertexOffset, glyphVertices),
+            std::span{indices}.subspan(i * glyphIndices, glyphIndices),
+            static_cast<uint32_t>(vertexOffset));
+    });
+
+    return merged;
 }
+
 }  // namespace inviwo
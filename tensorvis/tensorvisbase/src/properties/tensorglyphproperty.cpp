@@ -34,6 +34,20 @@
 
 namespace inviwo {
 
+namespace {
+
+std::shared_ptr<BasicMesh> toMesh(const std::vector<DeformableSphere>& spheres) {
+    if (spheres.empty()) return std::make_shared<BasicMesh>();
+
+    auto mesh = spheres.front().getGeometry();
+    for (auto it = std::next(spheres.begin()); it != spheres.end(); ++it) {
+        mesh->append(it->getGeometry().get());
+    }
+    return mesh;
+}
+
+}  // namespace
+
 std::string_view TensorGlyphProperty::getClassIdentifier() const { return classIdentifier; }
 
 // constexpr std::array<std::array<dvec2, 3>, 10> TensorGlyphProperty::tri_uv;
@@ -184,11 +198,9 @@ std::pair<bool, dvec3> TensorGlyphProperty::intersectTriangle(
     return {true, dvec3(1. - v - w, v, w)};
 }
 
-const std::shared_ptr<BasicMesh> TensorGlyphProperty::generateSuperquadric(
+DeformableSphere TensorGlyphProperty::generateSuperquadric(
     std::shared_ptr<const TensorField3D> tensorField, size_t index, const dvec3 pos,
     const dvec4& color, const float size) {
-    DeformableSphere sphere(resolutionTheta_.get(), resolutionPhi_.get(), color);
-
     auto eigenValuesAndEigenVectors =
         tensorField->getSortedEigenValuesAndEigenVectorsForTensor(index);
 
@@ -228,10 +240,10 @@ const std::shared_ptr<BasicMesh> TensorGlyphProperty::generateSuperquadric(
         basis[2] = -basis[2];
     }
 
-    auto mesh = createSuperquadric(eigenValues, pos, size, color);
-    mesh->setBasis(basis);
+    auto sphere = createSuperquadric(eigenValues, pos, size, color);
+    sphere.setBasis(mat3(basis));
 
-    return mesh;
+    return sphere;
 }
 
 const std::shared_ptr<BasicMesh> TensorGlyphProperty::generateSuperquadric(const dmat3&,
@@ -247,13 +259,13 @@ const std::shared_ptr<BasicMesh> TensorGlyphProperty::generateSuperquadric(
 
     auto basis = glm::diagonal3x3(dvec3(eigenValues[0], eigenValues[1], eigenValues[2]));
 
-    auto mesh = createSuperquadric(eigenValues, pos, size, color);
-    mesh->setBasis(basis);
+    auto sphere = createSuperquadric(eigenValues, pos, size, color);
+    sphere.setBasis(mat3(basis));
 
-    return mesh;
+    return sphere.getGeometry();
 }
 
-std::shared_ptr<BasicMesh> TensorGlyphProperty::createSuperquadric(
+DeformableSphere TensorGlyphProperty::createSuperquadric(
     const std::array<double, 3>& eigenValues, const dvec3& pos, const float size,
     const dvec4& color) const {
     DeformableSphere sphere(resolutionTheta_.get(), resolutionPhi_.get(), color);
@@ -297,10 +309,10 @@ std::shared_ptr<BasicMesh> TensorGlyphProperty::createSuperquadric(
         false);
     sphere.transform(pos, dvec3(size));
 
-    return sphere.getGeometry();
+    return sphere;
 }
 
-const std::shared_ptr<BasicMesh> TensorGlyphProperty::generateReynolds(
+DeformableSphere TensorGlyphProperty::generateReynolds(
     std::shared_ptr<const TensorField3D> tensorField, size_t index, const dvec3 pos,
     const float size) {
     DeformableSphere sphere(resolutionTheta_.get(), resolutionPhi_.get());
@@ -321,10 +333,10 @@ const std::shared_ptr<BasicMesh> TensorGlyphProperty::generateReynolds(
 
     sphere.transform(pos, dvec3(size));
 
-    return sphere.getGeometry();
+    return sphere;
 }
 
-const std::shared_ptr<BasicMesh> TensorGlyphProperty::generateQuadric(
+DeformableSphere TensorGlyphProperty::generateQuadric(
     std::shared_ptr<const TensorField3D> tensorField, size_t index, const dvec3 pos,
     const dvec4& color, const float size) {
     DeformableSphere sphere(resolutionTheta_.get(), resolutionPhi_.get(), color);
@@ -335,7 +347,7 @@ const std::shared_ptr<BasicMesh> TensorGlyphProperty::generateQuadric(
 
     sphere.transform(pos, dvec3(size));
 
-    return sphere.getGeometry();
+    return sphere;
 }
 
 const std::shared_ptr<BasicMesh> TensorGlyphProperty::generateQuadric(const dmat3& tensor,
@@ -377,7 +389,7 @@ const std::shared_ptr<BasicMesh> TensorGlyphProperty::generateCylinder(const dma
     return cylinder.getGeometry();
 }
 
-const std::shared_ptr<BasicMesh> TensorGlyphProperty::generateHWY(
+DeformableSphere TensorGlyphProperty::generateHWY(
     std::shared_ptr<const TensorField3D> tensorField, size_t index, const dvec3 pos,
     const dvec4& color, const float size) {
     DeformableSphere sphere(resolutionTheta_.get(), resolutionPhi_.get(), color);
@@ -395,20 +407,10 @@ const std::shared_ptr<BasicMesh> TensorGlyphProperty::generateHWY(
 
     sphere.transform(pos, dvec3(size));
 
-    return sphere.getGeometry();
-}
-
-const std::shared_ptr<BasicMesh> TensorGlyphProperty::generateCombinedReynoldsHWY(
-    std::shared_ptr<const TensorField3D> tensorField, size_t index, const dvec3 pos,
-    const dvec4& color, const float size) {
-    auto reynolds = generateReynolds(tensorField, index, pos, size);
-    auto hwy = generateHWY(tensorField, index, pos, color, size);
-    reynolds->append(hwy.get());
-
-    return reynolds;
+    return sphere;
 }
 
-const std::shared_ptr<BasicMesh> TensorGlyphProperty::generateSuperquadricExtended(
+DeformableSphere TensorGlyphProperty::generateSuperquadricExtended(
     std::shared_ptr<const TensorField3D> tensorField, size_t index, const dvec3 pos,
     const float size) {
     std::array<std::array<dvec2, 3>, 10> tri_uv{
@@ -558,98 +560,108 @@ const std::shared_ptr<BasicMesh> TensorGlyphProperty::generateSuperquadricExtend
 
     sphere.transform(pos, dvec3(size));
 
-    auto mesh = sphere.getGeometry();
-
-    mesh->setBasis(basis);
+    sphere.setBasis(mat3(basis));
 
-    return mesh;
+    return sphere;
 }
 
-const std::shared_ptr<BasicMesh> TensorGlyphProperty::generateGlyph(
-    std::shared_ptr<const TensorField3D> tensorField, size_t index, const dvec3 pos) {
+std::vector<DeformableSphere> TensorGlyphProperty::generateSpheres(
+    std::shared_ptr<const TensorField3D> tensorField, size_t index, const dvec3 pos,
+    const dvec4& color, const float size) {
+    std::vector<DeformableSphere> spheres;
     switch (glyphType_.get()) {
         case GlyphType::Reynolds:
-            return generateReynolds(tensorField, index, pos, size_.get());
+            spheres.push_back(generateReynolds(tensorField, index, pos, size));
+            break;
         case GlyphType::HYW:
-            return generateHWY(tensorField, index, pos, color_.get(), size_.get());
+            spheres.push_back(generateHWY(tensorField, index, pos, color, size));
+            break;
         case GlyphType::CombinedReynoldsHYW:
-            return generateCombinedReynoldsHWY(tensorField, index, pos, color_.get(), size_.get());
+            spheres.reserve(2);
+            spheres.push_back(generateReynolds(tensorField, index, pos, size));
+            spheres.push_back(generateHWY(tensorField, index, pos, color, size));
+            break;
         case GlyphType::Superquadric:
-            return generateSuperquadric(tensorField, index, pos, color_.get(), size_.get());
+            spheres.push_back(generateSuperquadric(tensorField, index, pos, color, size));
+            break;
         case GlyphType::SuperquadricExtended:
-            return generateSuperquadricExtended(tensorField, index, pos, size_.get());
+            spheres.push_back(generateSuperquadricExtended(tensorField, index, pos, size));
+            break;
         case GlyphType::Quadric:
-            return generateQuadric(tensorField, index, pos, color_.get(), size_.get());
+            spheres.push_back(generateQuadric(tensorField, index, pos, color, size));
+            break;
         default:
             break;
     }
-    return std::make_shared<BasicMesh>();
+    return spheres;
+}
+
+const std::shared_ptr<BasicMesh> TensorGlyphProperty::generateGlyph(
+    std::shared_ptr<const TensorField3D> tensorField, size_t index, const dvec3 pos) {
+    return toMesh(generateSpheres(tensorField, index, pos, color_.get(), size_.get()));
 }
 
 const std::shared_ptr<BasicMesh> TensorGlyphProperty::generateGlyph(
     std::shared_ptr<const TensorField3D> tensorField, size_t index, const dvec3 pos,
     const dvec4& color) {
-    switch (glyphType_.get()) {
-        case GlyphType::Reynolds:
-            return generateReynolds(tensorField, index, pos, size_.get());
-        case GlyphType::HYW:
-            return generateHWY(tensorField, index, pos, color, size_.get());
-        case GlyphType::CombinedReynoldsHYW:
-            return generateCombinedReynoldsHWY(tensorField, index, pos, color, size_.get());
-        case GlyphType::Superquadric:
-            return generateSuperquadric(tensorField, index, pos, color, size_.get());
-        case GlyphType::SuperquadricExtended:
-            return generateSuperquadricExtended(tensorField, index, pos, size_.get());
-        case GlyphType::Quadric:
-            return generateQuadric(tensorField, index, pos, color, size_.get());
-        default:
-            break;
-    }
-    return std::make_shared<BasicMesh>();
+    return toMesh(generateSpheres(tensorField, index, pos, color, size_.get()));
 }
 
 const std::shared_ptr<BasicMesh> TensorGlyphProperty::generateGlyph(
     std::shared_ptr<const TensorField3D> tensorField, size_t index, const dvec3 pos,
     const float size) {
-    switch (glyphType_.get()) {
-        case GlyphType::Reynolds:
-            return generateReynolds(tensorField, index, pos, size);
-        case GlyphType::HYW:
-            return generateHWY(tensorField, index, pos, color_.get(), size);
-        case GlyphType::CombinedReynoldsHYW:
-            return generateCombinedReynoldsHWY(tensorField, index, pos, color_.get(), size);
-        case GlyphType::Superquadric:
-            return generateSuperquadric(tensorField, index, pos, color_.get(), size);
-        case GlyphType::SuperquadricExtended:
-            return generateSuperquadricExtended(tensorField, index, pos, size);
-        case GlyphType::Quadric:
-            return generateQuadric(tensorField, index, pos, color_.get(), size);
-        default:
-            break;
-    }
-    return std::make_shared<BasicMesh>();
+    return toMesh(generateSpheres(tensorField, index, pos, color_.get(), size));
 }
 
 const std::shared_ptr<BasicMesh> TensorGlyphProperty::generateGlyph(
     std::shared_ptr<const TensorField3D> tensorField, size_t index, const dvec3 pos,
     const dvec4& color, const float size) {
+    return toMesh(generateSpheres(tensorField, index, pos, color, size));
+}
+
+std::pair<size_t, size_t> TensorGlyphProperty::glyphSize() const {
+    size_t spheres = 0;
     switch (glyphType_.get()) {
         case GlyphType::Reynolds:
-            return generateReynolds(tensorField, index, pos, size);
         case GlyphType::HYW:
-            return generateHWY(tensorField, index, pos, color, size);
-        case GlyphType::CombinedReynoldsHYW:
-            return generateCombinedReynoldsHWY(tensorField, index, pos, color, size);
         case GlyphType::Superquadric:
-            return generateSuperquadric(tensorField, index, pos, color, size);
         case GlyphType::SuperquadricExtended:
-            return generateSuperquadricExtended(tensorField, index, pos, size);
         case GlyphType::Quadric:
-            return generateQuadric(tensorField, index, pos, color, size);
+            spheres = 1;
+            break;
+        case GlyphType::CombinedReynoldsHYW:
+            spheres = 2;
+            break;
         default:
             break;
     }
-    return std::make_shared<BasicMesh>();
+    const auto theta = resolutionTheta_.get();
+    const auto phi = resolutionPhi_.get();
+    return {spheres * DeformableSphere::numberOfVertices(theta, phi),
+            spheres * DeformableSphere::numberOfIndices(theta, phi)};
+}
+
+void TensorGlyphProperty::writeGlyph(std::shared_ptr<const TensorField3D> tensorField,
+                                     size_t index, const dvec3 pos, std::span<vec3> vertices,
+                                     std::span<vec3> normals, std::span<vec3> texCoords,
+                                     std::span<vec4> colors, std::span<uint32_t> indices,
+                                     uint32_t vertexOffset) {
+    const auto theta = resolutionTheta_.get();
+    const auto phi = resolutionPhi_.get();
+    const size_t sphereVertices = DeformableSphere::numberOfVertices(theta, phi);
+    const size_t sphereIndices = DeformableSphere::numberOfIndices(theta, phi);
+
+    size_t vertex = 0;
+    size_t idx = 0;
+    for (const auto& sphere : generateSpheres(tensorField, index, pos, color_.get(), size_.get())) {
+        sphere.write(vertices.subspan(vertex, sphereVertices),
+                     normals.subspan(vertex, sphereVertices),
+                     texCoords.subspan(vertex, sphereVertices),
+                     colors.subspan(vertex, sphereVertices), indices.subspan(idx, sphereIndices),
+                     static_cast<uint32_t>(vertexOffset + vertex));
+        vertex += sphereVertices;
+        idx += sphereIndices;
+    }
 }
 
 const std::shared_ptr<BasicMesh> TensorGlyphProperty::generateGlyph(const dmat3& tensor,
@@ -56,6 +56,7 @@
 #include <inviwo/tensorvisbase/processors/tensorfield3dsubset.h>
 #include <inviwo/tensorvisbase/processors/tensorfieldgenerator.h>
 #include <inviwo/tensorvisbase/processors/tensorfieldlic.h>
+#include <inviwo/tensorvisbase/processors/tensorfieldliccpu.h>
 #include <inviwo/tensorvisbase/processors/tensorfieldslice.h>
 #include <inviwo/tensorvisbase/processors/tensorfieldtorgba.h>
 #include <inviwo/tensorvisbase/processors/tensorfieldtovolume.h>
@@ -90,6 +91,7 @@ TensorVisBaseModule::TensorVisBaseModule(InviwoApplication* app)
     registerProcessor<TensorField3DSubset>();
     registerProcessor<TensorFieldGenerator>();
     registerProcessor<TensorFieldLIC>();
+    registerProcessor<TensorFieldLICCPU>();
     registerProcessor<TensorFieldSlice>();
     registerProcessor<TensorFieldToRGBA>();
     registerProcessor<TensorFieldToVolume>();
@@ -0,0 +1,118 @@
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <inviwo/tensorvisbase/algorithm/hyperlic.h>
+#include <inviwo/core/datastructures/image/layer.h>
+#include <inviwo/core/datastructures/image/layerram.h>
+
+#include <fmt/format.h>
+
+#include <chrono>
+
+namespace inviwo {
+
+namespace {
+
+/// A field with the major eigenvectors along x and the minor along y
+std::shared_ptr<TensorField2D> uniformField(size2_t dims) {
+    return std::make_shared<TensorField2D>(
+        dims, std::vector<dmat2>(glm::compMul(dims), dmat2{dvec2{2.0, 0.0}, dvec2{0.0, 1.0}}));
+}
+
+std::vector<float> pixels(const Layer& layer) {
+    const auto* ram = layer.getRepresentation<LayerRAM>();
+    const auto* data = static_cast<const float*>(ram->getData());
+    return {data, data + glm::compMul(layer.getDimensions())};
+}
+
+/// Mean absolute difference between neighbouring pixels along x and along y
+std::pair<double, double> gradients(const std::vector<float>& img, size2_t dims) {
+    double dx = 0.0;
+    double dy = 0.0;
+    for (size_t y = 1; y < dims.y; ++y) {
+        for (size_t x = 1; x < dims.x; ++x) {
+            const auto v = img[x + y * dims.x];
+            dx += std::abs(v - img[x - 1 + y * dims.x]);
+            dy += std::abs(v - img[x + (y - 1) * dims.x]);
+        }
+    }
+    const auto n = static_cast<double>((dims.x - 1) * (dims.y - 1));
+    return {dx / n, dy / n};
+}
+
+}  // namespace
+
+TEST(HyperLICTests, SmoothsAlongEigenvectors) {
+    const size2_t dims{128, 96};
+    const auto field = uniformField(size2_t{16, 12});
+
+    tensorutil::HyperLICSettings settings{.dimensions = dims, .kernelLength = 10};
+    const auto major = pixels(*tensorutil::hyperLIC(*field, settings));
+    settings.minor = true;
+    const auto minor = pixels(*tensorutil::hyperLIC(*field, settings));
+
+    const auto [majorDx, majorDy] = gradients(major, dims);
+    EXPECT_LT(majorDx * 4.0, majorDy);
+
+    const auto [minorDx, minorDy] = gradients(minor, dims);
+    EXPECT_LT(minorDy * 4.0, minorDx);
+}
+
+TEST(HyperLICTests, IndependentOfThreadCount) {
+    const auto field = uniformField(size2_t{8, 8});
+    tensorutil::HyperLICSettings settings{.dimensions = size2_t{100, 70}, .tileSize = 16};
+
+    settings.threads = 1;
+    const auto serial = pixels(*tensorutil::hyperLIC(*field, settings));
+    settings.threads = 4;
+    const auto parallel = pixels(*tensorutil::hyperLIC(*field, settings));
+
+    EXPECT_EQ(serial, parallel);
+}
+
+TEST(HyperLICTests, ReusesStreamlines) {
+    const size2_t dims{128, 128};
+    const auto field = uniformField(size2_t{4, 4});
+
+    tensorutil::HyperLICStats stats;
+    tensorutil::hyperLIC(*field, {.dimensions = dims, .kernelLength = 10}, &stats);
+
+    EXPECT_GT(stats.streamlines, 0u);
+    EXPECT_LT(stats.streamlines * 4, glm::compMul(dims));
+}
+
+TEST(HyperLICTests, Background) {
+    const size2_t dims{32, 32};
+    const auto field =
+        std::make_shared<TensorField2D>(size2_t{4, 4}, std::vector<dmat2>(16, dmat2{0.0}));
+
+    const auto img =
+        pixels(*tensorutil::hyperLIC(*field, {.dimensions = dims, .background = 0.25f}));
+    for (auto v : img) EXPECT_EQ(v, 0.25f);
+}
+
+/**
+ * Micro benchmark over image size and kernel length, run with --gtest_also_run_disabled_tests
+ */
+TEST(HyperLICTests, DISABLED_Benchmark) {
+    using clock = std::chrono::steady_clock;
+    const auto field = uniformField(size2_t{64, 64});
+
+    for (const size_t size : {256, 512, 1024, 2048}) {
+        for (const size_t kernel : {10, 20, 40}) {
+            tensorutil::HyperLICStats stats;
+            const auto start = clock::now();
+            tensorutil::hyperLIC(*field,
+                                 {.dimensions = size2_t{size}, .kernelLength = kernel,
+                                  .streamlineLength = 3 * kernel},
+                                 &stats);
+            const auto ms = std::chrono::duration<double, std::milli>(clock::now() - start).count();
+            fmt::print("[ BENCH    ] {:>4}^2 kernel {:>3}: {:9.1f} ms, {:>8} streamlines\n", size,
+                       kernel, ms, stats.streamlines);
+        }
+    }
+}
+
+}  // namespace inviwo
@@ -0,0 +1,177 @@
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <inviwo/tensorvisbase/algorithm/tensorfieldslicing.h>
+#include <inviwo/tensorvisbase/util/tensorutil.h>
+
+#include <glm/gtx/component_wise.hpp>
+
+namespace inviwo {
+
+namespace {
+
+/// Symmetric tensors that depend linearly on the voxel position, so trilinear
+/// interpolation reproduces them exactly
+dmat3 linearTensor(const dvec3& p) {
+    return dmat3{dvec3{1.0 + p.x, p.y, p.z}, dvec3{p.y, 2.0 + 0.5 * p.z, 0.0},
+                 dvec3{p.z, 0.0, 3.0 - p.x}};
+}
+
+std::shared_ptr<TensorField3D> linearField(size3_t dims) {
+    std::vector<dmat3> data;
+    data.reserve(glm::compMul(dims));
+    for (size_t z = 0; z < dims.z; ++z) {
+        for (size_t y = 0; y < dims.y; ++y) {
+            for (size_t x = 0; x < dims.x; ++x) {
+                data.push_back(linearTensor(dvec3{x, y, z}));
+            }
+        }
+    }
+    return std::make_shared<TensorField3D>(dims, std::move(data), vec3{2.0f, 3.0f, 4.0f});
+}
+
+void expectNear(const dmat3& a, const dmat3& b) {
+    for (glm::length_t c = 0; c < 3; ++c) {
+        for (glm::length_t r = 0; r < 3; ++r) EXPECT_NEAR(a[c][r], b[c][r], 1e-9);
+    }
+}
+
+}  // namespace
+
+TEST(TensorFieldSlicingTests, AxisAlignedSlices) {
+    const size3_t dims{5, 4, 3};
+    const auto field = linearField(dims);
+
+    const auto x = slice<3>(field, CartesianCoordinateAxis::X, 2);
+    const auto y = slice<3>(field, CartesianCoordinateAxis::Y, 1);
+    const auto z = slice<3>(field, CartesianCoordinateAxis::Z, 2);
+    EXPECT_EQ(x->getDimensions(), size3_t(1, 4, 3));
+    EXPECT_EQ(y->getDimensions(), size3_t(5, 1, 3));
+    EXPECT_EQ(z->getDimensions(), size3_t(5, 4, 1));
+
+    const auto y2 = slice<2>(field, CartesianCoordinateAxis::Y, 1);
+    ASSERT_EQ(y2->getDimensions(), size2_t(5, 3));
+
+    for (size_t k = 0; k < dims.z; ++k) {
+        for (size_t j = 0; j < dims.y; ++j) {
+            EXPECT_EQ(x->at(0, j, k).second, field->at(2, j, k).second);
+        }
+        for (size_t i = 0; i < dims.x; ++i) {
+            EXPECT_EQ(y->at(i, 0, k).second, field->at(i, 1, k).second);
+            EXPECT_EQ(y2->at(i, k), tensorutil::getProjectedTensor(field->at(i, 1, k).second,
+                                                                   CartesianCoordinateAxis::Y));
+        }
+    }
+    for (size_t j = 0; j < dims.y; ++j) {
+        for (size_t i = 0; i < dims.x; ++i) {
+            EXPECT_EQ(z->at(i, j, 0).second, field->at(i, j, 2).second);
+        }
+    }
+
+    EXPECT_THROW(slice<2>(field, CartesianCoordinateAxis::Z, 3), Exception);
+}
+
+TEST(TensorFieldSlicingTests, ObliqueMatchesAxisAligned) {
+    const size3_t dims{6, 5, 4};
+    const auto field = linearField(dims);
+
+    const SlicePlane plane{.origin = dvec3{0.0, 0.0, 2.0 / 3.0},
+                           .uAxis = dvec3{1.0, 0.0, 0.0},
+                           .vAxis = dvec3{0.0, 1.0, 0.0},
+                           .dimensions = size2_t{6, 5}};
+    const auto oblique = obliqueSlice(*field, plane);
+    const auto aligned = slice<2>(field, CartesianCoordinateAxis::Z, 2);
+
+    ASSERT_EQ(oblique->getDimensions(), aligned->getDimensions());
+    EXPECT_EQ(oblique->getExtent(), aligned->getExtent());
+    for (size_t i = 0; i < oblique->getSize(); ++i) {
+        for (glm::length_t c = 0; c < 2; ++c) {
+            for (glm::length_t r = 0; r < 2; ++r) {
+                EXPECT_NEAR(oblique->at(i)[c][r], aligned->at(i)[c][r], 1e-9);
+            }
+        }
+    }
+}
+
+TEST(TensorFieldSlicingTests, ObliqueInterpolation) {
+    const size3_t dims{9, 7, 5};
+    const auto field = linearField(dims);
+
+    // A diagonal plane through the volume, sampled between the voxels
+    const SlicePlane plane{.origin = dvec3{0.1, 0.05, 0.2},
+                           .uAxis = dvec3{0.8, 0.3, 0.0},
+                           .vAxis = dvec3{0.0, 0.4, 0.7},
+                           .dimensions = size2_t{13, 11}};
+    const auto stack = obliqueSliceStack(*field, plane, dvec3{0.0}, 1);
+    ASSERT_EQ(stack->getDimensions(), size3_t(13, 11, 1));
+
+    for (size_t j = 0; j < plane.dimensions.y; ++j) {
+        for (size_t i = 0; i < plane.dimensions.x; ++i) {
+            const auto index = plane.position(size2_t{i, j}) * dvec3{dims - size_t{1}};
+            expectNear(stack->at(i, j, 0).second, linearTensor(index));
+        }
+    }
+
+    // Outside of the field the tensors are zero
+    const SlicePlane outside{.origin = dvec3{1.5, 0.0, 0.0}, .dimensions = size2_t{4, 4}};
+    const auto empty = obliqueSlice(*field, outside);
+    for (size_t i = 0; i < empty->getSize(); ++i) EXPECT_EQ(empty->at(i), dmat2{0.0});
+}
+
+TEST(TensorFieldSlicingTests, StackReusesWeights) {
+    const size3_t dims{9, 7, 11};
+    const auto field = linearField(dims);
+
+    const SlicePlane plane{.origin = dvec3{0.05, 0.1, 0.0},
+                           .uAxis = dvec3{0.7, 0.35, 0.0},
+                           .vAxis = dvec3{-0.05, 0.6, 0.0},
+                           .dimensions = size2_t{10, 8}};
+    // One voxel per slice along z, so the in plane weights are shared by all slices
+    const dvec3 step{0.0, 0.0, 1.0 / 10.0};
+    const size_t count = 11;
+
+    const auto stack = obliqueSliceStack(*field, plane, step, count);
+    ASSERT_EQ(stack->getDimensions(), size3_t(10, 8, count));
+
+    for (size_t k = 0; k < count; ++k) {
+        auto shifted = plane;
+        shifted.origin += step * static_cast<double>(k);
+        // Perturb the step slightly to take the path without shared weights
+        const auto single = obliqueSliceStack(*field, shifted, dvec3{1e-3, 0.0, 0.0}, 1);
+        for (size_t j = 0; j < plane.dimensions.y; ++j) {
+            for (size_t i = 0; i < plane.dimensions.x; ++i) {
+                expectNear(stack->at(i, j, k).second, single->at(i, j, 0).second);
+            }
+        }
+    }
+}
+
+TEST(TensorFieldSlicingTests, StackEntersVolume) {
+    const size3_t dims{9, 7, 11};
+    const auto field = linearField(dims);
+
+    // The first slices lie below the field, the later ones move into it whole voxels at a time
+    const SlicePlane plane{.origin = dvec3{0.1, 0.2, -0.3},
+                           .uAxis = dvec3{0.8, 0.0, 0.0},
+                           .vAxis = dvec3{0.0, 0.7, 0.0},
+                           .dimensions = size2_t{9, 8}};
+    const dvec3 step{0.0, 0.0, 1.0 / 10.0};
+    const size_t count = 16;
+
+    const auto stack = obliqueSliceStack(*field, plane, step, count);
+    for (size_t k = 0; k < count; ++k) {
+        for (size_t j = 0; j < plane.dimensions.y; ++j) {
+            for (size_t i = 0; i < plane.dimensions.x; ++i) {
+                const auto pos = plane.position(size2_t{i, j}) + step * static_cast<double>(k);
+                const auto index = pos * dvec3{dims - size_t{1}};
+                const bool inside = index.z > -1e-6 && index.z < 10.0 + 1e-6;
+                expectNear(stack->at(i, j, k).second,
+                           inside ? linearTensor(index) : dmat3{0.0});
+            }
+        }
+    }
+}
+
+}  // namespace inviwo
@@ -31,8 +31,11 @@
 #pragma comment(linker, "/SUBSYSTEM:CONSOLE")
 #endif
 
+#include <inviwo/core/common/inviwoapplication.h>
 #include <inviwo/core/util/logcentral.h>
 #include <inviwo/core/util/consolelogger.h>
+#include <inviwo/core/common/coremodulesharedlibrary.h>
+#include <inviwo/core/common/inviwomodulefactoryobject.h>
 #include <inviwo/testutil/configurablegtesteventlistener.h>
 
 #include <warn/push>
@@ -46,6 +49,16 @@ int main(int argc, char** argv) {
     auto logger = std::make_shared<ConsoleLogger>();
     LogCentral::getPtr()->setVerbosity(LogVerbosity::Error);
     LogCentral::getPtr()->registerLogger(logger);
+    // The algorithms run in parallel on the thread pool of the application
+    InviwoApplication app(argc, argv, "Inviwo-Unittests-TensorVisBase");
+
+    {
+        std::vector<std::unique_ptr<InviwoModuleFactoryObject>> modules;
+        modules.emplace_back(createInviwoCore());
+        app.registerModules(std::move(modules));
+    }
+
+    app.processFront();
 
     int ret = -1;
     {
@@ -0,0 +1,82 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+#pragma once
+
+#include <inviwo/tensorvisio/tensorvisiomoduledefine.h>
+#include <inviwo/tensorvisio/io/tensorrawdata.h>
+#include <inviwo/core/util/glmvec.h>
+
+#include <filesystem>
+#include <vector>
+
+namespace inviwo::amira {
+
+/**
+ * The parts of an AmiraMesh header needed to read a tensor field on a uniform lattice. Binary
+ * data in either byte order is supported, uncompressed or HxZip compressed.
+ */
+struct IVW_MODULE_TENSORVISIO_API Header {
+    std::filesystem::path file;
+    size3_t dimensions{0};
+    size_t components = 0;
+    dvec3 boundingBoxMin{0.0};
+    dvec3 boundingBoxMax{1.0};
+    tensorio::ByteOrder byteOrder = tensorio::ByteOrder::Little;
+    /// Size of the HxZip compressed data, zero for uncompressed data
+    size_t compressedSize = 0;
+    /// Byte offset of the data section in the file
+    size_t dataOffset = 0;
+
+    dvec3 extent() const { return boundingBoxMax - boundingBoxMin; }
+
+    /**
+     * Parses the header of `file`, which may be of any length. Throws an Exception for
+     * malformed headers and for layouts that are not supported.
+     */
+    static Header read(const std::filesystem::path& file);
+};
+
+/**
+ * Tensors read from an AmiraMesh file. Six components per voxel are interpreted as the
+ * symmetric xx xy xz yy yz zz, nine as the full tensor in column major order.
+ */
+struct IVW_MODULE_TENSORVISIO_API TensorData {
+    size3_t dimensions{0};
+    dvec3 extent{1.0};
+    std::vector<dmat3> tensors;
+};
+
+/**
+ * Reads the data section in one call, inflates it if needed, and converts byte order and
+ * layout in parallel.
+ */
+IVW_MODULE_TENSORVISIO_API TensorData readTensors(const Header& header);
+IVW_MODULE_TENSORVISIO_API TensorData readTensors(const std::filesystem::path& file);
+
+}  // namespace inviwo::amira
@@ -0,0 +1,97 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+#pragma once
+
+#include <inviwo/tensorvisio/tensorvisiomoduledefine.h>
+#include <inviwo/tensorvisio/io/tensorrawdata.h>
+#include <inviwo/core/util/glmvec.h>
+
+#include <filesystem>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace inviwo::nrrd {
+
+enum class Encoding { Raw, Gzip };
+enum class ValueType { Float, Double };
+
+/**
+ * The parts of a NRRD header needed to read a tensor field. Both attached headers (.nrrd) and
+ * detached headers (.nhdr) are supported, with raw or gzip encoded float or double data.
+ */
+struct IVW_MODULE_TENSORVISIO_API Header {
+    /// All "field: value" lines of the header, with the field names in lower case
+    std::map<std::string, std::string> fields;
+
+    size_t components = 0;
+    size3_t dimensions{0};
+    ValueType type = ValueType::Float;
+    Encoding encoding = Encoding::Raw;
+    tensorio::ByteOrder byteOrder = tensorio::ByteOrder::Big;
+
+    /// The file holding the data, the header file itself for attached headers
+    std::filesystem::path dataFile;
+    /// Byte offset of the data in the data file, after applying line and byte skips
+    size_t dataOffset = 0;
+    /// Bytes to drop after inflating, compressed encodings apply the byte skip to the
+    /// decompressed data
+    size_t decodedSkip = 0;
+
+    size_t valueSize() const;
+    size_t dataSize() const;
+
+    /**
+     * Parses the header of `file`. Throws an Exception for malformed headers and for
+     * dimensions, types and encodings that are not supported.
+     */
+    static Header read(const std::filesystem::path& file);
+};
+
+/**
+ * Tensors read from a NRRD file. The components of every voxel are interpreted as
+ *   6: xx xy xz yy yz zz
+ *   7: confidence xx xy xz yy yz zz, tensors with a confidence other than one are zeroed
+ *   9: the full tensor in column major order
+ * Fields without a confidence component get a confidence of one everywhere.
+ */
+struct IVW_MODULE_TENSORVISIO_API TensorData {
+    size3_t dimensions{0};
+    std::vector<dmat3> tensors;
+    std::vector<float> confidence;
+};
+
+/**
+ * Reads the data section in one call, inflates it if needed, and converts byte order and
+ * layout in parallel.
+ */
+IVW_MODULE_TENSORVISIO_API TensorData readTensors(const Header& header);
+IVW_MODULE_TENSORVISIO_API TensorData readTensors(const std::filesystem::path& file);
+
+}  // namespace inviwo::nrrd
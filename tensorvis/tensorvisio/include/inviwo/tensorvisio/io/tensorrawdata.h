@@ -0,0 +1,131 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+#pragma once
+
+#include <inviwo/tensorvisio/tensorvisiomoduledefine.h>
+#include <inviwo/core/util/glmmat.h>
+#include <inviwo/core/util/foreach.h>
+#include <inviwo/core/util/zip.h>
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <limits>
+#include <span>
+#include <vector>
+
+namespace inviwo::tensorio {
+
+enum class ByteOrder { Little, Big };
+
+constexpr ByteOrder nativeByteOrder() {
+    return std::endian::native == std::endian::big ? ByteOrder::Big : ByteOrder::Little;
+}
+
+/**
+ * Reads `dest.size()` bytes starting at `offset` of `file` with a single read call.
+ * Throws an Exception if the file can not be opened or is too short.
+ */
+IVW_MODULE_TENSORVISIO_API void readBytes(const std::filesystem::path& file, size_t offset,
+                                          std::span<std::byte> dest);
+
+/**
+ * Reads `size` bytes starting at `offset` of `file`, or everything until the end of the file if
+ * no size is given.
+ */
+IVW_MODULE_TENSORVISIO_API std::vector<std::byte> readBytes(
+    const std::filesystem::path& file, size_t offset,
+    size_t size = std::numeric_limits<size_t>::max());
+
+/**
+ * Inflates gzip or zlib compressed data into `dest`. The decompressed size has to match the size
+ * of `dest` exactly, otherwise an Exception is thrown.
+ */
+IVW_MODULE_TENSORVISIO_API void inflate(std::span<const std::byte> compressed,
+                                        std::span<std::byte> dest);
+
+namespace detail {
+
+template <size_t N>
+struct UnsignedOfSize;
+template <>
+struct UnsignedOfSize<2> {
+    using type = std::uint16_t;
+};
+template <>
+struct UnsignedOfSize<4> {
+    using type = std::uint32_t;
+};
+template <>
+struct UnsignedOfSize<8> {
+    using type = std::uint64_t;
+};
+
+/// Written as shifts so that compilers turn it into a (vectorized) byte swap instruction
+template <typename U>
+constexpr U byteswap(U v) {
+    U res = 0;
+    for (size_t b = 0; b < sizeof(U); ++b) {
+        res = static_cast<U>((res << 8) | ((v >> (8 * b)) & U{0xff}));
+    }
+    return res;
+}
+
+}  // namespace detail
+
+/**
+ * Converts `data` between the native byte order and `order` in place.
+ */
+template <typename T>
+void swapBytes(std::span<T> data, ByteOrder order) {
+    if constexpr (sizeof(T) > 1) {
+        if (order == nativeByteOrder()) return;
+        using U = typename detail::UnsignedOfSize<sizeof(T)>::type;
+
+        const auto swap = [&](size_t i) {
+            U v;
+            std::memcpy(&v, &data[i], sizeof(U));
+            v = detail::byteswap(v);
+            std::memcpy(&data[i], &v, sizeof(U));
+        };
+        util::forEachParallel(util::make_sequence(size_t{0}, data.size(), size_t{1}), swap);
+    }
+}
+
+/**
+ * Builds a symmetric tensor from its six unique components ordered xx, xy, xz, yy, yz, zz.
+ */
+template <typename T>
+dmat3 symmetricTensor(const T* c) {
+    return dmat3{dvec3{c[0], c[1], c[2]}, dvec3{c[1], c[3], c[4]}, dvec3{c[2], c[4], c[5]}};
+}
+
+}  // namespace inviwo::tensorio
@@ -53,17 +53,6 @@ private:
     FileProperty inFile_;
 
     TensorField3DOutport outport_;
-
-    /** Find a string in the given buffer and return a pointer
-    to the contents directly behind the SearchString.
-    If not found, return the buffer. A subsequent sscanf()
-    will fail then, but at least we return a decent pointer.
-    */
-    const char* FindAndJump(const char* buffer, const char* SearchString) {
-        const char* FoundLoc = strstr(buffer, SearchString);
-        if (FoundLoc) return FoundLoc + strlen(SearchString);
-        return buffer;
-    }
 };
 
 }  // namespace inviwo
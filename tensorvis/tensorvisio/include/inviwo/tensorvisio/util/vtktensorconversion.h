@@ -0,0 +1,62 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+#pragma once
+
+#include <inviwo/tensorvisio/tensorvisiomoduledefine.h>
+#include <inviwo/core/util/glmmat.h>
+
+#include <vector>
+
+class vtkDataArray;
+
+namespace inviwo::tensorio {
+
+/**
+ * Converts a VTK tensor array into one dmat3 per tuple. Nine component arrays are read in the
+ * same order as a column-major dmat3, six component arrays hold symmetric tensors in the VTK
+ * order xx, yy, zz, xy, yz, xz.
+ *
+ * Contiguous (vtkAOSDataArrayTemplate) float and double arrays are read directly from their
+ * storage in parallel blocks, double arrays with nine components are copied verbatim. Other
+ * array types are converted through their typed component accessors, also in parallel. Arrays
+ * the VTK dispatcher is not built for, such as SOA arrays without VTK_DISPATCH_SOA_ARRAYS, fall
+ * back to vtkDataArray::GetComponent on a single thread.
+ * @throw Exception if the array does not have six or nine components
+ */
+IVW_MODULE_TENSORVISIO_API std::vector<dmat3> vtkToTensors(vtkDataArray* array);
+
+/**
+ * Converts a single component VTK array into doubles, for example for tensor field metadata.
+ * A contiguous double array is copied in bulk, other arrays are converted in parallel blocks.
+ * The result is meant to be moved into the metadata, which owns its values as a std::vector.
+ * @throw Exception if the array has more than one component
+ */
+IVW_MODULE_TENSORVISIO_API std::vector<double> vtkToScalars(vtkDataArray* array);
+
+}  // namespace inviwo::tensorio
@@ -0,0 +1,157 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/tensorvisio/io/amiratensorio.h>
+#include <inviwo/core/util/exception.h>
+#include <inviwo/core/util/foreach.h>
+#include <inviwo/core/util/zip.h>
+
+#include <fmt/std.h>
+
+#include <fstream>
+#include <optional>
+#include <sstream>
+#include <string_view>
+
+namespace inviwo::amira {
+
+namespace {
+
+/// Returns a stream positioned directly after `keyword` in `header`, or nullopt if not found
+std::optional<std::istringstream> after(const std::string& header, std::string_view keyword) {
+    const auto pos = header.find(keyword);
+    if (pos == std::string::npos) return std::nullopt;
+    return std::istringstream{header.substr(pos + keyword.size())};
+}
+
+}  // namespace
+
+Header Header::read(const std::filesystem::path& file) {
+    std::ifstream in(file, std::ios::in | std::ios::binary);
+    if (!in) {
+        throw Exception(SourceContext{}, "Could not find {}", file);
+    }
+
+    Header header;
+    header.file = file;
+
+    std::string line;
+    std::getline(in, line);
+    if (line.starts_with("# AmiraMesh BINARY-LITTLE-ENDIAN")) {
+        header.byteOrder = tensorio::ByteOrder::Little;
+    } else if (line.starts_with("# AmiraMesh BINARY")) {
+        header.byteOrder = tensorio::ByteOrder::Big;
+    } else {
+        throw Exception(SourceContext{}, "Not a proper binary AmiraMesh file: {}", file);
+    }
+
+    std::string text;
+    bool foundData = false;
+    while (std::getline(in, line)) {
+        if (line.starts_with("# Data section follows")) {
+            // The next line is the data marker, "@1"
+            std::getline(in, line);
+            foundData = static_cast<bool>(in);
+            header.dataOffset = static_cast<size_t>(in.tellg());
+            break;
+        }
+        text += line;
+        text += '\n';
+    }
+    if (!foundData) {
+        throw Exception(SourceContext{}, "Missing data section in AmiraMesh file: {}", file);
+    }
+
+    if (auto lattice = after(text, "define Lattice")) {
+        *lattice >> header.dimensions.x >> header.dimensions.y >> header.dimensions.z;
+    }
+    if (glm::compMul(header.dimensions) == 0) {
+        throw Exception(SourceContext{}, "Missing or invalid lattice in AmiraMesh file: {}", file);
+    }
+
+    if (auto bbox = after(text, "BoundingBox")) {
+        *bbox >> header.boundingBoxMin.x >> header.boundingBoxMax.x >> header.boundingBoxMin.y >>
+            header.boundingBoxMax.y >> header.boundingBoxMin.z >> header.boundingBoxMax.z;
+    }
+
+    if (auto comps = after(text, "Lattice { float[")) {
+        *comps >> header.components;
+    }
+    if (header.components != 6 && header.components != 9) {
+        throw Exception(SourceContext{}, "Unsupported number of tensor components {} in {}",
+                        header.components, file);
+    }
+
+    if (auto zip = after(text, "@1(HxZip,")) {
+        *zip >> header.compressedSize;
+        if (header.compressedSize == 0) {
+            throw Exception(SourceContext{}, "Invalid HxZip size in AmiraMesh file: {}", file);
+        }
+    } else if (text.find("@1(") != std::string::npos) {
+        throw Exception(SourceContext{}, "Unsupported data encoding in AmiraMesh file: {}", file);
+    }
+
+    return header;
+}
+
+TensorData readTensors(const Header& header) {
+    const auto count = glm::compMul(header.dimensions);
+    std::vector<float> values(count * header.components);
+    const auto bytes = std::as_writable_bytes(std::span{values});
+
+    if (header.compressedSize > 0) {
+        const auto compressed =
+            tensorio::readBytes(header.file, header.dataOffset, header.compressedSize);
+        tensorio::inflate(compressed, bytes);
+    } else {
+        tensorio::readBytes(header.file, header.dataOffset, bytes);
+    }
+    tensorio::swapBytes(std::span{values}, header.byteOrder);
+
+    TensorData res{header.dimensions, header.extent(), std::vector<dmat3>(count)};
+
+    // Data runs x-fastest, the same order as the tensor field
+    const auto toTensor = [&](size_t i) {
+        const float* v = values.data() + i * header.components;
+        if (header.components == 6) {
+            res.tensors[i] = tensorio::symmetricTensor(v);
+        } else {
+            res.tensors[i] =
+                dmat3{dvec3{v[0], v[1], v[2]}, dvec3{v[3], v[4], v[5]}, dvec3{v[6], v[7], v[8]}};
+        }
+    };
+    util::forEachParallel(util::make_sequence(size_t{0}, count, size_t{1}), toTensor);
+    return res;
+}
+
+TensorData readTensors(const std::filesystem::path& file) {
+    return readTensors(Header::read(file));
+}
+
+}  // namespace inviwo::amira
@@ -0,0 +1,293 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/tensorvisio/io/nrrdtensorio.h>
+#include <inviwo/core/util/exception.h>
+#include <inviwo/core/util/stringconversion.h>
+#include <inviwo/core/util/foreach.h>
+#include <inviwo/core/util/zip.h>
+
+#include <fmt/std.h>
+
+#include <algorithm>
+#include <charconv>
+#include <fstream>
+#include <limits>
+
+namespace inviwo::nrrd {
+
+namespace {
+
+constexpr std::string_view whitespace = " \t";
+
+std::string_view trim(std::string_view str) {
+    const auto first = str.find_first_not_of(whitespace);
+    if (first == std::string_view::npos) return {};
+    return str.substr(first, str.find_last_not_of(whitespace) - first + 1);
+}
+
+std::vector<size_t> parseSizes(std::string_view str, const std::filesystem::path& file) {
+    std::vector<size_t> sizes;
+    const auto* it = str.data();
+    const auto* end = str.data() + str.size();
+    while (it != end) {
+        if (whitespace.find(*it) != std::string_view::npos) {
+            ++it;
+            continue;
+        }
+        size_t value = 0;
+        const auto [ptr, ec] = std::from_chars(it, end, value);
+        if (ec != std::errc{} || (ptr != end && whitespace.find(*ptr) == std::string_view::npos)) {
+            throw Exception(SourceContext{}, "Invalid sizes '{}' in NRRD header {}", str, file);
+        }
+        sizes.push_back(value);
+        it = ptr;
+    }
+    return sizes;
+}
+
+long long parseInteger(const std::string& str, std::string_view field,
+                       const std::filesystem::path& file) {
+    long long value = 0;
+    const auto [ptr, ec] = std::from_chars(str.data(), str.data() + str.size(), value);
+    if (ec != std::errc{} || ptr != str.data() + str.size()) {
+        throw Exception(SourceContext{}, "Invalid {} '{}' in NRRD header {}", field, str, file);
+    }
+    return value;
+}
+
+/// Returns the offset of the first byte after `lines` newlines, starting at `offset`
+size_t skipLines(const std::filesystem::path& file, size_t offset, size_t lines) {
+    std::ifstream in(file, std::ios::in | std::ios::binary);
+    in.seekg(static_cast<std::streamoff>(offset));
+    for (size_t i = 0; i < lines; ++i) {
+        in.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+        if (!in) {
+            throw Exception(SourceContext{}, "Couldn't skip {} lines in {}", lines, file);
+        }
+    }
+    return static_cast<size_t>(in.tellg());
+}
+
+template <typename T>
+TensorData convert(const Header& header, const std::vector<T>& values) {
+    const auto count = glm::compMul(header.dimensions);
+    const auto components = header.components;
+
+    TensorData res{header.dimensions, std::vector<dmat3>(count), std::vector<float>(count, 1.0f)};
+
+    const auto toTensor = [&](size_t i) {
+        const T* v = values.data() + i * components;
+        switch (components) {
+            case 6:
+                res.tensors[i] = tensorio::symmetricTensor(v);
+                break;
+            case 7:
+                res.confidence[i] = static_cast<float>(v[0]);
+                res.tensors[i] = v[0] == T{1} ? tensorio::symmetricTensor(v + 1) : dmat3{0.0};
+                break;
+            case 9:
+                res.tensors[i] = dmat3{dvec3{v[0], v[1], v[2]}, dvec3{v[3], v[4], v[5]},
+                                       dvec3{v[6], v[7], v[8]}};
+                break;
+        }
+    };
+    util::forEachParallel(util::make_sequence(size_t{0}, count, size_t{1}), toTensor);
+    return res;
+}
+
+template <typename T>
+TensorData read(const Header& header) {
+    std::vector<T> values(glm::compMul(header.dimensions) * header.components);
+    const auto bytes = std::as_writable_bytes(std::span{values});
+
+    if (header.encoding == Encoding::Gzip) {
+        const auto compressed = tensorio::readBytes(header.dataFile, header.dataOffset);
+        if (header.decodedSkip == 0) {
+            tensorio::inflate(compressed, bytes);
+        } else {
+            std::vector<std::byte> decoded(header.decodedSkip + bytes.size());
+            tensorio::inflate(compressed, decoded);
+            std::copy(decoded.begin() + header.decodedSkip, decoded.end(), bytes.begin());
+        }
+    } else {
+        tensorio::readBytes(header.dataFile, header.dataOffset, bytes);
+    }
+    tensorio::swapBytes(std::span{values}, header.byteOrder);
+
+    return convert(header, values);
+}
+
+}  // namespace
+
+size_t Header::valueSize() const {
+    return type == ValueType::Float ? sizeof(float) : sizeof(double);
+}
+
+size_t Header::dataSize() const { return glm::compMul(dimensions) * components * valueSize(); }
+
+Header Header::read(const std::filesystem::path& file) {
+    std::ifstream in(file, std::ios::in | std::ios::binary);
+    if (!in) {
+        throw Exception(SourceContext{}, "Couldn't open file {}", file);
+    }
+
+    std::string line;
+    std::getline(in, line);
+    if (!line.starts_with("NRRD")) {
+        throw Exception(SourceContext{}, "Not a NRRD file: {}", file);
+    }
+
+    Header header;
+    bool attachedData = false;
+    while (std::getline(in, line)) {
+        if (!line.empty() && line.back() == '\r') line.pop_back();
+        if (line.empty()) {
+            // A blank line ends the header, the data follows directly for attached headers
+            attachedData = true;
+            header.dataOffset = static_cast<size_t>(in.tellg());
+            break;
+        }
+        if (line.front() == '#') continue;
+
+        const auto sep = line.find(": ");
+        // Lines without ": " are key/value pairs ("key:=value"), which we do not need
+        if (sep == std::string::npos) continue;
+
+        auto value = std::string{trim(std::string_view{line}.substr(sep + 2))};
+        std::erase(value, '"');
+        header.fields[toLower(line.substr(0, sep))] = std::move(value);
+    }
+
+    const auto field = [&](std::string_view name) -> const std::string* {
+        const auto it = header.fields.find(std::string{name});
+        return it != header.fields.end() ? &it->second : nullptr;
+    };
+
+    const auto* sizes = field("sizes");
+    if (!sizes) {
+        throw Exception(SourceContext{}, "Missing 'sizes' in NRRD header {}", file);
+    }
+    const auto dims = parseSizes(*sizes, file);
+    if (dims.size() != 4) {
+        throw Exception(SourceContext{},
+                        "Expected a 4 dimensional NRRD (components, x, y, z) in {}, got {} sizes",
+                        file, dims.size());
+    }
+    header.components = dims[0];
+    header.dimensions = size3_t{dims[1], dims[2], dims[3]};
+    if (header.components != 6 && header.components != 7 && header.components != 9) {
+        throw Exception(SourceContext{}, "Unsupported number of tensor components {} in {}",
+                        header.components, file);
+    }
+
+    if (const auto* type = field("type")) {
+        if (*type == "float") {
+            header.type = ValueType::Float;
+        } else if (*type == "double") {
+            header.type = ValueType::Double;
+        } else {
+            throw Exception(SourceContext{}, "Unsupported NRRD type '{}' in {}", *type, file);
+        }
+    }
+
+    if (const auto* encoding = field("encoding")) {
+        if (*encoding == "raw") {
+            header.encoding = Encoding::Raw;
+        } else if (*encoding == "gzip" || *encoding == "gz") {
+            header.encoding = Encoding::Gzip;
+        } else {
+            throw Exception(SourceContext{}, "Unsupported NRRD encoding '{}' in {}", *encoding,
+                            file);
+        }
+    }
+
+    // Files written before the endian field was honored were always read as big endian
+    if (const auto* endian = field("endian")) {
+        header.byteOrder =
+            *endian == "little" ? tensorio::ByteOrder::Little : tensorio::ByteOrder::Big;
+    }
+
+    const auto* dataFile = field("data file");
+    if (!dataFile) dataFile = field("datafile");
+    if (dataFile) {
+        if (dataFile->starts_with("LIST") || dataFile->find('%') != std::string::npos) {
+            throw Exception(SourceContext{}, "Multi-file NRRD data is not supported: {}", file);
+        }
+        header.dataFile = file.parent_path() / *dataFile;
+        header.dataOffset = 0;
+    } else if (attachedData) {
+        header.dataFile = file;
+    } else {
+        throw Exception(SourceContext{}, "NRRD header without data: {}", file);
+    }
+
+    if (!std::filesystem::is_regular_file(header.dataFile)) {
+        throw Exception(SourceContext{}, "Raw file does not exist: {}", header.dataFile);
+    }
+
+    if (const auto* lineSkip = field("line skip")) {
+        const auto lines = parseInteger(*lineSkip, "line skip", file);
+        if (lines < 0) {
+            throw Exception(SourceContext{}, "Invalid line skip {} in {}", lines, file);
+        }
+        header.dataOffset =
+            skipLines(header.dataFile, header.dataOffset, static_cast<size_t>(lines));
+    }
+
+    if (const auto* byteSkip = field("byte skip")) {
+        const auto bytes = parseInteger(*byteSkip, "byte skip", file);
+        if (bytes == -1 && header.encoding == Encoding::Raw) {
+            // -1 means that the data ends at the end of the file
+            const auto fileSize = std::filesystem::file_size(header.dataFile);
+            if (fileSize < header.dataSize()) {
+                throw Exception(SourceContext{}, "Data file {} is too small", header.dataFile);
+            }
+            header.dataOffset = static_cast<size_t>(fileSize) - header.dataSize();
+        } else if (bytes >= 0 && header.encoding == Encoding::Gzip) {
+            header.decodedSkip = static_cast<size_t>(bytes);
+        } else if (bytes >= 0) {
+            header.dataOffset += static_cast<size_t>(bytes);
+        } else {
+            throw Exception(SourceContext{}, "Invalid byte skip {} in {}", bytes, file);
+        }
+    }
+
+    return header;
+}
+
+TensorData readTensors(const Header& header) {
+    return header.type == ValueType::Float ? read<float>(header) : read<double>(header);
+}
+
+TensorData readTensors(const std::filesystem::path& file) {
+    return readTensors(Header::read(file));
+}
+
+}  // namespace inviwo::nrrd
@@ -0,0 +1,115 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/tensorvisio/io/tensorrawdata.h>
+#include <inviwo/core/util/exception.h>
+
+#include <fmt/std.h>
+#include <zlib.h>
+
+#include <algorithm>
+#include <fstream>
+
+namespace inviwo::tensorio {
+
+void readBytes(const std::filesystem::path& file, size_t offset, std::span<std::byte> dest) {
+    std::ifstream in(file, std::ios::in | std::ios::binary);
+    if (!in) {
+        throw Exception(SourceContext{}, "Couldn't open file: {}", file);
+    }
+    in.seekg(static_cast<std::streamoff>(offset));
+    in.read(reinterpret_cast<char*>(dest.data()), static_cast<std::streamsize>(dest.size()));
+    if (static_cast<size_t>(in.gcount()) != dest.size()) {
+        throw Exception(SourceContext{}, "Premature end of file {}, expected {} bytes at offset {}",
+                        file, dest.size(), offset);
+    }
+}
+
+std::vector<std::byte> readBytes(const std::filesystem::path& file, size_t offset, size_t size) {
+    if (size == std::numeric_limits<size_t>::max()) {
+        std::error_code ec;
+        const auto fileSize = static_cast<size_t>(std::filesystem::file_size(file, ec));
+        if (ec) {
+            throw Exception(SourceContext{}, "Couldn't open file: {}", file);
+        }
+        size = fileSize > offset ? fileSize - offset : 0;
+    }
+    std::vector<std::byte> data(size);
+    readBytes(file, offset, data);
+    return data;
+}
+
+void inflate(std::span<const std::byte> compressed, std::span<std::byte> dest) {
+    z_stream stream{};
+    // 15 window bits plus 32 enables automatic detection of gzip and zlib headers
+    if (inflateInit2(&stream, 15 + 32) != Z_OK) {
+        throw Exception(SourceContext{}, "Couldn't initialize zlib");
+    }
+
+    // zlib counts in uInt, feed large buffers in pieces
+    constexpr size_t maxChunk = std::numeric_limits<uInt>::max();
+    auto in = reinterpret_cast<const Bytef*>(compressed.data());
+    auto out = reinterpret_cast<Bytef*>(dest.data());
+    size_t inLeft = compressed.size();
+    size_t outLeft = dest.size();
+
+    int res = Z_OK;
+    while (res == Z_OK) {
+        if (stream.avail_in == 0 && inLeft > 0) {
+            stream.next_in = const_cast<Bytef*>(in);
+            stream.avail_in = static_cast<uInt>(std::min(inLeft, maxChunk));
+            in += stream.avail_in;
+            inLeft -= stream.avail_in;
+        }
+        if (stream.avail_out == 0 && outLeft > 0) {
+            stream.next_out = out;
+            stream.avail_out = static_cast<uInt>(std::min(outLeft, maxChunk));
+            out += stream.avail_out;
+            outLeft -= stream.avail_out;
+        }
+        res = ::inflate(&stream, Z_NO_FLUSH);
+        if (res == Z_BUF_ERROR && (stream.avail_in > 0 || inLeft > 0) &&
+            (stream.avail_out > 0 || outLeft > 0)) {
+            res = Z_OK;
+        }
+    }
+    const auto total = static_cast<size_t>(stream.total_out);
+    inflateEnd(&stream);
+
+    if (res != Z_STREAM_END) {
+        throw Exception(SourceContext{}, "Corrupt or truncated compressed data ({})",
+                        res == Z_BUF_ERROR ? "unexpected size" : "zlib error");
+    }
+    if (total != dest.size()) {
+        throw Exception(SourceContext{}, "Decompressed {} bytes, expected {}", total,
+                        dest.size());
+    }
+}
+
+}  // namespace inviwo::tensorio
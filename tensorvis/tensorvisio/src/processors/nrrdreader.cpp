@@ -28,12 +28,16 @@
  *********************************************************************************/
 
 #include <inviwo/tensorvisio/processors/nrrdreader.h>
+#include <inviwo/tensorvisio/io/nrrdtensorio.h>
 #include <inviwo/core/datastructures/volume/volume.h>
 #include <inviwo/core/datastructures/volume/volumeram.h>
 #include <inviwo/core/util/filesystem.h>
+#include <inviwo/core/util/stringconversion.h>
 
 #include <fmt/std.h>
 
+#include <algorithm>
+
 namespace inviwo {
 
 // The Class Identifier has to be globally unique. Use a reverse DNS naming scheme
@@ -57,153 +61,17 @@ NRRDReader::NRRDReader()
 }
 
 void NRRDReader::process() {
-    std::ifstream inFile(inFile_.get());
-
-    if (!inFile) {
-        throw Exception(SourceContext{}, "Couldn't open file {}", inFile_.get());
-    }
-
-    auto extension = inFile_.get().extension();
-    if (extension != ".nhdr") {
-        throw Exception(SourceContext{}, "Not a NHDR file: {}", inFile_.get());
-    }
-
-    std::map<std::string, std::string> values;
-
-    // Get first line
-    std::string version;
-    std::getline(inFile, version);
-
-    std::string line;
-    while (std::getline(inFile, line)) {
-        std::istringstream iss(line);
-        std::string component;
-        std::string value;
-
-        std::getline(iss, component, ':');
-        std::getline(iss, value, ':');
-
-        if (component[0] == '#') continue;
-
-        value.erase(0, 1);
-
-        value.erase(std::remove(value.begin(), value.end(), '"'), value.end());
-
-        values.insert(std::pair<std::string, std::string>(component, value));
-    }
-
-    size3_t dimensions{0};
-    std::filesystem::path rawFileName;
-    {
-        auto it = values.find("sizes");
-        if (it != values.end()) {
-            auto dimensionString = (*it).second;
-            std::istringstream iss(dimensionString);
-
-            std::string numberOfItemsPerTensorString;
-            std::getline(iss, numberOfItemsPerTensorString, ' ');
-
-            std::string dimXString;
-            std::getline(iss, dimXString, ' ');
-            dimensions.x = std::stoull(dimXString);
-
-            std::string dimYString;
-            std::getline(iss, dimYString, ' ');
-            dimensions.y = std::stoull(dimYString);
-
-            std::string dimZString;
-            std::getline(iss, dimZString, ' ');
-            dimensions.z = std::stoull(dimZString);
-        }
+    const auto extension = toLower(inFile_.get().extension().string());
+    if (extension != ".nhdr" && extension != ".nrrd") {
+        throw Exception(SourceContext{}, "Not a NRRD file: {}", inFile_.get());
     }
 
-    {
-        auto it = values.find("data file");
-        if (it != values.end()) {
-            auto path = inFile_.get().parent_path();
-            rawFileName = path / (*it).second;
-        }
-    }
-
-    if (!std::filesystem::is_regular_file(rawFileName)) {
-        throw Exception(SourceContext{}, "Raw file does not exist: {}", rawFileName);
-        return;
-    }
-    std::ifstream rawFile(rawFileName, std::ios::in | std::ios::binary);
-
-    if (!rawFile) {
-        throw Exception(SourceContext{}, "Couldn't open raw file: {}", rawFileName);
-        return;
-    }
+    auto data = nrrd::readTensors(inFile_.get());
 
-    auto numberOfTensors = dimensions.x * dimensions.y * dimensions.z;
-
-    std::vector<dmat3> dataForTensorField;
-
-    dataForTensorField.resize(numberOfTensors);
-
-    util::IndexMapper3D indexMapper(dimensions);
-
-    auto vol = std::make_shared<Volume>(dimensions, DataFloat32::get());
+    auto vol = std::make_shared<Volume>(data.dimensions, DataFloat32::get());
     auto volRam = vol->getEditableRepresentation<VolumeRAM>();
-    auto volRamData = static_cast<float*>(volRam->getData());
-
-    auto toLittleEndian = [](const float val) -> float {
-        float read = val;
-        float write;
-        auto r_ptr = reinterpret_cast<char*>(&read);
-        auto w_ptr = reinterpret_cast<char*>(&write);
-        w_ptr[0] = r_ptr[3];
-        w_ptr[1] = r_ptr[2];
-        w_ptr[2] = r_ptr[1];
-        w_ptr[3] = r_ptr[0];
-        return write;
-    };
-
-    for (size_t z = 0; z < dimensions.z; z++) {
-        for (size_t y = 0; y < dimensions.y; y++) {
-            for (size_t x = 0; x < dimensions.x; x++) {
-                auto index = indexMapper(size3_t(x, y, z));
-                float confidence;
-                float xx;
-                float yy;
-                float zz;
-                float xy;
-                float xz;
-                float yz;
-
-                rawFile.read(reinterpret_cast<char*>(&confidence), sizeof(float));
-
-                rawFile.read(reinterpret_cast<char*>(&xx), sizeof(float));
-                rawFile.read(reinterpret_cast<char*>(&xy), sizeof(float));
-                rawFile.read(reinterpret_cast<char*>(&xz), sizeof(float));
-
-                rawFile.read(reinterpret_cast<char*>(&yy), sizeof(float));
-                rawFile.read(reinterpret_cast<char*>(&yz), sizeof(float));
-                rawFile.read(reinterpret_cast<char*>(&zz), sizeof(float));
-
-                confidence = toLittleEndian(confidence);
-                xx = toLittleEndian(xx);
-                yy = toLittleEndian(yy);
-                zz = toLittleEndian(zz);
-                xy = toLittleEndian(xy);
-                xz = toLittleEndian(xz);
-                yz = toLittleEndian(yz);
-
-                double weight = 0.;
-                if (confidence == 1.) {
-                    weight = 1.;
-                }
-
-                dvec3 col1(xx, xy, xz);
-                dvec3 col2(xy, yy, yz);
-                dvec3 col3(xz, yz, zz);
-
-                dataForTensorField[index] = dmat3(col1, col2, col3) * weight;
-                volRamData[index] = confidence;
-            }
-        }
-    }
+    std::copy(data.confidence.begin(), data.confidence.end(),
+              static_cast<float*>(volRam->getData()));
 
     vol->setBasis(mat3(1.f));
     vol->setOffset(vec3(0.f));
@@ -211,7 +79,7 @@ void NRRDReader::process() {
     vol->dataMap.valueRange = vec2(0, 1);
     volumeOutport_.setData(vol);
 
-    outport3D_.setData(std::make_shared<TensorField3D>(dimensions, dataForTensorField));
+    outport3D_.setData(std::make_shared<TensorField3D>(data.dimensions, std::move(data.tensors)));
 }
 
 }  // namespace inviwo
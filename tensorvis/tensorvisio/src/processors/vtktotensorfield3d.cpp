@@ -37,17 +37,14 @@
 #include <inviwo/core/util/formats.h>
 #include <inviwo/core/util/exception.h>
 
-#include <inviwo/vtk/util/arrayutils.h>
+#include <inviwo/tensorvisio/util/vtktensorconversion.h>
 #include <inviwo/vtk/util/vtkdatautils.h>
 
 #include <fmt/core.h>
 
 #include <vtkDataSet.h>
 #include <vtkPointData.h>
-#include <vtkMatrix3x3.h>
-#include <vtkAbstractArray.h>
-#include <vtkArrayDispatch.h>
-#include <vtkGenericDataArray.h>
+#include <vtkDataArray.h>
 #include <vtkDataObjectTypes.h>
 
 namespace inviwo {
@@ -59,7 +56,9 @@ const ProcessorInfo VTKToTensorField3D::processorInfo_{
     "VTK",                                   // Category
     CodeState::Experimental,                 // Code state
     Tags::CPU | Tag{"VTK"} | Tag{"Tensor"},  // Tags
-    R"(Converts a VTK data set to a 3D tensor field. Unstructured grids are not supported.)"_unindentHelp,
+    R"(Converts a VTK data set to a 3D tensor field. Unstructured grids are not supported.
+    Tensor arrays may have nine components or six components holding symmetric tensors
+    in the VTK order xx, yy, zz, xy, yz, xz.)"_unindentHelp,
 };
 const ProcessorInfo& VTKToTensorField3D::getProcessorInfo() const { return processorInfo_; }
 
@@ -69,75 +68,6 @@ constexpr std::array<int, 5> supportedObjectTypes{VTK_RECTILINEAR_GRID, VTK_STRU
                                                   VTK_IMAGE_DATA, VTK_UNIFORM_GRID,
                                                   VTK_STRUCTURED_POINTS};
 
-std::shared_ptr<TensorField3D> vtkToTensorField(size3_t dimensions, vtkDataSet* vtkData,
-                                                int arrayIndex) {
-    auto array = vtkData->GetPointData()->GetArray(arrayIndex);
-    if (array->GetNumberOfComponents() != 9) {
-        throw Exception(SourceContext{},
-                        "unsupported number of components for tensor data ({}), expected 9",
-                        array->GetNumberOfComponents());
-    }
-
-    std::shared_ptr<TensorField3D> tensorfield;
-
-    auto worker = [&]<typename T>(T* typedArray) {
-        const auto nTuples = array->GetNumberOfTuples();
-
-        if (static_cast<vtkIdType>(glm::compMul(dimensions)) != nTuples) {
-            throw Exception("Invalid dimensions");
-        }
-
-        std::vector<dmat3> data;
-        data.reserve(glm::compMul(dimensions));
-
-        for (vtkIdType id = 0; id < nTuples; ++id) {
-            data.emplace_back(
-                typedArray->GetTypedComponent(id, 0), typedArray->GetTypedComponent(id, 1),
-                typedArray->GetTypedComponent(id, 2),
-
-                typedArray->GetTypedComponent(id, 3), typedArray->GetTypedComponent(id, 4),
-                typedArray->GetTypedComponent(id, 5),
-
-                typedArray->GetTypedComponent(id, 6), typedArray->GetTypedComponent(id, 7),
-                typedArray->GetTypedComponent(id, 8));
-        }
-
-        tensorfield = std::make_shared<TensorField3D>(dimensions, data);
-    };
-
-    if (!vtkArrayDispatch::Dispatch::Execute(array, worker)) {
-        throw Exception("no matching type");
-    }
-
-    return tensorfield;
-}
-
-std::vector<double> vtkToScalars(vtkDataSet* vtkData, int arrayIndex) {
-    auto array = vtkData->GetPointData()->GetArray(arrayIndex);
-
-    if (array->GetNumberOfComponents() != 1) {
-        throw Exception(SourceContext{},
-                        "unsupported number of components for scalar data ({}), expected 1",
-                        array->GetNumberOfComponents());
-    }
-    const auto nTuples = array->GetNumberOfTuples();
-    std::vector<double> scalars(nTuples);
-
-    auto worker = [&]<typename T>(T* typedArray) {
-        for (vtkIdType i = 0; i < nTuples; ++i) {
-            const auto val = std::invoke([](auto item) { return static_cast<double>(item); },
-                                         vtk::getTuple<1>(typedArray, i));
-            scalars[i] = val;
-        }
-    };
-
-    if (!vtkArrayDispatch::Dispatch::Execute(array, worker)) {
-        throw Exception("no matching type for scalar values");
-    }
-
-    return scalars;
-}
-
 }  // namespace
 
 VTKToTensorField3D::VTKToTensorField3D()
@@ -198,7 +128,18 @@ void VTKToTensorField3D::process() {
     if (inport_.isChanged() || sourceTensors_.isModified() || sourceScalars_.isModified()) {
         const ivec3 dims{*vtk::getDimensions(vtkData)};
 
-        tensorField_ = vtkToTensorField(dims, vtkData, sourceTensors_.getSelectedValue());
+        auto* tensorArray = vtkData->GetPointData()->GetArray(sourceTensors_.getSelectedValue());
+        if (!tensorArray) {
+            throw Exception(SourceContext{}, "selected tensor array '{}' is not a data array",
+                            sourceTensors_.getSelectedDisplayName());
+        }
+        if (static_cast<vtkIdType>(glm::compMul(size3_t{dims})) !=
+            tensorArray->GetNumberOfTuples()) {
+            throw Exception(SourceContext{}, "invalid dimensions {}x{}x{} for {} tensors", dims.x,
+                            dims.y, dims.z, tensorArray->GetNumberOfTuples());
+        }
+        tensorField_ =
+            std::make_shared<TensorField3D>(size3_t{dims}, tensorio::vtkToTensors(tensorArray));
         if (const auto mm = vtk::getModelMatrix(vtkData)) {
             tensorField_->setModelMatrix(*mm);
         }
@@ -210,9 +151,14 @@ void VTKToTensorField3D::process() {
         }
 
         if (sourceScalars_.getSelectedValue() >= 0) {
+            auto* scalarArray =
+                vtkData->GetPointData()->GetArray(sourceScalars_.getSelectedValue());
+            if (!scalarArray) {
+                throw Exception(SourceContext{}, "selected scalar array '{}' is not a data array",
+                                sourceScalars_.getSelectedDisplayName());
+            }
             tensorField_->addMetaData<tensor::HillYieldCriterion>(
-                vtkToScalars(vtkData, sourceScalars_.getSelectedValue()),
-                TensorFeature::HillYieldCriterion);
+                tensorio::vtkToScalars(scalarArray), TensorFeature::HillYieldCriterion);
         }
 
         const bool deserializing = getNetwork()->isDeserializing();
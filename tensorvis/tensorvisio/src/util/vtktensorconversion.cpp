@@ -0,0 +1,183 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/tensorvisio/util/vtktensorconversion.h>
+#include <inviwo/tensorvisio/io/tensorrawdata.h>
+#include <inviwo/core/util/exception.h>
+#include <inviwo/core/util/foreach.h>
+#include <inviwo/core/util/zip.h>
+
+#include <glm/gtc/type_ptr.hpp>
+
+#include <vtkAOSDataArrayTemplate.h>
+#include <vtkArrayDispatch.h>
+#include <vtkDataArray.h>
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <type_traits>
+
+namespace inviwo::tensorio {
+
+namespace {
+
+/// VTK orders the six unique components of a symmetric tensor xx, yy, zz, xy, yz, xz
+template <typename T>
+dmat3 vtkSymmetricTensor(const T* c) {
+    return dmat3{dvec3{c[0], c[3], c[5]}, dvec3{c[3], c[1], c[4]}, dvec3{c[5], c[4], c[2]}};
+}
+
+auto indices(size_t count) { return util::make_sequence(size_t{0}, count, size_t{1}); }
+
+template <typename T>
+void tensorsFromPointer(const T* src, int components, std::vector<dmat3>& dest) {
+    if constexpr (std::is_same_v<T, double>) {
+        if (components == 9) {
+            static_assert(sizeof(dmat3) == 9 * sizeof(double));
+            std::memcpy(static_cast<void*>(dest.data()), src, dest.size() * sizeof(dmat3));
+            return;
+        }
+    }
+    if (components == 9) {
+        util::forEachParallel(indices(dest.size()), [&](size_t i) {
+            const T* c = src + 9 * i;
+            dest[i] =
+                dmat3{dvec3{c[0], c[1], c[2]}, dvec3{c[3], c[4], c[5]}, dvec3{c[6], c[7], c[8]}};
+        });
+    } else {
+        util::forEachParallel(indices(dest.size()),
+                              [&](size_t i) { dest[i] = vtkSymmetricTensor(src + 6 * i); });
+    }
+}
+
+/// Typed access where the array type is known, the virtual GetComponent for any other array
+template <typename ArrayT>
+double component(ArrayT* array, vtkIdType id, int k) {
+    if constexpr (std::is_same_v<ArrayT, vtkDataArray>) {
+        return array->GetComponent(id, k);
+    } else {
+        return static_cast<double>(array->GetTypedComponent(id, k));
+    }
+}
+
+/// The generic GetComponent may go through a shared tuple buffer, so it stays on one thread
+template <typename ArrayT, typename Func>
+void forEachComponent(size_t count, Func&& func) {
+    if constexpr (std::is_same_v<ArrayT, vtkDataArray>) {
+        for (size_t i = 0; i < count; ++i) func(i);
+    } else {
+        util::forEachParallel(indices(count), func);
+    }
+}
+
+template <typename ArrayT>
+void tensorsFromComponents(ArrayT* array, int components, std::vector<dmat3>& dest) {
+    forEachComponent<ArrayT>(dest.size(), [&](size_t i) {
+        std::array<double, 9> c{};
+        const auto id = static_cast<vtkIdType>(i);
+        for (int k = 0; k < components; ++k) c[k] = component(array, id, k);
+        dest[i] = components == 9 ? glm::make_mat3(c.data()) : vtkSymmetricTensor(c.data());
+    });
+}
+
+template <typename ArrayT>
+std::vector<double> scalarsFromComponents(ArrayT* array, size_t nTuples) {
+    std::vector<double> scalars(nTuples);
+    forEachComponent<ArrayT>(nTuples, [&](size_t i) {
+        scalars[i] = component(array, static_cast<vtkIdType>(i), 0);
+    });
+    return scalars;
+}
+
+}  // namespace
+
+std::vector<dmat3> vtkToTensors(vtkDataArray* array) {
+    const int components = array->GetNumberOfComponents();
+    if (components != 9 && components != 6) {
+        throw Exception(SourceContext{},
+                        "unsupported number of components for tensor data ({}), expected 6 or 9",
+                        components);
+    }
+
+    std::vector<dmat3> tensors(static_cast<size_t>(array->GetNumberOfTuples()));
+
+    auto worker = [&]<typename ArrayT>(ArrayT* typedArray) {
+        using ValueType = typename ArrayT::ValueType;
+        if constexpr (std::is_same_v<ArrayT, vtkAOSDataArrayTemplate<ValueType>> &&
+                      std::is_floating_point_v<ValueType>) {
+            tensorsFromPointer(typedArray->GetPointer(0), components, tensors);
+        } else {
+            tensorsFromComponents(typedArray, components, tensors);
+        }
+    };
+
+    // Array types the dispatcher was not built for, like SOA arrays without
+    // VTK_DISPATCH_SOA_ARRAYS, go through the generic vtkDataArray interface
+    if (!vtkArrayDispatch::Dispatch::Execute(array, worker)) {
+        tensorsFromComponents(array, components, tensors);
+    }
+
+    return tensors;
+}
+
+std::vector<double> vtkToScalars(vtkDataArray* array) {
+    if (array->GetNumberOfComponents() != 1) {
+        throw Exception(SourceContext{},
+                        "unsupported number of components for scalar data ({}), expected 1",
+                        array->GetNumberOfComponents());
+    }
+
+    const auto nTuples = static_cast<size_t>(array->GetNumberOfTuples());
+
+    auto worker = [&]<typename ArrayT>(ArrayT* typedArray) -> std::vector<double> {
+        using ValueType = typename ArrayT::ValueType;
+        if constexpr (std::is_same_v<ArrayT, vtkAOSDataArrayTemplate<double>>) {
+            const double* src = typedArray->GetPointer(0);
+            return std::vector<double>(src, src + nTuples);
+        } else if constexpr (std::is_same_v<ArrayT, vtkAOSDataArrayTemplate<ValueType>>) {
+            std::vector<double> scalars(nTuples);
+            const ValueType* src = typedArray->GetPointer(0);
+            std::transform(src, src + nTuples, scalars.begin(),
+                           [](ValueType v) { return static_cast<double>(v); });
+            return scalars;
+        } else {
+            return scalarsFromComponents(typedArray, nTuples);
+        }
+    };
+
+    std::vector<double> scalars;
+    if (!vtkArrayDispatch::Dispatch::Execute(
+            array, [&](auto* typedArray) { scalars = worker(typedArray); })) {
+        scalars = scalarsFromComponents(array, nTuples);
+    }
+    return scalars;
+}
+
+}  // namespace inviwo::tensorio
@@ -0,0 +1,333 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <inviwo/tensorvisio/io/amiratensorio.h>
+#include <inviwo/tensorvisio/io/nrrdtensorio.h>
+#include <inviwo/core/util/exception.h>
+
+#include <fmt/format.h>
+#include <fmt/std.h>
+#include <zlib.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace inviwo {
+
+namespace {
+
+/// The six unique components of a deterministic symmetric tensor for voxel `i`
+std::array<float, 6> components(size_t i) {
+    const auto f = static_cast<float>(i % 1024);
+    return {f, 0.5f * f, -f, 2.0f * f + 1.0f, 0.25f, -0.5f * f};
+}
+
+dmat3 expectedTensor(size_t i) {
+    const auto c = components(i);
+    return dmat3{dvec3{c[0], c[1], c[2]}, dvec3{c[1], c[3], c[4]}, dvec3{c[2], c[4], c[5]}};
+}
+
+template <typename T>
+void appendValue(std::string& out, T value, bool bigEndian) {
+    char bytes[sizeof(T)];
+    std::memcpy(bytes, &value, sizeof(T));
+    if (bigEndian == (tensorio::nativeByteOrder() == tensorio::ByteOrder::Little)) {
+        std::reverse(std::begin(bytes), std::end(bytes));
+    }
+    out.append(bytes, sizeof(T));
+}
+
+/// Voxels with i % 5 == 4 get a confidence of zero
+template <typename T>
+std::string syntheticData(size3_t dims, bool withConfidence, bool bigEndian) {
+    std::string data;
+    const auto count = glm::compMul(dims);
+    data.reserve(count * (withConfidence ? 7 : 6) * sizeof(T));
+    for (size_t i = 0; i < count; ++i) {
+        if (withConfidence) appendValue(data, T(i % 5 == 4 ? 0 : 1), bigEndian);
+        for (auto c : components(i)) appendValue(data, static_cast<T>(c), bigEndian);
+    }
+    return data;
+}
+
+std::string gzip(const std::string& data) {
+    z_stream stream{};
+    // 15 window bits plus 16 writes a gzip header
+    if (deflateInit2(&stream, Z_BEST_SPEED, Z_DEFLATED, 15 + 16, 8, Z_DEFAULT_STRATEGY) != Z_OK) {
+        ADD_FAILURE() << "deflateInit2 failed";
+        return {};
+    }
+    std::string out(deflateBound(&stream, static_cast<uLong>(data.size())), '\0');
+    stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(data.data()));
+    stream.avail_in = static_cast<uInt>(data.size());
+    stream.next_out = reinterpret_cast<Bytef*>(out.data());
+    stream.avail_out = static_cast<uInt>(out.size());
+    EXPECT_EQ(deflate(&stream, Z_FINISH), Z_STREAM_END);
+    out.resize(stream.total_out);
+    deflateEnd(&stream);
+    return out;
+}
+
+void writeFile(const std::filesystem::path& path, const std::string& contents) {
+    std::ofstream out(path, std::ios::out | std::ios::binary);
+    out.write(contents.data(), static_cast<std::streamsize>(contents.size()));
+}
+
+std::filesystem::path writeDetachedNrrd(const std::filesystem::path& dir, size3_t dims) {
+    writeFile(dir / "tensors.raw", syntheticData<float>(dims, true, true));
+    writeFile(dir / "tensors.nhdr",
+              fmt::format("NRRD0004\n"
+                          "# detached header, big endian raw floats\n"
+                          "type: float\n"
+                          "dimension: 4\n"
+                          "sizes: 7 {} {} {}\n"
+                          "kinds: 3D-masked-symmetric-matrix space space space\n"
+                          "endian: big\n"
+                          "encoding: raw\n"
+                          "data file: tensors.raw\n",
+                          dims.x, dims.y, dims.z));
+    return dir / "tensors.nhdr";
+}
+
+std::filesystem::path writeAttachedGzipNrrd(const std::filesystem::path& dir, size3_t dims) {
+    const auto header = fmt::format(
+        "NRRD0004\ntype: double\ndimension: 4\nsizes: 6 {} {} {}\nendian: little\n"
+        "encoding: gzip\nspace dimension: 3\n\n",
+        dims.x, dims.y, dims.z);
+    writeFile(dir / "tensors.nrrd", header + gzip(syntheticData<double>(dims, false, false)));
+    return dir / "tensors.nrrd";
+}
+
+std::filesystem::path writeAmira(const std::filesystem::path& dir, size3_t dims, bool zip) {
+    const auto data = syntheticData<float>(dims, false, false);
+    const auto payload = zip ? gzip(data) : data;
+    const auto encoding = zip ? fmt::format("(HxZip,{})", payload.size()) : std::string{};
+    const auto header = fmt::format(
+        "# AmiraMesh BINARY-LITTLE-ENDIAN 2.1\n\n"
+        "define Lattice {} {} {}\n\n"
+        "Parameters {{\n"
+        "    BoundingBox 0 2 0 4 0 8,\n"
+        "    CoordType \"uniform\"\n"
+        "}}\n\n"
+        "Lattice {{ float[6] Data }} @1{}\n\n"
+        "# Data section follows\n"
+        "@1{}\n",
+        dims.x, dims.y, dims.z, encoding, encoding);
+    const auto path = dir / (zip ? "tensors-zip.am" : "tensors.am");
+    writeFile(path, header + payload);
+    return path;
+}
+
+class TensorReaders : public ::testing::Test {
+protected:
+    void SetUp() override {
+        directory_ = std::filesystem::temp_directory_path() /
+                     fmt::format("inviwo-tensorvisio-{}", std::random_device{}());
+        std::filesystem::create_directories(directory_);
+    }
+    void TearDown() override {
+        std::error_code ec;
+        std::filesystem::remove_all(directory_, ec);
+    }
+
+    std::filesystem::path directory_;
+};
+
+}  // namespace
+
+TEST_F(TensorReaders, DetachedBigEndianNrrd) {
+    const size3_t dims{7, 5, 3};
+    const auto file = writeDetachedNrrd(directory_, dims);
+
+    const auto header = nrrd::Header::read(file);
+    EXPECT_EQ(header.components, 7u);
+    EXPECT_EQ(header.dimensions, dims);
+    EXPECT_EQ(header.byteOrder, tensorio::ByteOrder::Big);
+    EXPECT_EQ(header.dataFile, directory_ / "tensors.raw");
+
+    const auto data = nrrd::readTensors(header);
+    ASSERT_EQ(data.tensors.size(), glm::compMul(dims));
+    for (size_t i = 0; i < data.tensors.size(); ++i) {
+        const bool confident = i % 5 != 4;
+        EXPECT_EQ(data.confidence[i], confident ? 1.0f : 0.0f) << "voxel " << i;
+        EXPECT_EQ(data.tensors[i], confident ? expectedTensor(i) : dmat3{0.0}) << "voxel " << i;
+    }
+}
+
+TEST_F(TensorReaders, AttachedGzipNrrd) {
+    const size3_t dims{16, 8, 4};
+    const auto file = writeAttachedGzipNrrd(directory_, dims);
+
+    const auto header = nrrd::Header::read(file);
+    EXPECT_EQ(header.encoding, nrrd::Encoding::Gzip);
+    EXPECT_EQ(header.type, nrrd::ValueType::Double);
+    EXPECT_EQ(header.dataFile, file);
+    EXPECT_GT(header.dataOffset, 0u);
+
+    const auto data = nrrd::readTensors(header);
+    ASSERT_EQ(data.tensors.size(), glm::compMul(dims));
+    for (size_t i = 0; i < data.tensors.size(); ++i) {
+        EXPECT_EQ(data.tensors[i], expectedTensor(i)) << "voxel " << i;
+        EXPECT_EQ(data.confidence[i], 1.0f);
+    }
+}
+
+TEST_F(TensorReaders, NrrdByteSkip) {
+    const size3_t dims{4, 4, 2};
+    writeFile(directory_ / "skip.raw", "some preamble\nsecond line\n" + std::string(5, 'x') +
+                                           syntheticData<float>(dims, false, false));
+    writeFile(directory_ / "skip.nhdr",
+              fmt::format("NRRD0004\ntype: float\ndimension: 4\nsizes: 6 {} {} {}\n"
+                          "endian: little\nencoding: raw\nline skip: 2\nbyte skip: 5\n"
+                          "data file: skip.raw\n",
+                          dims.x, dims.y, dims.z));
+
+    const auto data = nrrd::readTensors(directory_ / "skip.nhdr");
+    ASSERT_EQ(data.tensors.size(), glm::compMul(dims));
+    for (size_t i = 0; i < data.tensors.size(); ++i) {
+        EXPECT_EQ(data.tensors[i], expectedTensor(i)) << "voxel " << i;
+    }
+}
+
+TEST_F(TensorReaders, NrrdGzipByteSkip) {
+    // for compressed encodings the byte skip applies to the decompressed data
+    const size3_t dims{4, 4, 2};
+    writeFile(directory_ / "skip.gz",
+              gzip(std::string(7, 'x') + syntheticData<float>(dims, false, false)));
+    writeFile(directory_ / "skip.nhdr",
+              fmt::format("NRRD0004\ntype: float\ndimension: 4\nsizes: 6 {} {} {}\n"
+                          "endian: little\nencoding: gzip\nbyte skip: 7\n"
+                          "data file: skip.gz\n",
+                          dims.x, dims.y, dims.z));
+
+    const auto header = nrrd::Header::read(directory_ / "skip.nhdr");
+    EXPECT_EQ(header.dataOffset, 0u);
+    EXPECT_EQ(header.decodedSkip, 7u);
+
+    const auto data = nrrd::readTensors(header);
+    ASSERT_EQ(data.tensors.size(), glm::compMul(dims));
+    for (size_t i = 0; i < data.tensors.size(); ++i) {
+        EXPECT_EQ(data.tensors[i], expectedTensor(i)) << "voxel " << i;
+    }
+}
+
+TEST_F(TensorReaders, NrrdErrors) {
+    writeFile(directory_ / "ascii.nrrd",
+              "NRRD0004\ntype: float\ndimension: 4\nsizes: 6 1 1 1\nencoding: ascii\n\n0 0 0\n");
+    EXPECT_THROW(nrrd::Header::read(directory_ / "ascii.nrrd"), Exception);
+
+    writeFile(directory_ / "missing.nhdr",
+              "NRRD0004\ntype: float\nsizes: 6 1 1 1\ndata file: missing.raw\n");
+    EXPECT_THROW(nrrd::Header::read(directory_ / "missing.nhdr"), Exception);
+
+    writeFile(directory_ / "short.nrrd",
+              "NRRD0004\ntype: float\nsizes: 6 2 2 2\nencoding: raw\n\n0123");
+    EXPECT_THROW(nrrd::readTensors(directory_ / "short.nrrd"), Exception);
+
+    writeFile(directory_ / "nonrrd.nhdr", "hello\n");
+    EXPECT_THROW(nrrd::Header::read(directory_ / "nonrrd.nhdr"), Exception);
+}
+
+TEST_F(TensorReaders, Amira) {
+    const size3_t dims{9, 6, 3};
+    for (const bool zip : {false, true}) {
+        const auto file = writeAmira(directory_, dims, zip);
+
+        const auto header = amira::Header::read(file);
+        EXPECT_EQ(header.dimensions, dims);
+        EXPECT_EQ(header.components, 6u);
+        EXPECT_EQ(header.extent(), dvec3(2.0, 4.0, 8.0));
+        EXPECT_EQ(header.compressedSize > 0, zip);
+
+        const auto data = amira::readTensors(header);
+        ASSERT_EQ(data.tensors.size(), glm::compMul(dims));
+        for (size_t i = 0; i < data.tensors.size(); ++i) {
+            EXPECT_EQ(data.tensors[i], expectedTensor(i)) << "voxel " << i << " zip " << zip;
+        }
+    }
+}
+
+/**
+ * Load throughput on synthetic files, run with --gtest_also_run_disabled_tests
+ */
+TEST_F(TensorReaders, DISABLED_Benchmark) {
+    const size3_t dims{128, 128, 128};
+    const auto detached = writeDetachedNrrd(directory_, dims);
+    const auto attached = writeAttachedGzipNrrd(directory_, dims);
+    const auto amiraFile = writeAmira(directory_, dims, false);
+
+    using clock = std::chrono::steady_clock;
+    using seconds = std::chrono::duration<double>;
+    const auto report = [](std::string_view name, size_t bytes, auto&& load) {
+        const auto start = clock::now();
+        const auto count = load();
+        const auto s = seconds(clock::now() - start).count();
+        fmt::print("[ BENCH    ] {:<28} {:>8} tensors {:8.1f} ms {:8.1f} MB/s\n", name, count,
+                   s * 1000.0, static_cast<double>(bytes) / s / 1.0e6);
+    };
+
+    const auto rawBytes = glm::compMul(dims) * 7 * sizeof(float);
+
+    // The previous approach: one read call and one byte swap per value
+    report("nrrd raw, per value reads", rawBytes, [&]() {
+        std::ifstream in(directory_ / "tensors.raw", std::ios::in | std::ios::binary);
+        std::vector<dmat3> tensors(glm::compMul(dims));
+        for (auto& tensor : tensors) {
+            float v[7];
+            for (auto& value : v) {
+                char bytes[sizeof(float)];
+                in.read(bytes, sizeof(float));
+                std::reverse(std::begin(bytes), std::end(bytes));
+                std::memcpy(&value, bytes, sizeof(float));
+            }
+            tensor = v[0] == 1.0f ? tensorio::symmetricTensor(v + 1) : dmat3{0.0};
+        }
+        return tensors.size();
+    });
+    report("nrrd raw, bulk", rawBytes,
+           [&]() { return nrrd::readTensors(detached).tensors.size(); });
+    report("nrrd gzip, bulk", glm::compMul(dims) * 6 * sizeof(double),
+           [&]() { return nrrd::readTensors(attached).tensors.size(); });
+    report("amira raw, bulk", glm::compMul(dims) * 6 * sizeof(float),
+           [&]() { return amira::readTensors(amiraFile).tensors.size(); });
+}
+
+}  // namespace inviwo
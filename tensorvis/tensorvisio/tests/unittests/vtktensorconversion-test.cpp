@@ -0,0 +1,172 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <inviwo/tensorvisio/util/vtktensorconversion.h>
+#include <inviwo/core/util/exception.h>
+
+#include <fmt/format.h>
+
+#include <vtkDoubleArray.h>
+#include <vtkFloatArray.h>
+#include <vtkIntArray.h>
+#include <vtkNew.h>
+#include <vtkSOADataArrayTemplate.h>
+
+#include <chrono>
+
+namespace inviwo {
+
+namespace {
+
+double value(vtkIdType tuple, int component) { return 0.5 * tuple + component; }
+
+template <typename ArrayT>
+void fill(ArrayT* array, vtkIdType tuples, int components) {
+    array->SetNumberOfComponents(components);
+    array->SetNumberOfTuples(tuples);
+    for (vtkIdType i = 0; i < tuples; ++i) {
+        for (int c = 0; c < components; ++c) array->SetTypedComponent(i, c, value(i, c));
+    }
+}
+
+/// Per tuple conversion through the generic vtkDataArray interface, used as reference
+std::vector<dmat3> reference(vtkDataArray* array) {
+    std::vector<dmat3> res;
+    for (vtkIdType i = 0; i < array->GetNumberOfTuples(); ++i) {
+        const double* t = array->GetTuple(i);
+        if (array->GetNumberOfComponents() == 9) {
+            res.emplace_back(t[0], t[1], t[2], t[3], t[4], t[5], t[6], t[7], t[8]);
+        } else {
+            res.emplace_back(t[0], t[3], t[5], t[3], t[1], t[4], t[5], t[4], t[2]);
+        }
+    }
+    return res;
+}
+
+}  // namespace
+
+TEST(VTKTensorConversion, NineComponents) {
+    vtkNew<vtkDoubleArray> doubles;
+    fill(doubles.Get(), 1000, 9);
+    EXPECT_EQ(tensorio::vtkToTensors(doubles), reference(doubles));
+
+    vtkNew<vtkFloatArray> floats;
+    fill(floats.Get(), 1000, 9);
+    EXPECT_EQ(tensorio::vtkToTensors(floats), reference(floats));
+
+    const auto tensors = tensorio::vtkToTensors(doubles);
+    EXPECT_EQ(tensors[3][1][2], value(3, 5));
+}
+
+TEST(VTKTensorConversion, SymmetricSixComponents) {
+    vtkNew<vtkFloatArray> floats;
+    fill(floats.Get(), 1000, 6);
+    const auto tensors = tensorio::vtkToTensors(floats);
+    EXPECT_EQ(tensors, reference(floats));
+
+    // xx, yy, zz, xy, yz, xz
+    EXPECT_EQ(tensors[7][0][0], value(7, 0));
+    EXPECT_EQ(tensors[7][1][1], value(7, 1));
+    EXPECT_EQ(tensors[7][2][2], value(7, 2));
+    EXPECT_EQ(tensors[7][1][0], value(7, 3));
+    EXPECT_EQ(tensors[7][2][1], value(7, 4));
+    EXPECT_EQ(tensors[7][2][0], value(7, 5));
+    EXPECT_EQ(tensors[7], glm::transpose(tensors[7]));
+}
+
+TEST(VTKTensorConversion, NonContiguousArrays) {
+    vtkNew<vtkSOADataArrayTemplate<double>> soa;
+    fill(soa.Get(), 500, 9);
+    EXPECT_EQ(tensorio::vtkToTensors(soa), reference(soa));
+
+    vtkNew<vtkIntArray> ints;
+    fill(ints.Get(), 500, 6);
+    EXPECT_EQ(tensorio::vtkToTensors(ints), reference(ints));
+}
+
+TEST(VTKTensorConversion, Scalars) {
+    vtkNew<vtkDoubleArray> doubles;
+    fill(doubles.Get(), 100, 1);
+    vtkNew<vtkIntArray> ints;
+    fill(ints.Get(), 100, 1);
+    vtkNew<vtkSOADataArrayTemplate<float>> soa;
+    fill(soa.Get(), 100, 1);
+
+    for (vtkDataArray* array : {static_cast<vtkDataArray*>(doubles.Get()),
+                                static_cast<vtkDataArray*>(ints.Get()),
+                                static_cast<vtkDataArray*>(soa.Get())}) {
+        const auto scalars = tensorio::vtkToScalars(array);
+        ASSERT_EQ(scalars.size(), 100u);
+        for (vtkIdType i = 0; i < 100; ++i) EXPECT_EQ(scalars[i], array->GetTuple1(i));
+    }
+}
+
+TEST(VTKTensorConversion, Errors) {
+    vtkNew<vtkDoubleArray> array;
+    fill(array.Get(), 10, 3);
+    EXPECT_THROW(tensorio::vtkToTensors(array), Exception);
+    EXPECT_THROW(tensorio::vtkToScalars(array), Exception);
+}
+
+TEST(VTKTensorConversion, DISABLED_Benchmark) {
+    using Clock = std::chrono::steady_clock;
+    const vtkIdType tuples = 256 * 256 * 256;
+
+    vtkNew<vtkDoubleArray> nine;
+    nine->SetNumberOfComponents(9);
+    nine->SetNumberOfTuples(tuples);
+    nine->FillValue(1.0);
+    vtkNew<vtkFloatArray> six;
+    six->SetNumberOfComponents(6);
+    six->SetNumberOfTuples(tuples);
+    six->FillValue(1.0f);
+
+    for (vtkDataArray* array :
+         {static_cast<vtkDataArray*>(nine.Get()), static_cast<vtkDataArray*>(six.Get())}) {
+        auto start = Clock::now();
+        const auto ref = reference(array);
+        const std::chrono::duration<double, std::milli> perTuple = Clock::now() - start;
+
+        start = Clock::now();
+        const auto tensors = tensorio::vtkToTensors(array);
+        const std::chrono::duration<double, std::milli> bulk = Clock::now() - start;
+
+        EXPECT_EQ(tensors.size(), ref.size());
+        fmt::print("[ BENCH    ] {} {}x{}: per tuple {:.1f} ms, bulk {:.1f} ms\n",
+                   array->GetDataTypeAsString(), tuples, array->GetNumberOfComponents(),
+                   perTuple.count(), bulk.count());
+    }
+}
+
+}  // namespace inviwo
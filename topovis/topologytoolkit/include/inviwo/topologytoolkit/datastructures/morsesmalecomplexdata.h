@@ -40,6 +40,8 @@
 #include <ttk/core/base/morseSmaleComplex/MorseSmaleComplex.h>
 #include <warn/pop>
 
+#include <memory>
+#include <mutex>
 #include <vector>
 
 namespace inviwo {
@@ -52,6 +54,11 @@ IVW_MODULE_TOPOLOGYTOOLKIT_API CellType extremaDimToType(int dimensionality, cha
 
 IVW_MODULE_TOPOLOGYTOOLKIT_API CellType seperatrixTypeToType(int dimensionality, char type);
 
+/**
+ * Output of ttk::MorseSmaleComplex. The arrays are filled by TTK and are not to be modified
+ * afterwards. Derived lookup structures, like the separatrices in compressed row storage, are
+ * built on first use, such that processors only pay for what they access. Copies build their own.
+ */
 struct IVW_MODULE_TOPOLOGYTOOLKIT_API MorseSmaleComplexData {
 
     /**
@@ -60,8 +67,11 @@ struct IVW_MODULE_TOPOLOGYTOOLKIT_API MorseSmaleComplexData {
      *
      * @param msc   the ttk Morse-Smale complex object whose output is set up
      * @param t     matching triangulation for which the Morse-Smale complex is computed
+     * @param computeSegmentation  if false, the ascending, descending, and Morse-Smale
+     *              segmentation are neither computed nor allocated
      */
-    MorseSmaleComplexData(ttk::MorseSmaleComplex& msc, std::shared_ptr<const TriangulationData> t);
+    MorseSmaleComplexData(ttk::MorseSmaleComplex& msc, std::shared_ptr<const TriangulationData> t,
+                          bool computeSegmentation = true);
 
     // critical points
     struct CriticalPoints {
@@ -98,19 +108,70 @@ struct IVW_MODULE_TOPOLOGYTOOLKIT_API MorseSmaleComplexData {
         std::shared_ptr<BufferBase> functionMinima;
         std::shared_ptr<BufferBase> functionDiffs;
     };
-    // segmentation
+    // segmentation, one label per vertex, empty if not computed
     struct Segmentation {
         std::vector<ttk::SimplexId> ascending;
         std::vector<ttk::SimplexId> descending;
         std::vector<ttk::SimplexId> msc;
     };
 
+    /**
+     * The separatrices in compressed row storage. Separatrix i consists of the separatrix cells
+     * [offsets[i], offsets[i + 1]), and connects the critical points source[i] and
+     * destination[i], which are indices into criticalPoints or -1 if not found.
+     */
+    struct SeparatrixIndex {
+        std::vector<ttk::SimplexId> offsets;
+        std::vector<ttk::SimplexId> source;
+        std::vector<ttk::SimplexId> destination;
+
+        size_t size() const { return source.size(); }
+    };
+
     CriticalPoints criticalPoints;
     SeparatricesPoints separatrixPoints;
     SeparatrixCells separatrixCells;
     Segmentation segmentation;
 
     std::shared_ptr<const TriangulationData> triangulation;
+
+    /**
+     * Built on first use in O(n) for n separatrix cells.
+     */
+    const SeparatrixIndex& getSeparatrixIndex() const;
+
+    /**
+     * Index of the critical point of the cell with dimension \p cellDimension and id \p cellId,
+     * or -1 if there is none. The first call sorts the critical points, later calls are
+     * O(log n).
+     */
+    ttk::SimplexId findCriticalPoint(char cellDimension, ttk::SimplexId cellId) const;
+
+    vec3 getCriticalPoint(ttk::SimplexId i) const;
+    vec3 getSeparatrixPoint(ttk::SimplexId i) const;
+
+private:
+    struct Lazy {
+        std::once_flag separatricesBuilt;
+        SeparatrixIndex separatrices;
+        std::once_flag criticalPointsSorted;
+        //! critical point indices sorted by cell dimension and cell id
+        std::vector<ttk::SimplexId> criticalPointOrder;
+    };
+    /**
+     * Holds the derived data of a single MorseSmaleComplexData. A copy starts out empty and builds
+     * its own, since the arrays of the copy might be modified.
+     */
+    struct LazyHolder {
+        LazyHolder() = default;
+        LazyHolder(const LazyHolder&) : LazyHolder() {}
+        LazyHolder& operator=(const LazyHolder&) {
+            data = std::make_unique<Lazy>();
+            return *this;
+        }
+        std::unique_ptr<Lazy> data = std::make_unique<Lazy>();
+    };
+    LazyHolder lazy_;
 };
 
 }  // namespace topology
@@ -134,6 +195,7 @@ struct DataTraits<topology::MorseSmaleComplexData> {
         tb(H("Critical Points"), data.criticalPoints.numberOfPoints);
         tb(H("Separatrices No. Points"), data.separatrixPoints.numberOfPoints);
         tb(H("Separatrices No. Cells"), data.separatrixCells.numberOfCells);
+        tb(H("Segmentation"), data.segmentation.msc.empty() ? "No" : "Yes");
         return doc;
     }
 };
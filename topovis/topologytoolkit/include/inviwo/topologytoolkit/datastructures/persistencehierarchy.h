@@ -0,0 +1,94 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+#pragma once
+
+#include <inviwo/topologytoolkit/topologytoolkitmoduledefine.h>
+#include <inviwo/topologytoolkit/ports/persistencediagramport.h>
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace inviwo {
+
+namespace topology {
+
+class TriangulationData;
+
+/**
+ * \class PersistenceHierarchy
+ * \brief all critical point pairs of a scalar field ordered by persistence
+ *
+ * The hierarchy is computed once per scalar field, see TriangulationData::getPersistenceHierarchy,
+ * and holds the complete persistence diagram sorted by decreasing persistence. The pairs that
+ * survive a simplification with a given persistence threshold are thus always a prefix of the
+ * hierarchy, which is found by binary search. Simplified diagrams and the constraint points for
+ * ttk::TopologicalSimplification are derived from it in time linear in the number of kept pairs.
+ */
+class IVW_MODULE_TOPOLOGYTOOLKIT_API PersistenceHierarchy {
+public:
+    /**
+     * Compute the persistence diagram of the scalar field of @p data.
+     * @throw TTKException if ttk::PersistenceDiagram fails or @p data has no scalar values
+     */
+    PersistenceHierarchy(const TriangulationData& data, bool computeSaddleConnectors);
+
+    /**
+     * Number of pairs with a persistence of at least @p threshold
+     */
+    size_t count(float threshold) const;
+
+    /**
+     * Pairs with a persistence of at least @p threshold, or below @p threshold if @p invert is
+     * true.
+     */
+    PersistenceDiagramData diagram(float threshold, bool invert = false) const;
+
+    /**
+     * Both vertex ids of the pairs given by diagram(threshold, invert), i.e. the critical points
+     * to keep in a topological simplification.
+     */
+    std::vector<ttk::SimplexId> constraints(float threshold, bool invert = false) const;
+
+    /**
+     * All pairs in order of decreasing persistence
+     */
+    const PersistenceDiagramData& getPairs() const;
+    float getMaxPersistence() const;
+    size_t size() const;
+    bool hasSaddleConnectors() const;
+
+private:
+    PersistenceDiagramData pairs_;
+    bool saddleConnectors_;
+};
+
+}  // namespace topology
+
+}  // namespace inviwo
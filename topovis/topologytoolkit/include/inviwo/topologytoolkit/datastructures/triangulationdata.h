@@ -41,13 +41,19 @@
 #include <inviwo/core/util/document.h>
 #include <inviwo/core/metadata/metadataowner.h>
 #include <inviwo/core/datastructures/spatialdata.h>
+#include <inviwo/core/util/formatconversion.h>
+
+#include <fmt/format.h>
 
 #include <warn/push>
 #include <warn/ignore/all>
 #include <ttk/core/base/triangulation/Triangulation.h>
 #include <warn/pop>
 
+#include <array>
+#include <chrono>
 #include <memory>
+#include <mutex>
 #include <vector>
 #include <sstream>
 
@@ -55,6 +61,8 @@ namespace inviwo {
 
 namespace topology {
 
+class PersistenceHierarchy;
+
 /**
  * \group datastructures
  * \class TriangulationData
@@ -63,13 +71,41 @@ namespace topology {
  * At the moment, TTK internally only supports float positions even though ttk::Triangulation might
  * hold doubles. When accessing the point data, it is converted to float. See
  * ttk::ExplicitTriangulation::getVertexPoint().
+ *
+ * Copies are cheap. The points, cells, and the ttk::Triangulation, including any preprocessing
+ * done by TTK filters, are kept in an immutable core that is shared between all copies. Scalars and
+ * offsets are shared as well and replaced on write, i.e. setScalarValues() and setOffsets() only
+ * affect the copy they are called on. Derived data like the result of a topological simplification
+ * can therefore replace the scalars without duplicating the geometry. Functions modifying the
+ * geometry or connectivity detach the core first.
+ *
+ * \see getMemoryReport()
  */
 class IVW_MODULE_TOPOLOGYTOOLKIT_API TriangulationData : public SpatialEntity,
                                                          public MetaDataOwner {
 public:
     enum class InputTriangulation { Edges, Triangles, Tetrahedra };
+    /**
+     * Vertex ids and offsets use the id type of TTK, which is 64 bit if TTK is built with
+     * TTK_ENABLE_64BIT_IDS
+     */
+    using IdType = ttk::SimplexId;
 
-    TriangulationData() = default;
+    /**
+     * Memory used by the parts of a TriangulationData and by how many TriangulationData they are
+     * shared.
+     */
+    struct MemoryReport {
+        size_t geometryBytes = 0;  //!< points and cells
+        size_t scalarBytes = 0;
+        size_t offsetBytes = 0;
+        long geometryUsers = 0;
+        long scalarUsers = 0;
+        long offsetUsers = 0;
+        std::chrono::duration<double> setupTime{0.0};  //!< spent setting up the triangulation
+    };
+
+    TriangulationData();
     /**
      * create an implicit triangulation data from a uniform grid
      *
@@ -88,7 +124,7 @@ public:
                       Mesh::MeshInfo meshInfo);
     TriangulationData(const TriangulationData& rhs);
     TriangulationData(TriangulationData&& rhs);
-    ~TriangulationData() = default;
+    ~TriangulationData();
 
     TriangulationData& operator=(const TriangulationData& rhs);
     TriangulationData& operator=(TriangulationData&& rhs);
@@ -166,6 +202,9 @@ public:
     void set(const std::vector<vec3>& points, const std::vector<long long int>& cells);
     void set(std::vector<vec3>&& points, std::vector<long long int>&& cells);
 
+    /**
+     * add cells to the triangulation, the geometry is detached from other copies if shared
+     */
     void addIndices(const std::vector<uint32_t>& indices, InputTriangulation type);
     void addIndices(const std::vector<uint32_t>& indices, Mesh::MeshInfo meshInfo);
 
@@ -205,17 +244,40 @@ public:
      *
      * @throw TTKException if number of offsets is different from number of vertices
      */
-    void setOffsets(const std::vector<int>& offsets);
-    void setOffsets(std::vector<int>&& offsets);
+    void setOffsets(const std::vector<IdType>& offsets);
+    void setOffsets(std::vector<IdType>&& offsets);
     /**
      * \brief return position/scalar value offsets used in connection with ttk triangulation data
      *
-     * If unset, a sequence from 0 to n-1 is returned with n = number of vertices
+     * If unset, a sequence from 0 to n-1 is returned with n = number of vertices. The identity
+     * sequence is created once and shared by all copies, TTK filters can use the returned offsets
+     * directly without copying them.
+     *
+     * @return offsets used by TTK functions
+     */
+    const std::vector<IdType>& getOffsets() const;
+    /**
+     * \brief return the offsets for modification
+     *
+     * The offsets are detached from other copies if shared and cached data depending on them,
+     * like the persistence hierarchy, is reset.
      *
      * @return offsets used by TTK functions
      */
-    std::vector<int>& getOffsets();
-    const std::vector<int>& getOffsets() const;
+    std::vector<IdType>& editOffsets();
+
+    /**
+     * \brief return all persistence pairs of the scalar field ordered by persistence
+     *
+     * The hierarchy is computed on first use, cached until the scalars or offsets change, and
+     * shared between copies. Simplified persistence diagrams for any threshold
+     * can then be derived without rerunning ttk::PersistenceDiagram.
+     *
+     * @throw TTKException if no scalar values are set or the computation fails
+     * @see PersistenceHierarchy
+     */
+    std::shared_ptr<const PersistenceHierarchy> getPersistenceHierarchy(
+        bool computeSaddleConnectors = false) const;
 
     /**
      * returns the cell information as VTK triangle index representation
@@ -223,9 +285,27 @@ public:
     const std::vector<long long int>& getCells() const;
     const std::vector<vec3>& getPoints() const;
     vec3 getPoint(const int index) const;
+    /**
+     * The non-const version detaches the ttk::Triangulation from other copies if shared. Use
+     * setupTriangulation() for handing the triangulation to a TTK filter.
+     */
     ttk::Triangulation& getTriangulation();
     const ttk::Triangulation& getTriangulation() const;
 
+    /**
+     * \brief call \p filter.setupTriangulation() with the shared ttk::Triangulation
+     *
+     * TTK filters precondition the triangulation, i.e. build the required lookup tables, when the
+     * triangulation is set up. Since the triangulation is shared between copies, this is done while
+     * holding a lock. Afterwards, the filter only queries the preconditioned triangulation and can
+     * run concurrently with other filters using the same triangulation.
+     */
+    template <typename Filter>
+    void setupTriangulation(Filter& filter) const {
+        std::scoped_lock lock{getTriangulationMutex()};
+        filter.setupTriangulation(getSharedTriangulation());
+    }
+
     vec3& operator[](size_t i);
     const vec3& operator[](size_t i) const;
 
@@ -236,6 +316,8 @@ public:
      */
     size_t getCellCount() const;
 
+    MemoryReport getMemoryReport() const;
+
     virtual const SpatialCameraCoordinateTransformer& getCoordinateTransformer(
         const Camera& camera) const override;
     using SpatialEntity::getCoordinateTransformer;
@@ -246,47 +328,41 @@ private:
     std::vector<uint32_t> convertToLines(const std::vector<uint32_t>& indices,
                                          Mesh::MeshInfo meshInfo);
 
-    void unsetGrid();
-
+    void checkScalarCount(size_t count) const;
+    std::mutex& getTriangulationMutex() const;
+    ttk::Triangulation* getSharedTriangulation() const;
     /**
-     *  input cells of the triangulation, corresponds to VTK triangle representation
-     * Format: <#vertices in cell 1>, <v0_1>, <v1_1>, ..., <#vertices in cell 2>, <v0_2>, <v1_2>,
-     * ...
+     * make sure this is the only user of the core before modifying it
      */
-    std::vector<long long int> cells_;
-    mutable std::vector<vec3>
-        points_;  //!< triangle vertices, mutable due to possible change in getPoints
-    mutable std::vector<int> offsets_;  //!< matching offsets
-
-    ttk::Triangulation triangulation_;
+    void detach();
 
+    struct Core;
+    std::shared_ptr<Core> core_;  //!< points, cells, and the ttk::Triangulation
     std::shared_ptr<BufferBase> scalars_;  //!< scalars associated with vertices of triangulation
-    DataMapper volumeDataMapper_;  //!< Data mapper associated with volume scalar values, only used
-                                   //!< for implicit grids
-
-    size3_t gridDims_;
-    vec3 gridOrigin_;
-    vec3 gridExtent_;
+    std::shared_ptr<std::vector<IdType>> offsets_;  //!< matching offsets, identity if unset
+
+    struct Persistence {
+        //! indexed by computeSaddleConnectors
+        std::array<std::once_flag, 2> computed;
+        std::array<std::shared_ptr<const PersistenceHierarchy>, 2> hierarchy;
+    };
+    void resetCaches();
+    //! lazily computed persistence hierarchies, reset when scalars or offsets change
+    std::shared_ptr<Persistence> persistence_;
 };
 
 template <typename T, typename std::enable_if<util::rank<T>::value == 0>::type>
 void TriangulationData::setScalarValues(const std::vector<T>& values) {
-    if (values.size() < points_.size()) {
-        throw TTKException("Too little data (" + std::to_string(values.size()) +
-                           " values given, but triangulation holds " +
-                           std::to_string(points_.size()) + " positions");
-    }
-    scalars_ = util::makeBuffer<T>(std::move(std::vector<T>(values)));
+    checkScalarCount(values.size());
+    scalars_ = util::makeBuffer<T>(std::vector<T>(values));
+    resetCaches();
 }
 
 template <typename T, typename std::enable_if<util::rank<T>::value == 0>::type>
 void TriangulationData::setScalarValues(std::vector<T>&& values) {
-    if (values.size() < points_.size()) {
-        throw TTKException("Too little data (" + std::to_string(values.size()) +
-                           " values given, but triangulation holds " +
-                           std::to_string(points_.size()) + " positions");
-    }
+    checkScalarCount(values.size());
     scalars_ = util::makeBuffer<T>(std::move(values));
+    resetCaches();
 }
 
 }  // namespace topology
@@ -302,7 +378,7 @@ struct DataTraits<topology::TriangulationData> {
         Document doc;
         doc.append("b", dataName(), {{"style", "color:white;"}});
         utildoc::TableBuilder tb(doc.handle(), P::end());
-        auto triangulation = data.getTriangulation();
+        const auto& triangulation = data.getTriangulation();
         tb(H("Implicit Triangulation"), data.isUniformGrid());
         tb(H("Dimensionality"), triangulation.getDimensionality());
         tb(H("Number of Cells"), triangulation.getNumberOfCells());
@@ -314,6 +390,14 @@ struct DataTraits<topology::TriangulationData> {
         } else {
             tb(H("Type of Scalars"), "<none>");
         }
+        const auto report = data.getMemoryReport();
+        auto shared = [](size_t bytes, long users) {
+            return fmt::format("{}, shared by {}", util::formatBytesToString(bytes), users);
+        };
+        tb(H("Geometry"), shared(report.geometryBytes, report.geometryUsers));
+        tb(H("Scalars"), shared(report.scalarBytes, report.scalarUsers));
+        tb(H("Offsets"), shared(report.offsetBytes, report.offsetUsers));
+        tb(H("Setup Time"), fmt::format("{:.3f} s", report.setupTime.count()));
         return doc;
     }
 };
@@ -52,6 +52,8 @@
 #include <ttk/core/base/ftmTree/FTMTree.h>
 #include <warn/pop>
 
+#include <vector>
+
 namespace inviwo {
 
 /** \docpage{org.inviwo.ContourTree, Contour Tree}
@@ -73,6 +75,7 @@ namespace inviwo {
  *		+ __Tree Type__ Defines which tree type to calculate
  *		+ __Number of Threads__ Defines how many threads to use when calculating the tree
  *
+ * The most recently computed trees are kept and reused when the same triangulation is seen again.
  */
 
 /**
@@ -100,6 +103,15 @@ private:
     BoolProperty normalization_;
 
     std::shared_ptr<topology::ContourTreeData> treeData_;
+
+    struct CachedTree {
+        bool segmentation;
+        bool normalization;
+        std::shared_ptr<topology::ContourTreeData> tree;
+    };
+    static constexpr size_t maxCachedTrees = 8;
+    //! most recently used trees first
+    std::vector<CachedTree> trees_;
     bool treeIsFinished_ = true;
     bool inportChanged_ = false;
 
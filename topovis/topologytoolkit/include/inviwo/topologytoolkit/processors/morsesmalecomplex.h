@@ -54,6 +54,10 @@ namespace inviwo {
  * ### Outports
  *   * __outport__     Morse-Smale complex
  *
+ * ### Properties
+ *   * __Compute Segmentation__ compute the ascending, descending, and Morse-Smale segmentation
+ *                              labels for each vertex. Can be disabled to save three ids per
+ *                              vertex if only the geometry of the complex is needed.
  */
 
 /**
@@ -83,6 +87,7 @@ private:
     BoolProperty returnSaddleConnectors_;
     BoolProperty computeSaddleConnectors_;
     FloatProperty saddleConnectorsPersistenceThreshold_;
+    BoolProperty computeSegmentation_;
 
     std::future<std::shared_ptr<const topology::MorseSmaleComplexData>> newMsc_;
 
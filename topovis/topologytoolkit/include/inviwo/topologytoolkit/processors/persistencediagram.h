@@ -38,6 +38,7 @@
 #include <inviwo/core/common/inviwo.h>
 #include <inviwo/core/processors/poolprocessor.h>
 #include <inviwo/core/properties/boolproperty.h>
+#include <inviwo/core/properties/ordinalproperty.h>
 
 #include <inviwo/dataframe/datastructures/dataframe.h>
 
@@ -57,6 +58,12 @@ namespace inviwo {
  *   * __dataframe__ DataFrame with birth and death of the extremum-saddle pairs. The
  *                   persistence diagram can be created of these by setting X to birth and
  *                   drawing vertical lines from birth to death
+ *
+ * ### Properties
+ *   * __Compute Saddle Connectors__ include saddle-saddle pairs
+ *   * __Persistence Threshold__     only pairs with at least this persistence are output. The
+ *                                   complete diagram is cached per scalar field, changing the
+ *                                   threshold does not recompute it.
  */
 
 /**
@@ -79,6 +86,7 @@ private:
     topology::PersistenceDiagramOutport outport_;
     DataFrameOutport dataFrameOutport_;
     BoolProperty computeSaddleConnectors_;
+    FloatProperty threshold_;
 };
 
 }  // namespace inviwo
@@ -33,22 +33,30 @@
 #include <inviwo/topologytoolkit/topologytoolkitmoduledefine.h>
 #include <inviwo/topologytoolkit/ports/persistencediagramport.h>
 #include <inviwo/topologytoolkit/ports/triangulationdataport.h>
+#include <inviwo/topologytoolkit/datastructures/persistencehierarchy.h>
 
 #include <inviwo/core/common/inviwo.h>
 #include <inviwo/core/processors/poolprocessor.h>
 #include <inviwo/core/properties/ordinalproperty.h>
 #include <inviwo/core/properties/boolproperty.h>
 
+#include <map>
+#include <memory>
+#include <optional>
+#include <utility>
+
 namespace inviwo {
 
 /** \docpage{org.inviwo.ttk.TopologicalSimplification, Topological Simplification}
  * ![](org.inviwo.ttk.TopologicalSimplification.png?classIdentifier=org.inviwo.ttk.TopologicalSimplification)
  * Removes critical points that have a persistence below the given threshold.
- * Used in conjunction with PersistenceDiagram.
+ * Used in conjunction with PersistenceDiagram. If no persistence diagram is connected, the
+ * persistence hierarchy cached in the triangulation is used instead. The most recent
+ * simplifications are kept, such that going back to a previous threshold is instant.
  *
  * ### Inports
  *   * __triangulation__   input triangulation
- *   * __persistance__     matching persistence diagram
+ *   * __persistance__     matching persistence diagram (optional)
  *
  * ### Outports
  *   * __outport__   output triangulation with critical points below/above threshold removed
@@ -74,12 +82,24 @@ public:
     static const ProcessorInfo processorInfo_;
 
 private:
+    /**
+     * Number of pairs with a persistence of at least @p threshold, which uniquely identifies the
+     * constraints of the simplification. Empty if not known without computing the hierarchy.
+     */
+    std::optional<size_t> keptPairs(float threshold) const;
+
     topology::TriangulationInport inport_;
     topology::PersistenceDiagramInport persistenceInport_;
     topology::TriangulationOutport outport_;
 
     FloatProperty threshold_;
     BoolProperty invert_;
+
+    static constexpr size_t maxCachedResults = 16;
+    std::shared_ptr<const topology::PersistenceHierarchy> hierarchy_;
+    //! simplified triangulations by number of kept pairs and invert
+    std::map<std::pair<size_t, bool>, std::shared_ptr<const topology::TriangulationData>>
+        simplified_;
 };
 
 }  // namespace inviwo
@@ -32,12 +32,14 @@
 
 #include <inviwo/topologytoolkit/topologytoolkitmoduledefine.h>
 #include <inviwo/topologytoolkit/ports/triangulationdataport.h>
+#include <inviwo/topologytoolkit/utils/ttkutils.h>
 
 #include <inviwo/core/common/inviwo.h>
 #include <inviwo/core/processors/processor.h>
 #include <inviwo/core/properties/ordinalproperty.h>
 #include <inviwo/core/properties/boolproperty.h>
 #include <inviwo/core/properties/optionproperty.h>
+#include <inviwo/core/properties/minmaxproperty.h>
 #include <inviwo/core/ports/meshport.h>
 
 namespace inviwo {
@@ -56,6 +58,9 @@ namespace inviwo {
  *   * __Mesh Color__       color of mesh vertices
  *   * __Map to Component__ if mapping to position is enabled, scalar values of the
  *                          triangulation overwrite this component
+ *   * __Tetrahedra Faces__ extract all faces of tetrahedra or only the boundary faces
+ *   * __Include Isovalue Range__ also extract interior faces overlapping the scalar range
+ *   * __Isovalue Range__   scalar range of the additional interior faces
  */
 
 /**
@@ -80,6 +85,9 @@ private:
     FloatVec4Property color_;
     BoolProperty mapScalars_;
     OptionPropertyInt component_;
+    OptionProperty<topology::TetraFaces> faces_;
+    BoolProperty includeIsoRange_;
+    DoubleMinMaxProperty isoRange_;
 };
 
 }  // namespace inviwo
@@ -37,6 +37,7 @@
 #include <inviwo/core/datastructures/geometry/mesh.h>
 #include <inviwo/core/datastructures/volume/volume.h>
 
+#include <optional>
 #include <vector>
 
 namespace inviwo {
@@ -58,24 +59,42 @@ namespace topology {
  */
 IVW_MODULE_TOPOLOGYTOOLKIT_API TriangulationData meshToTTKTriangulation(const Mesh& mesh);
 
+/**
+ * Selects which faces of tetrahedra are converted into triangles
+ */
+enum class TetraFaces {
+    All,       //!< all four faces of each tetrahedron, interior faces are duplicated
+    Boundary,  //!< only faces that belong to exactly one tetrahedron
+};
+
 /**
  * \brief convert TriangulationData into a Mesh
  *
  * Convert TriangulationData \p data into a Mesh, scalars can optionally overwrite one
  * position component
  *
+ * For tetrahedral meshes, \p faces determines which faces are extracted. With
+ * TetraFaces::Boundary, the faces of all tetrahedra are sorted in parallel by their vertex ids and
+ * only faces occurring once are kept. If \p isoRange is given, interior faces whose scalar range
+ * overlaps it are kept as well.
+ *
  * TODO: mesh normals based on neighborhood information
  *
  * @param data    triangulation data
  * @param color   used for coloring all vertices
  * @param applyScalars  if true, scalar values will overwrite one position component
  * @param component  scalar values overwrite this component of the vertex positions, i.e. x, y, or z
+ * @param faces   faces of tetrahedra to include
+ * @param isoRange  additionally include interior faces overlapping this scalar range, only used
+ *                  with TetraFaces::Boundary and if \p data has scalars
  * @return Mesh of given triangulation and color
  */
 IVW_MODULE_TOPOLOGYTOOLKIT_API
 std::shared_ptr<Mesh> ttkTriangulationToMesh(const TriangulationData& data,
                                              const vec4& color = vec4(1.0f),
-                                             bool applyScalars = false, size_t component = 0);
+                                             bool applyScalars = false, size_t component = 0,
+                                             TetraFaces faces = TetraFaces::All,
+                                             std::optional<dvec2> isoRange = std::nullopt);
 
 /**
  * \brief convert a Volume to TriangulationData
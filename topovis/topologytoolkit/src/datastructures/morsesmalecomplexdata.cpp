@@ -31,12 +31,17 @@
 #include <inviwo/core/datastructures/buffer/bufferramprecision.h>
 #include <inviwo/core/util/assertion.h>
 
+#include <algorithm>
+#include <numeric>
+#include <tuple>
+
 namespace inviwo {
 
 namespace topology {
 
 MorseSmaleComplexData::MorseSmaleComplexData(ttk::MorseSmaleComplex& msc,
-                                             std::shared_ptr<const TriangulationData> t)
+                                             std::shared_ptr<const TriangulationData> t,
+                                             bool computeSegmentation)
     : triangulation(t) {
 
     IVW_ASSERT(triangulation, "triangulation is not valid");
@@ -71,13 +76,82 @@ MorseSmaleComplexData::MorseSmaleComplexData(ttk::MorseSmaleComplex& msc,
             separatrixCells.functionDiffs = std::make_shared<Buffer<ValueType>>(functionDiffRAM);
         });
 
-    const auto numVertices = t->getPoints().size();
-    segmentation.ascending = std::vector(numVertices, -1);
-    segmentation.descending = std::vector(numVertices, -1);
-    segmentation.msc = std::vector(numVertices, -1);
+    msc.setComputeAscendingSegmentation(computeSegmentation);
+    msc.setComputeDescendingSegmentation(computeSegmentation);
+    msc.setComputeFinalSegmentation(computeSegmentation);
+    if (computeSegmentation) {
+        const auto numVertices =
+            static_cast<size_t>(t->getTriangulation().getNumberOfVertices());
+        segmentation.ascending = std::vector<ttk::SimplexId>(numVertices, -1);
+        segmentation.descending = std::vector<ttk::SimplexId>(numVertices, -1);
+        segmentation.msc = std::vector<ttk::SimplexId>(numVertices, -1);
+
+        msc.setOutputMorseComplexes(segmentation.ascending.data(), segmentation.descending.data(),
+                                    segmentation.msc.data());
+    } else {
+        msc.setOutputMorseComplexes(nullptr, nullptr, nullptr);
+    }
+}
+
+const MorseSmaleComplexData::SeparatrixIndex& MorseSmaleComplexData::getSeparatrixIndex() const {
+    auto& lazy = *lazy_.data;
+    std::call_once(lazy.separatricesBuilt, [&]() {
+        const auto& sc = separatrixCells;
+        const auto& sp = separatrixPoints;
+        auto& index = lazy.separatrices;
+
+        // cells of the same separatrix are consecutive
+        for (ttk::SimplexId i = 0; i < sc.numberOfCells; ++i) {
+            if (i == 0 || sc.separatrixIds[i - 1] != sc.separatrixIds[i]) {
+                index.offsets.push_back(i);
+            }
+        }
+        index.offsets.push_back(sc.numberOfCells);
+
+        const auto numSeparatrices = index.offsets.size() - 1;
+        index.source.resize(numSeparatrices);
+        index.destination.resize(numSeparatrices);
+        for (size_t s = 0; s < numSeparatrices; ++s) {
+            const auto src = sc.cells[3 * index.offsets[s] + 1];
+            const auto dst = sc.cells[3 * (index.offsets[s + 1] - 1) + 2];
+            index.source[s] = findCriticalPoint(sp.cellDimensions[src], sp.cellIds[src]);
+            index.destination[s] = findCriticalPoint(sp.cellDimensions[dst], sp.cellIds[dst]);
+        }
+    });
+    return lazy.separatrices;
+}
+
+ttk::SimplexId MorseSmaleComplexData::findCriticalPoint(char cellDimension,
+                                                        ttk::SimplexId cellId) const {
+    const auto& cp = criticalPoints;
+    const auto key = [&](ttk::SimplexId i) {
+        return std::make_tuple(cp.cellDimensions[i], cp.cellIds[i]);
+    };
+
+    auto& lazy = *lazy_.data;
+    std::call_once(lazy.criticalPointsSorted, [&]() {
+        lazy.criticalPointOrder.resize(cp.numberOfPoints);
+        std::iota(lazy.criticalPointOrder.begin(), lazy.criticalPointOrder.end(),
+                  ttk::SimplexId{0});
+        std::sort(lazy.criticalPointOrder.begin(), lazy.criticalPointOrder.end(),
+                  [&](ttk::SimplexId a, ttk::SimplexId b) { return key(a) < key(b); });
+    });
+
+    const auto& order = lazy.criticalPointOrder;
+    const auto value = std::make_tuple(cellDimension, cellId);
+    const auto it = std::lower_bound(order.begin(), order.end(), value,
+                                     [&](ttk::SimplexId i, const auto& v) { return key(i) < v; });
+    return (it != order.end() && key(*it) == value) ? *it : -1;
+}
+
+vec3 MorseSmaleComplexData::getCriticalPoint(ttk::SimplexId i) const {
+    const auto& p = criticalPoints.points;
+    return {p[3 * i + 0], p[3 * i + 1], p[3 * i + 2]};
+}
 
-    msc.setOutputMorseComplexes(segmentation.ascending.data(), segmentation.descending.data(),
-                                segmentation.msc.data());
+vec3 MorseSmaleComplexData::getSeparatrixPoint(ttk::SimplexId i) const {
+    const auto& p = separatrixPoints.points;
+    return {p[3 * i + 0], p[3 * i + 1], p[3 * i + 2]};
 }
 
 CellType extremaDimToType(int dimensionality, char cellDim) {
@@ -0,0 +1,139 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/topologytoolkit/datastructures/persistencehierarchy.h>
+#include <inviwo/topologytoolkit/datastructures/triangulationdata.h>
+#include <inviwo/topologytoolkit/utils/ttkexception.h>
+#include <inviwo/core/datastructures/buffer/bufferram.h>
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <ttk/core/base/persistenceDiagram/PersistenceDiagram.h>
+#include <warn/pop>
+
+#include <algorithm>
+#include <execution>
+
+namespace inviwo {
+
+namespace topology {
+
+PersistenceHierarchy::PersistenceHierarchy(const TriangulationData& data,
+                                           bool computeSaddleConnectors)
+    : saddleConnectors_{computeSaddleConnectors} {
+    auto scalars = data.getScalarValues();
+    if (!scalars) {
+        throw TTKException("Cannot compute persistence hierarchy, TriangulationData has no "
+                           "scalar values");
+    }
+
+    pairs_ = scalars->getRepresentation<BufferRAM>()
+                 ->dispatch<PersistenceDiagramData, dispatching::filter::Scalars>(
+                     [&](const auto buffer) -> PersistenceDiagramData {
+                         using ValueType = util::PrecisionValueType<decltype(buffer)>;
+                         using DiagramOutput =
+                             std::vector<std::tuple<ttk::SimplexId, ttk::CriticalType,
+                                                    ttk::SimplexId, ttk::CriticalType, ValueType,
+                                                    ttk::SimplexId>>;
+
+                         DiagramOutput output;
+                         ttk::PersistenceDiagram diagram;
+                         diagram.setComputeSaddleConnectors(computeSaddleConnectors);
+                         data.setupTriangulation(diagram);
+                         diagram.setOutputCTDiagram(&output);
+                         diagram.setInputScalars(
+                             const_cast<ValueType*>(buffer->getDataContainer().data()));
+                         diagram.setInputOffsets(
+                             const_cast<ttk::SimplexId*>(data.getOffsets().data()));
+
+                         if (diagram.execute<typename DataFormat<ValueType>::primitive,
+                                             ttk::SimplexId>() != 0) {
+                             throw TTKException("Error computing ttk::PersistenceDiagram");
+                         }
+
+                         // the persistence diagram port stores the persistence as float
+                         PersistenceDiagramData pairs;
+                         pairs.reserve(output.size());
+                         for (auto& elem : output) {
+                             pairs.emplace_back(std::get<0>(elem), std::get<1>(elem),
+                                                std::get<2>(elem), std::get<3>(elem),
+                                                static_cast<float>(std::get<4>(elem)),
+                                                std::get<5>(elem));
+                         }
+                         return pairs;
+                     });
+
+    // stable, such that pairs of equal persistence keep the order given by TTK
+    std::stable_sort(std::execution::par_unseq, pairs_.begin(), pairs_.end(),
+                     [](const auto& a, const auto& b) { return std::get<4>(a) > std::get<4>(b); });
+}
+
+size_t PersistenceHierarchy::count(float threshold) const {
+    const auto it = std::partition_point(pairs_.begin(), pairs_.end(), [&](const auto& pair) {
+        return std::get<4>(pair) >= threshold;
+    });
+    return static_cast<size_t>(std::distance(pairs_.begin(), it));
+}
+
+PersistenceDiagramData PersistenceHierarchy::diagram(float threshold, bool invert) const {
+    const auto split = pairs_.begin() + count(threshold);
+    if (invert) {
+        return PersistenceDiagramData(split, pairs_.end());
+    } else {
+        return PersistenceDiagramData(pairs_.begin(), split);
+    }
+}
+
+std::vector<ttk::SimplexId> PersistenceHierarchy::constraints(float threshold, bool invert) const {
+    const auto split = pairs_.begin() + count(threshold);
+    const auto begin = invert ? split : pairs_.begin();
+    const auto end = invert ? pairs_.end() : split;
+
+    std::vector<ttk::SimplexId> vertices;
+    vertices.reserve(2 * std::distance(begin, end));
+    for (auto it = begin; it != end; ++it) {
+        vertices.push_back(std::get<0>(*it));
+        vertices.push_back(std::get<2>(*it));
+    }
+    return vertices;
+}
+
+const PersistenceDiagramData& PersistenceHierarchy::getPairs() const { return pairs_; }
+
+float PersistenceHierarchy::getMaxPersistence() const {
+    return pairs_.empty() ? 0.0f : std::get<4>(pairs_.front());
+}
+
+size_t PersistenceHierarchy::size() const { return pairs_.size(); }
+
+bool PersistenceHierarchy::hasSaddleConnectors() const { return saddleConnectors_; }
+
+}  // namespace topology
+
+}  // namespace inviwo
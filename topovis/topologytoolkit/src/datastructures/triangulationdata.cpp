@@ -28,156 +28,191 @@
  *********************************************************************************/
 
 #include <inviwo/topologytoolkit/datastructures/triangulationdata.h>
+#include <inviwo/topologytoolkit/datastructures/persistencehierarchy.h>
 #include <inviwo/topologytoolkit/utils/ttkexception.h>
 
-#include <algorithm>
 #include <inviwo/core/util/formats.h>
+#include <inviwo/core/util/formatdispatching.h>
+#include <inviwo/core/datastructures/buffer/bufferram.h>
+
+#include <algorithm>
+#include <chrono>
+#include <mutex>
+#include <numeric>
+#include <utility>
 
 namespace inviwo {
 
 namespace topology {
 
+/**
+ * The geometry and connectivity of a triangulation, shared between all copies of a
+ * TriangulationData. The ttk::Triangulation refers to the points and cells of the core, hence a
+ * copy of the core has to set up its own ttk::Triangulation.
+ */
+struct TriangulationData::Core {
+    Core() = default;
+    Core(const Core& rhs)
+        : cells{rhs.cells}
+        , points{rhs.points}
+        , triangulation{rhs.triangulation}
+        , volumeDataMapper{rhs.volumeDataMapper}
+        , gridDims{rhs.gridDims}
+        , gridOrigin{rhs.gridOrigin}
+        , gridExtent{rhs.gridExtent} {
+
+        const auto start = std::chrono::steady_clock::now();
+        if (isUniformGrid()) {
+            setGrid();
+        } else {
+            triangulation.setInputPoints(static_cast<int>(points.size()), points.data(), false);
+            triangulation.setInputCells(static_cast<int>(getCellCount()), cells.data());
+            triangulation.setPeriodicBoundaryConditions(
+                rhs.triangulation.usesPeriodicBoundaryConditions());
+        }
+        setupTime = std::chrono::steady_clock::now() - start;
+    }
+    Core& operator=(const Core&) = delete;
+
+    bool isUniformGrid() const { return glm::compMul(gridDims) > 0u; }
+
+    size_t getCellCount() const {
+        // determine number of cells based on VTK index list
+        size_t numCells = 0;
+        for (size_t i = 0; i < cells.size(); i += cells[i] + 1) {
+            ++numCells;
+        }
+        return numCells;
+    }
+
+    size_t getNumberOfVertices() const {
+        return isUniformGrid() ? glm::compMul(gridDims) : points.size();
+    }
+
+    void setGrid() {
+        const vec3 spacing(gridExtent / vec3(gridDims));
+        triangulation.setInputGrid(gridOrigin.x, gridOrigin.y, gridOrigin.z, spacing.x,
+                                   spacing.y, spacing.z, static_cast<int>(gridDims.x),
+                                   static_cast<int>(gridDims.y), static_cast<int>(gridDims.z));
+    }
+
+    const std::vector<IdType>& getIdentityOffsets() {
+        std::call_once(identityCreated, [&]() {
+            identityOffsets.resize(getNumberOfVertices());
+            std::iota(identityOffsets.begin(), identityOffsets.end(), IdType{0});
+        });
+        return identityOffsets;
+    }
+
+    void unsetGrid() {
+        // unset grid information
+        gridDims = size3_t(0u);
+        gridOrigin = vec3(0.0f);
+        gridExtent = vec3(0.0f);
+    }
+
+    /**
+     *  input cells of the triangulation, corresponds to VTK triangle representation
+     * Format: <#vertices in cell 1>, <v0_1>, <v1_1>, ..., <#vertices in cell 2>, <v0_2>, <v1_2>,
+     * ...
+     */
+    std::vector<long long int> cells;
+    std::vector<vec3> points;  //!< triangle vertices, filled lazily for uniform grids
+    ttk::Triangulation triangulation;
+    //! guards the preconditioning of the triangulation and the lazily created points
+    mutable std::mutex mutex;
+
+    DataMapper volumeDataMapper;  //!< Data mapper associated with volume scalar values, only used
+                                  //!< for implicit grids
+    size3_t gridDims{0u};
+    vec3 gridOrigin{0.0f};
+    vec3 gridExtent{0.0f};
+
+    std::chrono::duration<double> setupTime{0.0};  //!< time spent setting up the triangulation
+
+    //! offsets used if none are set, i.e. a sequence from 0 to n-1 for n vertices
+    std::once_flag identityCreated;
+    std::vector<IdType> identityOffsets;
+};
+
+TriangulationData::TriangulationData()
+    : core_{std::make_shared<Core>()}
+    , persistence_{std::make_shared<Persistence>()} {}
+
 TriangulationData::TriangulationData(const size3_t& dims, const vec3& origin, const vec3& extent,
-                                     const DataMapper& dataMapper) {
+                                     const DataMapper& dataMapper)
+    : TriangulationData() {
     set(dims, origin, extent, dataMapper);
 }
 
 TriangulationData::TriangulationData(std::vector<vec3> points, const std::vector<uint32_t>& indices,
-                                     InputTriangulation type) {
+                                     InputTriangulation type)
+    : TriangulationData() {
     set(std::move(points), indices, type);
 }
 
 TriangulationData::TriangulationData(std::vector<vec3> points, const std::vector<uint32_t>& indices,
-                                     Mesh::MeshInfo meshInfo) {
+                                     Mesh::MeshInfo meshInfo)
+    : TriangulationData() {
     set(std::move(points), indices, meshInfo);
 }
 
-TriangulationData::TriangulationData(const TriangulationData& rhs)
-    : SpatialEntity(rhs)
-    , MetaDataOwner(rhs)
-    , cells_(rhs.cells_)
-    , points_(rhs.points_)
-    , offsets_(rhs.offsets_)
-    , triangulation_{rhs.triangulation_}
-    , scalars_(rhs.scalars_->clone())
-    , gridDims_(rhs.gridDims_)
-    , gridOrigin_(rhs.gridOrigin_)
-    , gridExtent_(rhs.gridExtent_) {
-
-    if (rhs.isUniformGrid()) {
-        set(gridDims_, gridOrigin_, gridExtent_, rhs.getDataMapper());
-    } else {
-        triangulation_.setInputPoints(static_cast<int>(points_.size()), points_.data(), false);
-        triangulation_.setInputCells(static_cast<int>(getCellCount()), cells_.data());
-        triangulation_.setPeriodicBoundaryConditions(
-            rhs.triangulation_.usesPeriodicBoundaryConditions());
-    }
-}
+TriangulationData::TriangulationData(const TriangulationData& rhs) = default;
 
 TriangulationData::TriangulationData(TriangulationData&& rhs)
     : SpatialEntity(rhs)
     , MetaDataOwner(rhs)
-    , cells_(std::move(rhs.cells_))
-    , points_(std::move(rhs.points_))
-    , offsets_(std::move(rhs.offsets_))
-    , triangulation_{std::move(rhs.triangulation_)}
-    , scalars_(std::move(rhs.scalars_))
-    , gridDims_(std::move(rhs.gridDims_))
-    , gridOrigin_(std::move(rhs.gridOrigin_))
-    , gridExtent_(std::move(rhs.gridExtent_)) {
-    if (rhs.isUniformGrid()) {
-        set(gridDims_, gridOrigin_, gridExtent_, rhs.getDataMapper());
-    } else {
-        triangulation_.setInputPoints(static_cast<int>(points_.size()), points_.data(), false);
-        triangulation_.setInputCells(static_cast<int>(getCellCount()), cells_.data());
-        triangulation_.setPeriodicBoundaryConditions(
-            rhs.triangulation_.usesPeriodicBoundaryConditions());
-    }
-}
+    , core_{std::exchange(rhs.core_, std::make_shared<Core>())}
+    , scalars_{std::move(rhs.scalars_)}
+    , offsets_{std::move(rhs.offsets_)}
+    , persistence_{std::exchange(rhs.persistence_, std::make_shared<Persistence>())} {}
 
-TriangulationData& TriangulationData::operator=(const TriangulationData& rhs) {
-    if (this != &rhs) {
-        SpatialEntity::operator=(rhs);
-        MetaDataOwner::operator=(rhs);
+TriangulationData::~TriangulationData() = default;
 
-        cells_ = rhs.cells_;
-        points_ = rhs.points_;
-        offsets_ = rhs.offsets_;
-        triangulation_ = rhs.triangulation_;
-        scalars_.reset(rhs.scalars_->clone());
-        gridDims_ = rhs.gridDims_;
-        gridOrigin_ = rhs.gridOrigin_;
-        gridExtent_ = rhs.gridExtent_;
-
-        if (rhs.isUniformGrid()) {
-            set(gridDims_, gridOrigin_, gridExtent_, rhs.getDataMapper());
-        } else {
-            triangulation_.setInputPoints(static_cast<int>(points_.size()), points_.data(), false);
-            triangulation_.setInputCells(static_cast<int>(getCellCount()), cells_.data());
-            triangulation_.setPeriodicBoundaryConditions(
-                rhs.triangulation_.usesPeriodicBoundaryConditions());
-        }
-    }
-    return *this;
-}
+TriangulationData& TriangulationData::operator=(const TriangulationData& rhs) = default;
 
 TriangulationData& TriangulationData::operator=(TriangulationData&& rhs) {
     if (this != &rhs) {
         SpatialEntity::operator=(rhs);
         MetaDataOwner::operator=(rhs);
-
-        cells_ = std::move(rhs.cells_);
-        points_ = std::move(rhs.points_);
-        offsets_ = std::move(rhs.offsets_);
-        triangulation_ = std::move(rhs.triangulation_);
+        core_ = std::exchange(rhs.core_, std::make_shared<Core>());
         scalars_ = std::move(rhs.scalars_);
-        gridDims_ = std::move(rhs.gridDims_);
-        gridOrigin_ = std::move(rhs.gridOrigin_);
-        gridExtent_ = std::move(rhs.gridExtent_);
-
-        if (rhs.isUniformGrid()) {
-            set(gridDims_, gridOrigin_, gridExtent_, rhs.getDataMapper());
-        } else {
-            triangulation_.setInputPoints(static_cast<int>(points_.size()), points_.data(), false);
-            triangulation_.setInputCells(static_cast<int>(getCellCount()), cells_.data());
-            triangulation_.setPeriodicBoundaryConditions(
-                rhs.triangulation_.usesPeriodicBoundaryConditions());
-        }
+        offsets_ = std::move(rhs.offsets_);
+        persistence_ = std::exchange(rhs.persistence_, std::make_shared<Persistence>());
     }
     return *this;
 }
 
 TriangulationData* TriangulationData::clone() const { return new TriangulationData(*this); }
 
-bool TriangulationData::isUniformGrid() const {
-    // cannot use triangulation_.getGridDimensions(std::vector<int>&) here since it is not const
-    return glm::compMul(gridDims_) > 0u;
-}
+bool TriangulationData::isUniformGrid() const { return core_->isUniformGrid(); }
 
 DataMapper TriangulationData::getDataMapper() const {
-    return isUniformGrid() ? volumeDataMapper_ : DataMapper();
+    return isUniformGrid() ? core_->volumeDataMapper : DataMapper();
 }
 
 size3_t TriangulationData::getGridDimensions() const {
-    return isUniformGrid() ? gridDims_ : size3_t(0u);
+    return isUniformGrid() ? core_->gridDims : size3_t(0u);
 }
 
-vec3 TriangulationData::getGridOrigin() const { return isUniformGrid() ? gridOrigin_ : vec3(0.0f); }
+vec3 TriangulationData::getGridOrigin() const {
+    return isUniformGrid() ? core_->gridOrigin : vec3(0.0f);
+}
 
-vec3 TriangulationData::getGridExtent() const { return isUniformGrid() ? gridExtent_ : vec3(0.0f); }
+vec3 TriangulationData::getGridExtent() const {
+    return isUniformGrid() ? core_->gridExtent : vec3(0.0f);
+}
 
 void TriangulationData::set(const size3_t& dims, const vec3& origin, const vec3& extent,
                             const DataMapper& dataMapper) {
-    points_.clear();
-    cells_.clear();
-    const vec3 spacing(extent / vec3(dims));
-    triangulation_.setInputGrid(origin.x, origin.y, origin.z, spacing.x, spacing.y, spacing.z,
-                                static_cast<int>(dims.x), static_cast<int>(dims.y),
-                                static_cast<int>(dims.z));
-    gridDims_ = dims;
-    gridOrigin_ = origin;
-    gridExtent_ = extent;
-    volumeDataMapper_ = dataMapper;
+    const auto start = std::chrono::steady_clock::now();
+    core_ = std::make_shared<Core>();
+    core_->gridDims = dims;
+    core_->gridOrigin = origin;
+    core_->gridExtent = extent;
+    core_->volumeDataMapper = dataMapper;
+    core_->setGrid();
+    core_->setupTime = std::chrono::steady_clock::now() - start;
 }
 
 void TriangulationData::set(const std::vector<vec3>& points, const std::vector<uint32_t>& indices,
@@ -187,14 +222,13 @@ void TriangulationData::set(const std::vector<vec3>& points, const std::vector<u
 
 void TriangulationData::set(std::vector<vec3>&& points, const std::vector<uint32_t>& indices,
                             InputTriangulation type) {
-    points_ = std::move(points);
-    cells_.clear();
+    core_ = std::make_shared<Core>();
+    core_->points = std::move(points);
 
     // init ttk::Triangulation
-    triangulation_.setInputPoints(static_cast<int>(points_.size()), points_.data(), false);
+    core_->triangulation.setInputPoints(static_cast<int>(core_->points.size()),
+                                        core_->points.data(), false);
     addIndices(indices, type);
-
-    unsetGrid();
 }
 
 void TriangulationData::set(const std::vector<vec3>& points, const std::vector<uint32_t>& indices,
@@ -207,17 +241,19 @@ void TriangulationData::set(std::vector<vec3>&& points, const std::vector<uint32
     switch (meshInfo.dt) {
         case DrawType::Lines: {
             if (meshInfo.ct == ConnectivityType::None) {
-                set(points, indices, InputTriangulation::Edges);
+                set(std::move(points), indices, InputTriangulation::Edges);
             } else {
-                set(points, convertToLines(indices, meshInfo), InputTriangulation::Edges);
+                set(std::move(points), convertToLines(indices, meshInfo),
+                    InputTriangulation::Edges);
             }
             break;
         }
         case DrawType::Triangles: {
             if (meshInfo.ct == ConnectivityType::None) {
-                set(points, indices, InputTriangulation::Triangles);
+                set(std::move(points), indices, InputTriangulation::Triangles);
             } else {
-                set(points, convertToTriangles(indices, meshInfo), InputTriangulation::Triangles);
+                set(std::move(points), convertToTriangles(indices, meshInfo),
+                    InputTriangulation::Triangles);
             }
             break;
         }
@@ -236,27 +272,23 @@ void TriangulationData::set(const std::vector<vec3>& points,
 }
 
 void TriangulationData::set(std::vector<vec3>&& points, std::vector<long long int>&& cells) {
-    points_ = std::move(points);
-    cells_ = std::move(cells);
-
-    // determine number of cells
-    int numCells = 0;
-    for (size_t i = 0; i < cells.size(); i += cells[i] + 1) {
-        ++numCells;
-    }
-
-    unsetGrid();
+    const auto start = std::chrono::steady_clock::now();
+    core_ = std::make_shared<Core>();
+    core_->points = std::move(points);
+    core_->cells = std::move(cells);
 
     // init ttk::Triangulation
-    int retVal =
-        triangulation_.setInputPoints(static_cast<int>(points_.size()), points_.data(), false);
+    int retVal = core_->triangulation.setInputPoints(static_cast<int>(core_->points.size()),
+                                                     core_->points.data(), false);
     if (retVal < 0) {
         throw TTKException("Error setting input points of ttk::Triangulation");
     }
-    retVal = triangulation_.setInputCells(numCells, cells_.data());
+    retVal = core_->triangulation.setInputCells(static_cast<int>(core_->getCellCount()),
+                                                core_->cells.data());
     if (retVal < 0) {
         throw TTKException("Error setting input cells of ttk::Triangulation");
     }
+    core_->setupTime = std::chrono::steady_clock::now() - start;
 }
 
 void TriangulationData::addIndices(const std::vector<uint32_t>& indices, InputTriangulation type) {
@@ -279,22 +311,26 @@ void TriangulationData::addIndices(const std::vector<uint32_t>& indices, InputTr
             break;
     }
 
-    const int newCellCount = numCells + static_cast<int>(getCellCount());
-    cells_.reserve(cells_.size() + numCells * (pointsPerCell + 1));
+    const auto start = std::chrono::steady_clock::now();
+    detach();
+    auto& cells = core_->cells;
+    const int newCellCount = numCells + static_cast<int>(core_->getCellCount());
+    cells.reserve(cells.size() + numCells * (pointsPerCell + 1));
     for (size_t i = 0; i < numCells * pointsPerCell; ++i) {
         if (i % pointsPerCell == 0) {
-            cells_.push_back(pointsPerCell);
+            cells.push_back(pointsPerCell);
         }
-        cells_.push_back(indices[i]);
+        cells.push_back(indices[i]);
     }
 
-    unsetGrid();
+    core_->unsetGrid();
 
     // update TTK triangulation
-    int retVal = triangulation_.setInputCells(newCellCount, cells_.data());
+    int retVal = core_->triangulation.setInputCells(newCellCount, cells.data());
     if (retVal < 0) {
         throw TTKException("Error setting input cells of ttk::Triangulation");
     }
+    core_->setupTime += std::chrono::steady_clock::now() - start;
 }
 
 void TriangulationData::addIndices(const std::vector<uint32_t>& indices, Mesh::MeshInfo meshInfo) {
@@ -324,64 +360,35 @@ void TriangulationData::addIndices(const std::vector<uint32_t>& indices, Mesh::M
     }
 }
 
-void TriangulationData::setScalarValues(std::shared_ptr<BufferBase> buffer) {
-    if (buffer->getDataFormat()->getComponents() > 1) {
-        throw TTKException("TriangulationData supports only scalar data");
-    }
+void TriangulationData::checkScalarCount(size_t count) const {
     if (isUniformGrid()) {
-        if (buffer->getSize() < glm::compMul(gridDims_)) {
-            throw TTKException("Too little data (" + std::to_string(buffer->getSize()) +
+        if (count < core_->getNumberOfVertices()) {
+            throw TTKException("Too little data (" + std::to_string(count) +
                                " values given, but implicit triangulation holds " +
-                               std::to_string(glm::compMul(gridDims_)) + " positions");
+                               std::to_string(core_->getNumberOfVertices()) + " positions");
         }
-    } else if (buffer->getSize() < points_.size()) {
-        throw TTKException("Too little data (" + std::to_string(buffer->getSize()) +
+    } else if (count < core_->points.size()) {
+        throw TTKException("Too little data (" + std::to_string(count) +
                            " values given, but triangulation holds " +
-                           std::to_string(points_.size()) + " positions");
+                           std::to_string(core_->points.size()) + " positions");
     }
-    scalars_ = buffer;
 }
 
-void TriangulationData::setScalarValues(std::shared_ptr<BufferBase> buffer, size_t component) {
-    if (isUniformGrid()) {
-        if (buffer->getSize() < glm::compMul(gridDims_)) {
-            throw TTKException("Too little data (" + std::to_string(buffer->getSize()) +
-                               " values given, but implicit triangulation holds " +
-                               std::to_string(glm::compMul(gridDims_)) + " positions");
-        }
-    } else if (buffer->getSize() < points_.size()) {
-        throw TTKException("Too little data (" + std::to_string(buffer->getSize()) +
-                           " values given, but triangulation holds " +
-                           std::to_string(points_.size()) + " positions");
+void TriangulationData::setScalarValues(std::shared_ptr<BufferBase> buffer) {
+    if (buffer->getDataFormat()->getComponents() > 1) {
+        throw TTKException("TriangulationData supports only scalar data");
     }
+    checkScalarCount(buffer->getSize());
+    scalars_ = buffer;
+    resetCaches();
+}
 
-    auto convertBuffer = [](auto buffer, size_t component) {
-        using ValueType = util::PrecisionValueType<decltype(buffer)>;
-        using PrimitiveType = typename DataFormat<ValueType>::primitive;
-
-        std::vector<PrimitiveType> scalarData(buffer->getSize());
-        std::transform(buffer->getDataContainer().begin(), buffer->getDataContainer().end(),
-                       scalarData.begin(),
-                       [component](auto elem) { return util::glmcomp(elem, component); });
-        return util::makeBuffer<PrimitiveType>(std::move(scalarData));
-    };
-
-    scalars_ = buffer->getRepresentation<BufferRAM>()->dispatch<std::shared_ptr<BufferBase>>(
-        convertBuffer, component);
+void TriangulationData::setScalarValues(std::shared_ptr<BufferBase> buffer, size_t component) {
+    setScalarValues(*buffer, component);
 }
 
 void TriangulationData::setScalarValues(const BufferBase& buffer, size_t component) {
-    if (isUniformGrid()) {
-        if (buffer.getSize() < glm::compMul(gridDims_)) {
-            throw TTKException("Too little data (" + std::to_string(buffer.getSize()) +
-                               " values given, but implicit triangulation holds " +
-                               std::to_string(glm::compMul(gridDims_)) + " positions");
-        }
-    } else if (buffer.getSize() < points_.size()) {
-        throw TTKException("Too little data (" + std::to_string(buffer.getSize()) +
-                           " values given, but triangulation holds " +
-                           std::to_string(points_.size()) + " positions");
-    }
+    checkScalarCount(buffer.getSize());
 
     auto convertBuffer = [](auto bufferpr, size_t component) {
         using ValueType = util::PrecisionValueType<decltype(bufferpr)>;
@@ -396,65 +403,128 @@ void TriangulationData::setScalarValues(const BufferBase& buffer, size_t compone
 
     scalars_ = buffer.getRepresentation<BufferRAM>()->dispatch<std::shared_ptr<BufferBase>>(
         convertBuffer, component);
+    resetCaches();
 }
 
 std::shared_ptr<BufferBase> TriangulationData::getScalarValues() const { return scalars_; }
 
-void TriangulationData::setOffsets(const std::vector<int>& offsets) {
-    setOffsets(std::vector<int>(offsets));
+void TriangulationData::setOffsets(const std::vector<IdType>& offsets) {
+    setOffsets(std::vector<IdType>(offsets));
 }
 
-void TriangulationData::setOffsets(std::vector<int>&& offsets) {
-    const auto numelems = isUniformGrid() ? glm::compMul(gridDims_) : points_.size();
+void TriangulationData::setOffsets(std::vector<IdType>&& offsets) {
+    const auto numelems = core_->getNumberOfVertices();
     if (offsets.size() != numelems) {
         throw TTKException("Mismatch in range (" + std::to_string(offsets.size()) + " offsets, " +
                            std::to_string(numelems) + " vertices)");
     }
-    offsets_ = std::move(offsets);
+    offsets_ = std::make_shared<std::vector<IdType>>(std::move(offsets));
+    resetCaches();
 }
 
-std::vector<int>& TriangulationData::getOffsets() {
-    const auto numelems = isUniformGrid() ? glm::compMul(gridDims_) : points_.size();
-    if (offsets_.size() != numelems) {
-        offsets_.resize(numelems);
-        std::iota(offsets_.begin(), offsets_.end(), 0);
+std::vector<TriangulationData::IdType>& TriangulationData::editOffsets() {
+    if (!offsets_ || offsets_->size() != core_->getNumberOfVertices()) {
+        offsets_ = std::make_shared<std::vector<IdType>>(core_->getIdentityOffsets());
+    } else if (offsets_.use_count() > 1) {
+        // copy on write, other TriangulationData might refer to the same offsets
+        offsets_ = std::make_shared<std::vector<IdType>>(*offsets_);
     }
-    return offsets_;
+    // the offsets might be modified through the returned reference
+    resetCaches();
+    return *offsets_;
 }
 
-const std::vector<int>& TriangulationData::getOffsets() const {
-    const auto numelems = isUniformGrid() ? glm::compMul(gridDims_) : points_.size();
-    if (offsets_.size() != numelems) {
-        offsets_.resize(numelems);
-        std::iota(offsets_.begin(), offsets_.end(), 0);
+const std::vector<TriangulationData::IdType>& TriangulationData::getOffsets() const {
+    if (!offsets_ || offsets_->size() != core_->getNumberOfVertices()) {
+        return core_->getIdentityOffsets();
     }
-    return offsets_;
+    return *offsets_;
+}
+
+std::shared_ptr<const PersistenceHierarchy> TriangulationData::getPersistenceHierarchy(
+    bool computeSaddleConnectors) const {
+    auto cache = persistence_;
+    const auto i = computeSaddleConnectors ? 1 : 0;
+    std::call_once(cache->computed[i], [&]() {
+        cache->hierarchy[i] =
+            std::make_shared<const PersistenceHierarchy>(*this, computeSaddleConnectors);
+    });
+    return cache->hierarchy[i];
+}
+
+void TriangulationData::resetCaches() {
+    persistence_ = std::make_shared<Persistence>();
 }
 
-const std::vector<long long int>& TriangulationData::getCells() const { return cells_; }
+std::mutex& TriangulationData::getTriangulationMutex() const { return core_->mutex; }
+
+ttk::Triangulation* TriangulationData::getSharedTriangulation() const {
+    return &core_->triangulation;
+}
+
+const std::vector<long long int>& TriangulationData::getCells() const { return core_->cells; }
 
 const std::vector<vec3>& TriangulationData::getPoints() const {
-    if (isUniformGrid() && points_.empty()) {
-        for (int index = 0; index < triangulation_.getNumberOfVertices(); index++) {
-            points_.push_back(getPoint(index));
+    std::scoped_lock lock{core_->mutex};
+    if (isUniformGrid() && core_->points.empty()) {
+        const auto numVertices = core_->triangulation.getNumberOfVertices();
+        std::vector<vec3> points;
+        points.reserve(numVertices);
+        for (int index = 0; index < numVertices; index++) {
+            points.push_back(getPoint(index));
         }
+        core_->points = std::move(points);
     }
-    return points_;
+    return core_->points;
 }
 
 vec3 TriangulationData::getPoint(const int index) const {
     vec3 point;
-    triangulation_.getVertexPoint(index, point.x, point.y, point.z);
+    core_->triangulation.getVertexPoint(index, point.x, point.y, point.z);
     return point;
 }
 
-ttk::Triangulation& TriangulationData::getTriangulation() { return triangulation_; }
+ttk::Triangulation& TriangulationData::getTriangulation() {
+    detach();
+    return core_->triangulation;
+}
+
+const ttk::Triangulation& TriangulationData::getTriangulation() const {
+    return core_->triangulation;
+}
+
+vec3& TriangulationData::operator[](size_t i) {
+    detach();
+    return core_->points[i];
+}
 
-const ttk::Triangulation& TriangulationData::getTriangulation() const { return triangulation_; }
+const vec3& TriangulationData::operator[](size_t i) const { return core_->points[i]; }
 
-vec3& TriangulationData::operator[](size_t i) { return points_[i]; }
+TriangulationData::MemoryReport TriangulationData::getMemoryReport() const {
+    MemoryReport report;
+    report.geometryBytes = core_->points.size() * sizeof(vec3) +
+                           core_->cells.size() * sizeof(long long int);
+    report.geometryUsers = core_.use_count();
+    report.setupTime = core_->setupTime;
+    if (scalars_) {
+        report.scalarBytes = scalars_->getSize() * scalars_->getDataFormat()->getSizeInBytes();
+        report.scalarUsers = scalars_.use_count();
+    }
+    if (offsets_) {
+        report.offsetBytes = offsets_->size() * sizeof(IdType);
+        report.offsetUsers = offsets_.use_count();
+    }
+    return report;
+}
 
-const vec3& TriangulationData::operator[](size_t i) const { return points_[i]; }
+void TriangulationData::detach() {
+    if (core_.use_count() > 1) {
+        // other copies might be preconditioning the shared triangulation at the same time
+        auto shared = core_;
+        std::scoped_lock lock{shared->mutex};
+        core_ = std::make_shared<Core>(*shared);
+    }
+}
 
 const SpatialCameraCoordinateTransformer& TriangulationData::getCoordinateTransformer(
     const Camera& camera) const {
@@ -568,21 +638,7 @@ std::vector<uint32_t> TriangulationData::convertToLines(const std::vector<uint32
     return ind;
 }
 
-size_t TriangulationData::getCellCount() const {
-    // determine number of cells based on VTK index list
-    size_t numCells = 0;
-    for (size_t i = 0; i < cells_.size(); i += cells_[i] + 1) {
-        ++numCells;
-    }
-    return numCells;
-}
-
-void TriangulationData::unsetGrid() {
-    // unset grid information
-    gridDims_ = size3_t(0u);
-    gridOrigin_ = vec3(0.0f);
-    gridExtent_ = vec3(0.0f);
-}
+size_t TriangulationData::getCellCount() const { return core_->getCellCount(); }
 
 }  // namespace topology
 
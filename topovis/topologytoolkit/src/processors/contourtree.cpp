@@ -99,15 +99,14 @@ void ContourTree::process() {
         using ValueType = util::PrecisionValueType<decltype(buffer)>;
         using PrimitiveType = typename DataFormat<ValueType>::primitive;
 
-        std::vector<int> offsets(inportData->getOffsets());
-
         auto tree = std::make_shared<topology::ContourTree>();
 
         tree->setThreadNumber(threadCount);
-        tree->setupTriangulation(const_cast<ttk::Triangulation*>(&inportData->getTriangulation()));
+        inportData->setupTriangulation(*tree);
         // tree->setDebugLevel(0);
         tree->setVertexScalars(buffer->getDataContainer().data());
-        tree->setVertexSoSoffsets(offsets.data());
+        // TTK only reads the offsets, the shared ones are passed without a copy
+        tree->setVertexSoSoffsets(const_cast<ttk::SimplexId*>(inportData->getOffsets().data()));
         tree->setTreeType(static_cast<int>(treeType));
         tree->setSegmentation(segmentation);
         tree->setNormalizeIds(normalization);
@@ -122,12 +121,29 @@ void ContourTree::process() {
     if (inport_.isChanged()) inportChanged_ = true;
     dirty_ |= (treeType_.isModified() || segmentation_.isModified() || normalization_.isModified());
 
+    if ((inportChanged_ || dirty_) && treeIsFinished_) {
+        // reuse a previously computed tree, e.g. when going back to an earlier simplification
+        // threshold, TopologicalSimplification then outputs the same triangulation again
+        auto it = std::find_if(trees_.begin(), trees_.end(), [&](const CachedTree& item) {
+            return item.tree->triangulation == inportData && item.tree->type == treeType &&
+                   item.segmentation == segmentation && item.normalization == normalization;
+        });
+        if (it != trees_.end()) {
+            std::rotate(trees_.begin(), it, std::next(it));
+            inportChanged_ = false;
+            dirty_ = false;
+            treeData_ = trees_.front().tree;
+            outport_.setData(treeData_);
+            return;
+        }
+    }
+
     if ((inportChanged_ || dirty_) && treeIsFinished_) {
         treeIsFinished_ = false;
         inportChanged_ = false;
         dirty_ = false;
 
-        dispatchPool([this, inportData, treeType, computeTree]() {
+        dispatchPool([this, inportData, treeType, segmentation, normalization, computeTree]() {
             auto treeData = std::make_shared<topology::ContourTreeData>();
             treeData->type = treeType;
             treeData->triangulation = inportData;
@@ -137,8 +153,10 @@ void ContourTree::process() {
                                  ->dispatch<std::shared_ptr<topology::ContourTree>,
                                             dispatching::filter::Scalars>(computeTree);
 
-            dispatchFront([this, treeData]() {
+            dispatchFront([this, treeData, segmentation, normalization]() {
                 treeData_ = treeData;
+                trees_.insert(trees_.begin(), CachedTree{segmentation, normalization, treeData});
+                if (trees_.size() > maxCachedTrees) trees_.pop_back();
                 invalidate(InvalidationLevel::InvalidOutput);
             });
 
@@ -64,12 +64,13 @@ MorseSmaleComplex::MorseSmaleComplex()
     , computeSaddleConnectors_{"computeSaddleConnectors", "Compute Saddle Connectors", false}
     , saddleConnectorsPersistenceThreshold_{"saddleConnectorsPersistenceThreshold_",
                                             "Saddle Connectors Persistence Threshold", 0.0f, 0.0f,
-                                            100.0f} {
+                                            100.0f}
+    , computeSegmentation_{"computeSegmentation", "Compute Segmentation", true} {
     addPort(inport_);
     addPort(outport_);
 
     addProperties(returnSaddleConnectors_, computeSaddleConnectors_,
-                  saddleConnectorsPersistenceThreshold_);
+                  saddleConnectorsPersistenceThreshold_, computeSegmentation_);
 }
 
 void MorseSmaleComplex::process() {
@@ -87,7 +88,8 @@ void MorseSmaleComplex::process() {
     } else {
         if (inport_.isChanged() || mscDirty_ || returnSaddleConnectors_.isModified() ||
             computeSaddleConnectors_.isModified() ||
-            saddleConnectorsPersistenceThreshold_.isModified()) {
+            saddleConnectorsPersistenceThreshold_.isModified() ||
+            computeSegmentation_.isModified()) {
             getActivityIndicator().setActive(true);
             updateOutport();
         }
@@ -108,9 +110,10 @@ void MorseSmaleComplex::updateOutport() {
     const auto rsc = *returnSaddleConnectors_;
     const auto csc = *computeSaddleConnectors_;
     const auto scpt = *saddleConnectorsPersistenceThreshold_;
+    const auto segmentation = *computeSegmentation_;
 
-    auto compute = [inportData, done, rsc, csc,
-                    scpt]() -> std::shared_ptr<const topology::MorseSmaleComplexData> {
+    auto compute = [inportData, done, rsc, csc, scpt,
+                    segmentation]() -> std::shared_ptr<const topology::MorseSmaleComplexData> {
         ScopedClockCPU clock{"MorseSmaleComplex", "Morse-Smale complex calculation",
                              std::chrono::milliseconds(500), LogLevel::Info};
         auto mscData =
@@ -118,20 +121,18 @@ void MorseSmaleComplex::updateOutport() {
                 ->getRepresentation<BufferRAM>()
                 ->dispatch<std::shared_ptr<topology::MorseSmaleComplexData>,
                            dispatching::filter::Scalars>(
-                    [inportData, rsc, csc, scpt](const auto buffer) {
+                    [inportData, rsc, csc, scpt, segmentation](const auto buffer) {
                         using ValueType = util::PrecisionValueType<decltype(buffer)>;
                         using PrimitiveType = typename DataFormat<ValueType>::primitive;
 
-                        std::vector<int> offsets(inportData->getOffsets());
-
                         ttk::MorseSmaleComplex morseSmaleComplex;
-                        morseSmaleComplex.setupTriangulation(
-                            const_cast<ttk::Triangulation*>(&inportData->getTriangulation()));
+                        inportData->setupTriangulation(morseSmaleComplex);
                         morseSmaleComplex.setInputScalarField(buffer->getDataContainer().data());
-                        morseSmaleComplex.setInputOffsets(offsets.data());
+                        morseSmaleComplex.setInputOffsets(
+                            const_cast<ttk::SimplexId*>(inportData->getOffsets().data()));
 
                         auto mscData = std::make_shared<topology::MorseSmaleComplexData>(
-                            morseSmaleComplex, inportData);
+                            morseSmaleComplex, inportData, segmentation);
 
                         morseSmaleComplex.setReturnSaddleConnectors(rsc);
                         morseSmaleComplex.setComputeSaddleConnectors(csc);
@@ -60,39 +60,38 @@ std::shared_ptr<Mesh> MSCToMesh(const topology::MorseSmaleComplexData& msc,
     const auto dimensionality = trig.getDimensionality();
     const auto ext = msc.triangulation->getGridExtent();
 
-    std::unordered_map<ttk::SimplexId, char> idToDims;
-
     // Add critical points with their color
     pickingExtrema.resize(numcp);
-    const auto& cpoints = msc.criticalPoints.points;
     std::vector<uint32_t> cpIndices;
     for (ttk::SimplexId i = 0; i < numcp; i++) {
         const auto cellDim = msc.criticalPoints.cellDimensions[i];
-        idToDims[msc.criticalPoints.cellIds[i]] = cellDim;
-
         if (!filterProp.showExtrema(dimensionality, cellDim)) continue;
 
-        positions.emplace_back(cpoints[i * 3 + 0], cpoints[i * 3 + 1], cpoints[i * 3 + 2]);
+        positions.emplace_back(msc.getCriticalPoint(i));
         colors.emplace_back(colorProp.getColor(dimensionality, cellDim));
         radius.emplace_back(sphereRadius);
         picking.emplace_back(pickingExtrema.getPickingId(i));
-        cpIndices.emplace_back(positions.size() - 1);
+        cpIndices.emplace_back(static_cast<uint32_t>(positions.size() - 1));
     }
 
     // Add the separatrixCells
-    pickingSeperatrix.resize(msc.separatrixCells.numberOfCells);
-    const auto& spoints = msc.separatrixPoints.points;
+    const auto numCells = msc.separatrixCells.numberOfCells;
+    pickingSeperatrix.resize(numCells);
     std::vector<uint32_t> sepIndices;
 
-    for (ttk::SimplexId i = 0; i < msc.separatrixCells.numberOfCells; ++i) {
+    positions.reserve(positions.size() + 2 * numCells);
+    colors.reserve(colors.size() + 2 * numCells);
+    radius.reserve(radius.size() + 2 * numCells);
+    picking.reserve(picking.size() + 2 * numCells);
+    sepIndices.reserve(2 * numCells);
+
+    for (ttk::SimplexId i = 0; i < numCells; ++i) {
         if (!filterProp.showSeperatrix(dimensionality, msc.separatrixCells.types[i])) continue;
 
         const auto src = msc.separatrixCells.cells[3 * i + 1];
         const auto dst = msc.separatrixCells.cells[3 * i + 2];
 
-        std::array<vec3, 2> points{
-            {{spoints[3 * src + 0], spoints[3 * src + 1], spoints[3 * src + 2]},
-             {spoints[3 * dst + 0], spoints[3 * dst + 1], spoints[3 * dst + 2]}}};
+        std::array<vec3, 2> points{{msc.getSeparatrixPoint(src), msc.getSeparatrixPoint(dst)}};
 
         if constexpr (PBC) {
             points[0] += vec3{glm::lessThan(points[0] - points[1], -0.5f * ext)} * ext;
@@ -104,7 +103,7 @@ std::shared_ptr<Mesh> MSCToMesh(const topology::MorseSmaleComplexData& msc,
             colors.emplace_back(*colorProp.arc_);
             radius.emplace_back(lineThickness);
             picking.emplace_back(pickingSeperatrix.getPickingId(i));
-            sepIndices.emplace_back(positions.size() - 1);
+            sepIndices.emplace_back(static_cast<uint32_t>(positions.size() - 1));
         }
     }
 
@@ -219,11 +218,16 @@ void MorseSmaleComplexToMesh::handleSeperatrixPicking(PickingEvent* p) {
             const int srcCpCellId = msc->separatrixCells.sourceIds[i];
             const int dstCpCellId = msc->separatrixCells.destinationIds[i];
 
-            const auto cbegin = msc->criticalPoints.cellIds.begin();
-            const auto cend = msc->criticalPoints.cellIds.end();
+            // the critical points at the ends of the separatrix containing cell i
             const auto& cpdims = msc->criticalPoints.cellDimensions;
-            const auto srcIt = std::find(cbegin, cend, srcCpCellId);
-            const auto dstIt = std::find(cbegin, cend, dstCpCellId);
+            const auto& index = msc->getSeparatrixIndex();
+            const auto sep =
+                std::distance(index.offsets.begin(),
+                              std::upper_bound(index.offsets.begin(), index.offsets.end(),
+                                               static_cast<ttk::SimplexId>(i))) -
+                1;
+            const auto srcCp = index.source[sep];
+            const auto dstCp = index.destination[sep];
 
             Document doc;
             using P = Document::PathComponent;
@@ -240,10 +244,9 @@ void MorseSmaleComplexToMesh::handleSeperatrixPicking(PickingEvent* p) {
             tb(H("Id"), srcId, dstId);
             tb(H("Dim"), srcDim, dstDim);
             tb(H("CP Cell"), srcCpCellId, dstCpCellId);
-            tb(H("CP Id"), srcIt != cend ? std::distance(cbegin, srcIt) : -1,
-               dstIt != cend ? std::distance(cbegin, dstIt) : -1);
-            tb(H("CP Dim"), srcIt != cend ? int{cpdims[std::distance(cbegin, srcIt)]} : -1,
-               dstIt != cend ? int{cpdims[std::distance(cbegin, dstIt)]} : -1);
+            tb(H("CP Id"), srcCp, dstCp);
+            tb(H("CP Dim"), srcCp != -1 ? int{cpdims[srcCp]} : -1,
+               dstCp != -1 ? int{cpdims[dstCp]} : -1);
 
             tb(H("x"), msc->separatrixPoints.points[3 * srcInd + 0],
                msc->separatrixPoints.points[3 * dstInd + 0]);
@@ -67,18 +67,15 @@ void PersistenceCurve::process() {
                 using ValueType = util::PrecisionValueType<decltype(buffer)>;
                 using PrimitiveType = typename DataFormat<ValueType>::primitive;
 
-                std::vector<int> offsets(data->getOffsets());
-
                 // Computing the persistence curve
                 ttk::PersistenceCurve curve;
                 std::vector<std::pair<PrimitiveType, ttk::SimplexId>> outputCurve;
-                curve.setupTriangulation(
-                    const_cast<ttk::Triangulation*>(&data->getTriangulation()));
+                data->setupTriangulation(curve);
                 curve.setInputScalars(buffer->getDataContainer().data());
-                curve.setInputOffsets(offsets.data());
+                curve.setInputOffsets(const_cast<ttk::SimplexId*>(data->getOffsets().data()));
                 curve.setOutputCTPlot(&outputCurve);
 
-                int retVal = curve.execute<PrimitiveType, int>();
+                int retVal = curve.execute<PrimitiveType, ttk::SimplexId>();
                 if (retVal < 0) {
                     throw TTKException("Error computing ttk::PersistenceCurve");
                 }
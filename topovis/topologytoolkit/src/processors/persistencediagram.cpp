@@ -28,17 +28,14 @@
  *********************************************************************************/
 
 #include <inviwo/topologytoolkit/processors/persistencediagram.h>
+#include <inviwo/topologytoolkit/datastructures/persistencehierarchy.h>
 #include <inviwo/topologytoolkit/utils/ttkutils.h>
 #include <inviwo/core/datastructures/buffer/bufferram.h>
 #include <inviwo/core/util/zip.h>
 #include <inviwo/core/util/stdextensions.h>
 
-#include <warn/push>
-#include <warn/ignore/all>
-#include <ttk/core/base/persistenceDiagram/PersistenceDiagram.h>
-#include <warn/pop>
-
 #include <algorithm>
+#include <tuple>
 
 namespace inviwo {
 
@@ -57,86 +54,65 @@ PersistenceDiagram::PersistenceDiagram()
     , inport_("triangulation")
     , outport_("outport")
     , dataFrameOutport_("dataframe")
-    , computeSaddleConnectors_{"computeSaddleConnectors", "Compute Saddle Connectors", false} {
+    , computeSaddleConnectors_{"computeSaddleConnectors", "Compute Saddle Connectors", false}
+    , threshold_{"threshold", "Persistence Threshold", 0.0f, 0.0f, 1000.0f} {
 
     addPort(inport_);
     addPort(outport_);
     addPort(dataFrameOutport_);
-    addProperties(computeSaddleConnectors_);
+    addProperties(computeSaddleConnectors_, threshold_);
 }
 
 void PersistenceDiagram::process() {
-    // Compute persistence diagram
-
-    using Result =
-        std::pair<std::shared_ptr<topology::PersistenceDiagramData>, std::shared_ptr<DataFrame>>;
-
-    auto compute = [data = inport_.getData(), css = computeSaddleConnectors_.get()]() {
-        return data->getScalarValues()
-            ->getEditableRepresentation<BufferRAM>()
-            ->dispatch<Result, dispatching::filter::Scalars>([&](const auto buffer) -> Result {
-                using ValueType = util::PrecisionValueType<decltype(buffer)>;
-                using DiagramOutput =
-                    std::vector<std::tuple<ttk::SimplexId, ttk::CriticalType, ttk::SimplexId,
-                                           ttk::CriticalType, ValueType, ttk::SimplexId>>;
-
-                std::vector<int> offsets(buffer->getSize());
-                std::iota(offsets.begin(), offsets.end(), 0);
-
-                DiagramOutput output;
-                ttk::PersistenceDiagram diagram;
-                diagram.setComputeSaddleConnectors(css);
-                diagram.setupTriangulation(
-                    const_cast<ttk::Triangulation*>(&data->getTriangulation()));
-                diagram.setOutputCTDiagram(&output);
-                diagram.setInputScalars(buffer->getDataContainer().data());
-                diagram.setInputOffsets(offsets.data());
-
-                int retVal = diagram.execute<typename DataFormat<ValueType>::primitive, int>();
-                if (retVal != 0) {
-                    throw TTKException("Error computing ttk::PersistenceDiagram");
-                }
-
-                // convert result of ttk::PersistenceDiagram into a DataFrame
-                std::vector<ValueType> birth;
-                std::vector<ValueType> death;
-
-                const auto& scalars = buffer->getDataContainer();
-                birth.reserve(output.size());
-                death.reserve(output.size());
-                for (const auto& extremumPair : output) {
-                    birth.push_back(scalars[std::get<0>(extremumPair)]);
-                    death.push_back(scalars[std::get<2>(extremumPair)]);
-                }
-
-                auto dataFrame = std::make_shared<DataFrame>();
-                dataFrame->addColumnFromBuffer("Birth",
-                                               util::makeBuffer<ValueType>(std::move(birth)));
-                dataFrame->addColumnFromBuffer("Death",
-                                               util::makeBuffer<ValueType>(std::move(death)));
-                dataFrame->updateIndexBuffer();
-
-                // TODO: use proper data structure with a Buffer<ValueType> instead of conversion,
-                // needs to match type of scalar buffer!
-
-                // convert diagram output to topology::PersistenceDiagramData, i.e. float
-                auto diagramOutput = std::make_shared<topology::PersistenceDiagramData>();
-                diagramOutput->reserve(output.size());
-                for (auto& elem : output) {
-                    diagramOutput->emplace_back(std::make_tuple(
-                        std::get<0>(elem), std::get<1>(elem), std::get<2>(elem), std::get<3>(elem),
-                        static_cast<float>(std::get<4>(elem)), std::get<5>(elem)));
-                }
-
-                return std::make_pair(diagramOutput, dataFrame);
-            });
+    // The complete diagram is computed once per scalar field and cached in the triangulation, a
+    // new threshold only filters the cached pairs
+    using Result = std::tuple<float, std::shared_ptr<topology::PersistenceDiagramData>,
+                              std::shared_ptr<DataFrame>>;
+
+    auto compute = [data = inport_.getData(), css = computeSaddleConnectors_.get(),
+                    threshold = threshold_.get()]() -> Result {
+        const auto hierarchy = data->getPersistenceHierarchy(css);
+        auto diagram =
+            std::make_shared<topology::PersistenceDiagramData>(hierarchy->diagram(threshold));
+
+        // convert the pairs into a DataFrame with birth and death in the precision of the scalars
+        auto dataFrame =
+            data->getScalarValues()
+                ->getRepresentation<BufferRAM>()
+                ->dispatch<std::shared_ptr<DataFrame>, dispatching::filter::Scalars>(
+                    [&](const auto buffer) {
+                        using ValueType = util::PrecisionValueType<decltype(buffer)>;
+
+                        std::vector<ValueType> birth;
+                        std::vector<ValueType> death;
+
+                        const auto& scalars = buffer->getDataContainer();
+                        birth.reserve(diagram->size());
+                        death.reserve(diagram->size());
+                        for (const auto& extremumPair : *diagram) {
+                            birth.push_back(scalars[std::get<0>(extremumPair)]);
+                            death.push_back(scalars[std::get<2>(extremumPair)]);
+                        }
+
+                        auto df = std::make_shared<DataFrame>();
+                        df->addColumnFromBuffer("Birth",
+                                                util::makeBuffer<ValueType>(std::move(birth)));
+                        df->addColumnFromBuffer("Death",
+                                                util::makeBuffer<ValueType>(std::move(death)));
+                        df->updateIndexBuffer();
+                        return df;
+                    });
+
+        return {hierarchy->getMaxPersistence(), diagram, dataFrame};
     };
 
     outport_.setData(nullptr);
     dataFrameOutport_.setData(nullptr);
     dispatchOne(compute, [this](Result result) {
-        outport_.setData(result.first);
-        dataFrameOutport_.setData(result.second);
+        auto&& [maxPersistence, diagram, dataFrame] = result;
+        threshold_.setMaxValue(std::max(maxPersistence, threshold_.getMinValue()));
+        outport_.setData(diagram);
+        dataFrameOutport_.setData(dataFrame);
         newResults();
     });
 }
@@ -153,7 +153,6 @@ std::shared_ptr<Mesh> refine(const topology::MorseSmaleComplexData& msc,
     using Sys = SeparatrixSpringSystem<3, float, std::integer_sequence<bool, PBC, PBC, PBC>>;
 
     const auto& cp = msc.criticalPoints;
-    const auto& sp = msc.separatrixPoints;
     const auto& sc = msc.separatrixCells;
 
     const auto ncp = cp.numberOfPoints;
@@ -167,50 +166,31 @@ std::shared_ptr<Mesh> refine(const topology::MorseSmaleComplexData& msc,
     std::vector<topology::CellType> types;
     std::vector<typename Sys::SpringIndices> springs;
 
-    const auto id = [](const auto& item, auto i) {
-        return std::make_tuple(item.cellDimensions[i], item.cellIds[i]);
-    };
-
-    std::unordered_map<std::tuple<char, ttk::SimplexId>, size_t> cellIdToPosIndex;
+    // critical point i is node i of the spring system
+    positions.reserve(ncp);
+    types.reserve(ncp);
     for (ttk::SimplexId i = 0; i < ncp; i++) {
-        positions.emplace_back(cp.points[3 * i + 0], cp.points[3 * i + 1], cp.points[3 * i + 2]);
+        positions.emplace_back(msc.getCriticalPoint(i));
         types.push_back(topology::extremaDimToType(dimensionality, cp.cellDimensions[i]));
-        cellIdToPosIndex[id(cp, i)] = positions.size() - 1;
-    }
-
-    std::vector<std::pair<ttk::SimplexId, ttk::SimplexId>> seperatixBeginEnd;
-    for (ttk::SimplexId i = 1, begin = 0; i < nsc; ++i) {
-        if (sc.separatrixIds[i - 1] != sc.separatrixIds[i]) {
-            seperatixBeginEnd.emplace_back(begin, i);
-            begin = i;
-        }
     }
 
-    seperatixBeginEnd.emplace_back(seperatixBeginEnd.back().second, sc.separatrixIds.size());
-
-    for (auto& sep : seperatixBeginEnd) {
-        const auto src = sc.cells[3 * sep.first + 1];
-        const auto srcCPIndex = cellIdToPosIndex.find(id(sp, src));
-        IVW_ASSERT(srcCPIndex != cellIdToPosIndex.end(), "Should always find a CP index");
-
-        ttk::SimplexId srcPosIndex = srcCPIndex->second;
-
-        for (ttk::SimplexId i = sep.first; i < sep.second - 1; ++i) {
-            const auto dstInd = sc.cells[3 * i + 2];
-
-            positions.emplace_back(sp.points[3 * dstInd + 0], sp.points[3 * dstInd + 1],
-                                   sp.points[3 * dstInd + 2]);
-
+    const auto& index = msc.getSeparatrixIndex();
+    positions.reserve(ncp + nsc);
+    types.reserve(ncp + nsc);
+    springs.reserve(nsc);
+    for (size_t s = 0; s < index.size(); ++s) {
+        // separatrices with an end that is not a critical point (-1) cannot be attached by a
+        // spring and are skipped
+        if (index.source[s] == -1 || index.destination[s] == -1) continue;
+
+        size_t srcPosIndex = static_cast<size_t>(index.source[s]);
+        for (auto i = index.offsets[s]; i < index.offsets[s + 1] - 1; ++i) {
+            positions.emplace_back(msc.getSeparatrixPoint(sc.cells[3 * i + 2]));
             types.push_back(topology::seperatrixTypeToType(dimensionality, sc.types[i]));
             springs.emplace_back(srcPosIndex, positions.size() - 1);
             srcPosIndex = positions.size() - 1;
         }
-
-        const auto dst = sc.cells[3 * (sep.second - 1) + 2];
-        const auto dstCPIndex = cellIdToPosIndex.find(id(sp, dst));
-        IVW_ASSERT(dstCPIndex != cellIdToPosIndex.end(), "Should always find a CP index");
-
-        springs.emplace_back(srcPosIndex, dstCPIndex->second);
+        springs.emplace_back(srcPosIndex, static_cast<size_t>(index.destination[s]));
     }
 
     Sys sys{sampler,
@@ -28,6 +28,7 @@
  *********************************************************************************/
 
 #include <inviwo/topologytoolkit/processors/topologicalsimplification.h>
+#include <inviwo/topologytoolkit/datastructures/persistencehierarchy.h>
 #include <inviwo/topologytoolkit/utils/ttkutils.h>
 #include <inviwo/core/datastructures/buffer/bufferram.h>
 #include <inviwo/core/datastructures/buffer/buffer.h>
@@ -40,6 +41,8 @@
 #include <warn/pop>
 #include <inviwo/core/util/formats.h>
 
+#include <algorithm>
+
 namespace inviwo {
 
 // The Class Identifier has to be globally unique. Use a reverse DNS naming scheme
@@ -67,6 +70,7 @@ TopologicalSimplification::TopologicalSimplification()
     addProperty(threshold_);
     addProperty(invert_);
 
+    persistenceInport_.setOptional(true);
     persistenceInport_.onChange([this]() {
         if (persistenceInport_.hasData()) {
             // Adjust max value to highest persistence value
@@ -81,51 +85,92 @@ TopologicalSimplification::TopologicalSimplification()
     });
 }
 
+std::optional<size_t> TopologicalSimplification::keptPairs(float threshold) const {
+    if (persistenceInport_.hasData()) {
+        const auto& diagram = *persistenceInport_.getData();
+        return static_cast<size_t>(
+            std::count_if(diagram.begin(), diagram.end(),
+                          [&](const auto& pair) { return std::get<4>(pair) >= threshold; }));
+    } else if (hierarchy_) {
+        return hierarchy_->count(threshold);
+    }
+    return std::nullopt;
+}
+
 void TopologicalSimplification::process() {
+    if (inport_.isChanged() || persistenceInport_.isChanged()) {
+        simplified_.clear();
+        hierarchy_.reset();
+    }
+
+    const auto threshold = threshold_.get();
+    const auto invert = invert_.get();
+
+    // All thresholds keeping the same number of pairs give the same constraints and thus the same
+    // simplification, reuse it if it has been computed before
+    if (const auto count = keptPairs(threshold)) {
+        if (auto it = simplified_.find({*count, invert}); it != simplified_.end()) {
+            outport_.setData(it->second);
+            return;
+        }
+    }
+
     // Save input and properties needed to calculate ttk contour tree to local variables
     const auto inportData = inport_.getData();
     const auto persistenceDiagram = persistenceInport_.getData();
 
-    using Result = std::shared_ptr<topology::TriangulationData>;
-
-    auto compute = [inportData, persistenceDiagram, threshold = threshold_.get(),
-                    invert = invert_.get()](pool::Stop stop, pool::Progress progress) -> Result {
-        return inportData->getScalarValues()
-            ->getEditableRepresentation<BufferRAM>()
-            ->dispatch<std::shared_ptr<topology::TriangulationData>, dispatching::filter::Scalars>(
-                [inportData, &diagramData = *persistenceDiagram, threshold, invert, stop,
-                 progress](const auto buffer) -> Result {
-                    if (stop) return nullptr;
-                    using ValueType = util::PrecisionValueType<decltype(buffer)>;
+    struct Result {
+        std::shared_ptr<const topology::PersistenceHierarchy> hierarchy;
+        size_t count = 0;
+        std::shared_ptr<const topology::TriangulationData> data;
+    };
 
-                    progress(0.1f);
+    auto compute = [inportData, persistenceDiagram, threshold,
+                    invert](pool::Stop stop, pool::Progress progress) -> Result {
+        Result res;
+
+        // select most/least persistent critical point pairs
+        std::vector<ttk::SimplexId> authorizedCriticalPoints;
+        if (persistenceDiagram) {
+            for (const auto& pair : *persistenceDiagram) {
+                const auto persistence = std::get<4>(pair);
+                if (persistence >= threshold) ++res.count;
+                if ((persistence >= threshold) != invert) {
+                    authorizedCriticalPoints.push_back(std::get<0>(pair));
+                    authorizedCriticalPoints.push_back(std::get<2>(pair));
+                }
+            }
+        } else {
+            // without a diagram, use the cached persistence hierarchy of the scalar field
+            res.hierarchy = inportData->getPersistenceHierarchy();
+            res.count = res.hierarchy->count(threshold);
+            authorizedCriticalPoints = res.hierarchy->constraints(threshold, invert);
+        }
+        if (stop) return res;
 
-                    // select most/least persistent critical point pairs
-                    std::vector<int> authorizedCriticalPoints;
-                    for (int i = 0; i < (int)diagramData.size(); i++) {
-                        auto persistence = std::get<4>(diagramData[i]);
-                        if ((persistence >= threshold) != invert) {
-                            authorizedCriticalPoints.push_back(std::get<0>(diagramData[i]));
-                            authorizedCriticalPoints.push_back(std::get<2>(diagramData[i]));
-                        }
-                    }
-                    if (stop) return nullptr;
+        progress(0.2f);
 
-                    progress(0.2f);
+        res.data = inportData->getScalarValues()
+            ->getRepresentation<BufferRAM>()
+            ->dispatch<std::shared_ptr<const topology::TriangulationData>,
+                       dispatching::filter::Scalars>(
+                [&](const auto buffer) -> std::shared_ptr<const topology::TriangulationData> {
+                    using ValueType = util::PrecisionValueType<decltype(buffer)>;
 
                     // create a copy of the data values, nth component will be overwritten by
                     // simplification
                     auto simplifiedDataValues = buffer->getDataContainer();
 
-                    std::vector<int> offsets(inportData->getOffsets());
+                    const auto& inputOffsets = inportData->getOffsets();
+                    std::vector<ttk::SimplexId> offsets(inputOffsets);
                     if (!authorizedCriticalPoints.empty()) {
                         // perform topological simplification
                         ttk::TopologicalSimplification simplification;
-                        simplification.setupTriangulation(
-                            const_cast<ttk::Triangulation*>(&inportData->getTriangulation()));
+                        inportData->setupTriangulation(simplification);
                         simplification.setInputScalarFieldPointer(
-                            buffer->getDataContainer().data());
-                        simplification.setInputOffsetScalarFieldPointer(offsets.data());
+                            const_cast<ValueType*>(buffer->getDataContainer().data()));
+                        simplification.setInputOffsetScalarFieldPointer(
+                            const_cast<ttk::SimplexId*>(inputOffsets.data()));
                         simplification.setOutputScalarFieldPointer(simplifiedDataValues.data());
                         simplification.setOutputOffsetScalarFieldPointer(offsets.data());
                         simplification.setConstraintNumber(
@@ -133,8 +178,9 @@ void TopologicalSimplification::process() {
                         simplification.setVertexIdentifierScalarFieldPointer(
                             authorizedCriticalPoints.data());
 
-                        int retVal = simplification
-                                         .execute<typename DataFormat<ValueType>::primitive, int>();
+                        int retVal =
+                            simplification.execute<typename DataFormat<ValueType>::primitive,
+                                                   ttk::SimplexId>();
                         if (retVal < 0) {
                             throw TTKException("Error computing ttk::TopologicalSimplification",
                                                IVW_CONTEXT_CUSTOM("TopologicalSimplification"));
@@ -143,7 +189,8 @@ void TopologicalSimplification::process() {
 
                     progress(0.8f);
 
-                    // create a new triangulation based on the old one, but with new scalar values
+                    // create a new triangulation sharing the geometry and connectivity of the old
+                    // one, only the scalar values and offsets are replaced
                     auto result = std::make_shared<topology::TriangulationData>(*inportData);
                     result->setScalarValues(util::makeBuffer(std::move(simplifiedDataValues)));
                     result->setOffsets(std::move(offsets));
@@ -152,11 +199,30 @@ void TopologicalSimplification::process() {
 
                     return result;
                 });
+        return res;
     };
 
     outport_.clear();
-    dispatchOne(compute, [this](Result result) {
-        outport_.setData(result);
+    dispatchOne(compute, [this, invert](Result result) {
+        if (result.hierarchy && !hierarchy_) {
+            hierarchy_ = result.hierarchy;
+            threshold_.setMaxValue(hierarchy_->getMaxPersistence());
+        }
+        if (result.data) {
+            if (simplified_.size() >= maxCachedResults) {
+                // evict the result whose threshold is farthest from the current one
+                auto farthest = std::max_element(
+                    simplified_.begin(), simplified_.end(), [&](const auto& a, const auto& b) {
+                        const auto distance = [&](size_t c) {
+                            return c > result.count ? c - result.count : result.count - c;
+                        };
+                        return distance(a.first.first) < distance(b.first.first);
+                    });
+                simplified_.erase(farthest);
+            }
+            simplified_[{result.count, invert}] = result.data;
+        }
+        outport_.setData(result.data);
         newResults();
     });
 }
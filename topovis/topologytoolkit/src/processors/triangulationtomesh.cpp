@@ -32,6 +32,8 @@
 #include <inviwo/core/util/exception.h>
 #include <inviwo/core/datastructures/buffer/bufferram.h>
 
+#include <algorithm>
+
 namespace inviwo {
 
 // The Class Identifier has to be globally unique. Use a reverse DNS naming scheme
@@ -54,7 +56,13 @@ TriangulationToMesh::TriangulationToMesh()
                  {{"componentX", "x component", 0},
                   {"componentY", "y component", 1},
                   {"componentZ", "z component", 2}},
-                 0) {
+                 0)
+    , faces_("faces", "Tetrahedra Faces",
+             {{"all", "All Faces", topology::TetraFaces::All},
+              {"boundary", "Boundary Faces", topology::TetraFaces::Boundary}},
+             0)
+    , includeIsoRange_("includeIsoRange", "Include Isovalue Range", false)
+    , isoRange_("isoRange", "Isovalue Range", 0.0, 1.0, 0.0, 1.0) {
 
     addPort(inport_);
     addPort(outport_);
@@ -64,6 +72,13 @@ TriangulationToMesh::TriangulationToMesh()
     addProperty(color_);
     addProperty(mapScalars_);
     addProperty(component_);
+    addProperties(faces_, includeIsoRange_, isoRange_);
+
+    includeIsoRange_.visibilityDependsOn(
+        faces_, [](const auto& p) { return p.get() == topology::TetraFaces::Boundary; });
+    isoRange_.visibilityDependsOn(includeIsoRange_, [this](const auto& p) {
+        return p.get() && faces_.get() == topology::TetraFaces::Boundary;
+    });
 
     // scalar mapping is only available if input triangulation features scalars
     mapScalars_.setReadOnly(true);
@@ -71,20 +86,39 @@ TriangulationToMesh::TriangulationToMesh()
 
     inport_.onChange([this]() {
         if (inport_.hasData()) {
-            const bool readonly = !inport_.getData()->getScalarValues();
+            const auto scalars = inport_.getData()->getScalarValues();
+            const bool readonly = !scalars;
             mapScalars_.setReadOnly(readonly);
             component_.setReadOnly(readonly);
+            includeIsoRange_.setReadOnly(readonly);
+            if (scalars) {
+                const auto range =
+                    scalars->getRepresentation<BufferRAM>()
+                        ->dispatch<dvec2, dispatching::filter::Scalars>([](auto bufferpr) {
+                            const auto& data = bufferpr->getDataContainer();
+                            if (data.empty()) return dvec2{0.0, 1.0};
+                            const auto [min, max] = std::minmax_element(data.begin(), data.end());
+                            return dvec2{static_cast<double>(*min), static_cast<double>(*max)};
+                        });
+                isoRange_.setRangeMin(range.x);
+                isoRange_.setRangeMax(range.y);
+            }
         } else {
             mapScalars_.setReadOnly(true);
             component_.setReadOnly(true);
+            includeIsoRange_.setReadOnly(true);
         }
     });
 }
 
 void TriangulationToMesh::process() {
     // set output mesh
+    std::optional<dvec2> isoRange;
+    if (includeIsoRange_ && !includeIsoRange_.getReadOnly()) isoRange = isoRange_.get();
+
     auto mesh = topology::ttkTriangulationToMesh(*inport_.getData().get(), color_.get(),
-                                                 mapScalars_.get(), component_.get());
+                                                 mapScalars_.get(), component_.get(),
+                                                 faces_.get(), isoRange);
 
     outport_.setData(mesh);
 }
@@ -37,9 +37,13 @@
 #include <inviwo/core/datastructures/volume/volumeramprecision.h>
 #include <inviwo/core/util/glm.h>
 
-#include <algorithm>
 #include <inviwo/core/util/formats.h>
 
+#include <algorithm>
+#include <array>
+#include <execution>
+#include <numeric>
+
 namespace inviwo {
 
 namespace topology {
@@ -103,8 +107,68 @@ TriangulationData meshToTTKTriangulation(const Mesh& mesh) {
     return data;
 }
 
+namespace {
+
+/**
+ * Extract the boundary faces of all tetrahedra in \p cells, i.e. faces which are not shared by two
+ * tetrahedra. Interior faces are kept if \p keepInterior returns true for them.
+ */
+template <typename KeepInterior>
+std::vector<uint32_t> tetraBoundaryFaces(const std::vector<long long int>& cells,
+                                         KeepInterior keepInterior) {
+    struct Face {
+        std::array<uint32_t, 3> key;  // sorted vertex ids
+        std::array<uint32_t, 3> tri;  // vertex ids in original winding
+    };
+
+    std::vector<size_t> tetras;
+    for (size_t i = 0; i < cells.size(); i += cells[i] + 1) {
+        if (cells[i] == 4) tetras.push_back(i + 1);
+    }
+
+    // parallel algorithms might operate on copies of the elements, iterate over indices instead
+    std::vector<size_t> tetraIndices(tetras.size());
+    std::iota(tetraIndices.begin(), tetraIndices.end(), size_t{0});
+
+    std::vector<Face> faces(tetras.size() * 4);
+    const auto addFaces = [&](size_t i) {
+        const auto* v = &cells[tetras[i]];
+        const auto face = [&](long long a, long long b, long long c) {
+            std::array<uint32_t, 3> tri{static_cast<uint32_t>(a), static_cast<uint32_t>(b),
+                                        static_cast<uint32_t>(c)};
+            auto key = tri;
+            std::sort(key.begin(), key.end());
+            return Face{key, tri};
+        };
+        auto* dst = &faces[4 * i];
+        // same winding as for TetraFaces::All
+        dst[0] = face(v[0], v[1], v[2]);
+        dst[1] = face(v[0], v[2], v[3]);
+        dst[2] = face(v[1], v[0], v[3]);
+        dst[3] = face(v[1], v[3], v[2]);
+    };
+    std::for_each(std::execution::par_unseq, tetraIndices.begin(), tetraIndices.end(), addFaces);
+
+    std::sort(std::execution::par_unseq, faces.begin(), faces.end(),
+              [](const Face& a, const Face& b) { return a.key < b.key; });
+
+    std::vector<uint32_t> indices;
+    for (size_t i = 0; i < faces.size();) {
+        size_t j = i + 1;
+        while (j < faces.size() && faces[j].key == faces[i].key) ++j;
+        if (j - i == 1 || keepInterior(faces[i].key)) {
+            indices.insert(indices.end(), faces[i].tri.begin(), faces[i].tri.end());
+        }
+        i = j;
+    }
+    return indices;
+}
+
+}  // namespace
+
 std::shared_ptr<Mesh> ttkTriangulationToMesh(const TriangulationData& data, const vec4& color,
-                                             bool applyScalars, size_t component) {
+                                             bool applyScalars, size_t component,
+                                             TetraFaces faces, std::optional<dvec2> isoRange) {
     auto mesh = std::make_shared<Mesh>();
 
     if (data.getPoints().empty()) {
@@ -162,6 +226,7 @@ std::shared_ptr<Mesh> ttkTriangulationToMesh(const TriangulationData& data, cons
                 triangle(cells[i + 1], cells[i + 2], cells[i + 3]);
                 break;
             case 4:  // tetrahedron
+                if (faces == TetraFaces::Boundary) break;  // extracted below
                 triangle(cells[i + 1], cells[i + 2], cells[i + 3]);
                 triangle(cells[i + 1], cells[i + 3], cells[i + 4]);
                 triangle(cells[i + 2], cells[i + 1], cells[i + 4]);
@@ -176,6 +241,33 @@ std::shared_ptr<Mesh> ttkTriangulationToMesh(const TriangulationData& data, cons
                       "Triangulation contains " + std::to_string(invalid) + " invalid cells.");
     }
 
+    if (faces == TetraFaces::Boundary) {
+        std::vector<uint32_t> boundary;
+        if (isoRange && data.getScalarValues()) {
+            boundary = data.getScalarValues()
+                           ->getRepresentation<BufferRAM>()
+                           ->dispatch<std::vector<uint32_t>, dispatching::filter::Scalars>(
+                               [&](auto bufferpr) {
+                                   const auto& scalars = bufferpr->getDataContainer();
+                                   return tetraBoundaryFaces(cells, [&](const auto& key) {
+                                       // key is sorted by vertex id, not by scalar value
+                                       const auto [min, max] = std::minmax(
+                                           {static_cast<double>(scalars[key[0]]),
+                                            static_cast<double>(scalars[key[1]]),
+                                            static_cast<double>(scalars[key[2]])});
+                                       return max >= isoRange->x && min <= isoRange->y;
+                                   });
+                               });
+        } else {
+            boundary = tetraBoundaryFaces(cells, [](const auto&) { return false; });
+        }
+        if (indicesTriangles.empty()) {
+            indicesTriangles = std::move(boundary);
+        } else {
+            indicesTriangles.insert(indicesTriangles.end(), boundary.begin(), boundary.end());
+        }
+    }
+
     if (!indicesLines.empty()) {
         mesh->addIndices(Mesh::MeshInfo(DrawType::Lines, ConnectivityType::None),
                          util::makeIndexBuffer(std::move(indicesLines)));
@@ -250,6 +250,7 @@ struct VTKTraits<ttkArrayEditor> {
                Wrapper8, Wrapper9, Wrapper10, Wrapper11, Wrapper12>
         properties;
     ttk::OutportDataTypeFunc outportDataTypeFunc = ttk::getOutportDataType;
+    ttk::ExecutionScopeFunc executionScopeFunc = ttk::threadBudgetScope;
     static constexpr std::string_view doc =
         R"ivw(This filter adds data arrays to a 'vtkDataObject' (called target) based on a string or point/cell/field data of an optional second 'vtkDataObject' (called source). This filter can also be used to directly edit an array (including renaming, type conversion, and reindexing).
 
@@ -122,6 +122,7 @@ struct VTKTraits<ttkBarycentricSubdivision> {
         Group{"Input options", {"SubdivisionLevel"}}};
     std::tuple<Wrapper0, Wrapper1, Wrapper2, Wrapper3, Wrapper4, Wrapper5> properties;
     ttk::OutportDataTypeFunc outportDataTypeFunc = ttk::getOutportDataType;
+    ttk::ExecutionScopeFunc executionScopeFunc = ttk::threadBudgetScope;
     static constexpr std::string_view doc =
         R"ivw(BarycentricSubdivision generates a new, finer triangulation
 from an input triangulation. Every triangle is divided in six
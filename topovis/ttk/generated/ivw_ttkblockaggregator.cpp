@@ -129,6 +129,7 @@ struct VTKTraits<ttkBlockAggregator> {
                "CompactTriangulationCacheSize", "Debug_Execute"}}};
     std::tuple<Wrapper0, Wrapper1, Wrapper2, Wrapper3, Wrapper4, Wrapper5, Wrapper6> properties;
     ttk::OutportDataTypeFunc outportDataTypeFunc = ttk::getOutportDataType;
+    ttk::ExecutionScopeFunc executionScopeFunc = ttk::threadBudgetScope;
     static constexpr std::string_view doc =
         R"ivw(This filter appends every input vtkDataObject as a block to an output vtkMultiBlockDataSet.
 
@@ -240,6 +240,7 @@ struct VTKTraits<ttkCinemaImaging> {
                Wrapper8, Wrapper9, Wrapper10, Wrapper11, Wrapper12, Wrapper13, Wrapper14>
         properties;
     ttk::OutportDataTypeFunc outportDataTypeFunc = ttk::getOutportDataType;
+    ttk::ExecutionScopeFunc executionScopeFunc = ttk::threadBudgetScope;
     static constexpr std::string_view doc =
         R"ivw(This filter takes images of a vtkDataObject (first input) from angles specified on a vtkPointSet (second input). Each image will be a block of a vtkMultiBlockDataSet where block order corresponds to point order. Each sample point can optionally have vtkDoubleArrays to override the default rendering parameters, i.e, the resolution, camera direction, clipping planes, and viewport height.
 
@@ -131,6 +131,7 @@ struct VTKTraits<ttkCinemaProductReader> {
                "CompactTriangulationCacheSize", "Debug_Execute"}}};
     std::tuple<Wrapper0, Wrapper1, Wrapper2, Wrapper3, Wrapper4, Wrapper5, Wrapper6> properties;
     ttk::OutportDataTypeFunc outportDataTypeFunc = ttk::getOutportDataType;
+    ttk::ExecutionScopeFunc executionScopeFunc = ttk::threadBudgetScope;
     static constexpr std::string_view doc =
         R"ivw(This filter reads the products that are referenced in a vtkTable. The results are stored in a vtkMultiBlockDataSet where each block corresponds to a row of the table with consistent ordering.
 
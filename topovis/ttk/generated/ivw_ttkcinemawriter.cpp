@@ -189,6 +189,7 @@ struct VTKTraits<ttkCinemaWriter> {
                Wrapper8, Wrapper9, Wrapper10>
         properties;
     ttk::OutportDataTypeFunc outportDataTypeFunc = ttk::getOutportDataType;
+    ttk::ExecutionScopeFunc executionScopeFunc = ttk::threadBudgetScope;
     static constexpr std::string_view doc =
         R"ivw(This filter stores a data product in a Cinema database, and then returns the unmodified input as output.
 
@@ -219,6 +219,7 @@ struct VTKTraits<ttkContinuousScatterPlot> {
                Wrapper8, Wrapper9, Wrapper10>
         properties;
     ttk::OutportDataTypeFunc outportDataTypeFunc = ttk::getOutportDataType;
+    ttk::ExecutionScopeFunc executionScopeFunc = ttk::threadBudgetScope;
     static constexpr std::string_view doc =
         R"ivw(This plugin produces a 2D vtkUnstructuredGrid with a scalar
 field (named 'Density') representing the continuous scatter plot (attached
@@ -197,6 +197,7 @@ arrays: downNodeId: int, upNodeId: int.)"}};
                Wrapper8>
         properties;
     ttk::OutportDataTypeFunc outportDataTypeFunc = ttk::getOutportDataType;
+    ttk::ExecutionScopeFunc executionScopeFunc = ttk::threadBudgetScope;
     static constexpr std::string_view doc = R"ivw(TTK contourAroundPoint plugin.)ivw";
 };
 
@@ -709,6 +709,7 @@ struct VTKTraits<ttkDimensionReduction> {
                Wrapper51, Wrapper52, Wrapper53, Wrapper54, Wrapper55, Wrapper56>
         properties;
     ttk::OutportDataTypeFunc outportDataTypeFunc = ttk::getOutportDataType;
+    ttk::ExecutionScopeFunc executionScopeFunc = ttk::threadBudgetScope;
     static constexpr std::string_view doc =
         R"ivw(TTK filter for generic dimension reduction methods.
 This filter supports various methods via the scikit-learn third party dependency (spectral embedding, local linear embedding, multi-dimensional scaling, t-SNE, isomap, PCA) as well as TopoMap (IEEE VIS 2020)
@@ -201,6 +201,7 @@ struct VTKTraits<ttkDimensionReductionMetrics> {
                Wrapper8, Wrapper9, Wrapper10, Wrapper11>
         properties;
     ttk::OutportDataTypeFunc outportDataTypeFunc = ttk::getOutportDataType;
+    ttk::ExecutionScopeFunc executionScopeFunc = ttk::threadBudgetScope;
     static constexpr std::string_view doc = R"ivw()ivw";
 };
 
@@ -194,6 +194,7 @@ If it's not the case, you can use the filter "Connectivity" (and select "Extract
                Wrapper8>
         properties;
     ttk::OutportDataTypeFunc outportDataTypeFunc = ttk::getOutportDataType;
+    ttk::ExecutionScopeFunc executionScopeFunc = ttk::threadBudgetScope;
     static constexpr std::string_view doc = R"ivw(TTK discreteGradient plugin documentation.)ivw";
 };
 
@@ -177,6 +177,7 @@ struct VTKTraits<ttkDistanceField> {
                Wrapper8>
         properties;
     ttk::OutportDataTypeFunc outportDataTypeFunc = ttk::getOutportDataType;
+    ttk::ExecutionScopeFunc executionScopeFunc = ttk::threadBudgetScope;
     static constexpr std::string_view doc =
         R"ivw(This plugin takes a list of sources (a set of points with their global
 identifiers attached to them) and produces a distance field to the closest
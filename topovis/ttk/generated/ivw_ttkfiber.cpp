@@ -193,6 +193,7 @@ struct VTKTraits<ttkFiber> {
                Wrapper8>
         properties;
     ttk::OutportDataTypeFunc outportDataTypeFunc = ttk::getOutportDataType;
+    ttk::ExecutionScopeFunc executionScopeFunc = ttk::threadBudgetScope;
     static constexpr std::string_view doc =
         R"ivw(Given a point in the range, this plugin computes its fiber (i.e.
 pre-image) on bivariate volumetric data. The bivariate input data must be
@@ -323,6 +323,7 @@ struct VTKTraits<ttkFiberSurface> {
                Wrapper16>
         properties;
     ttk::OutportDataTypeFunc outportDataTypeFunc = ttk::getOutportDataType;
+    ttk::ExecutionScopeFunc executionScopeFunc = ttk::threadBudgetScope;
     static constexpr std::string_view doc =
         R"ivw(Fiber surfaces are defined as the pre-images of curves drawn in the
 range of bivariate volumetric functions, typically on top of the continuous
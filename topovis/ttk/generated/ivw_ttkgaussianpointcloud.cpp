@@ -145,6 +145,7 @@ struct VTKTraits<ttkGaussianPointCloud> {
     std::tuple<Wrapper0, Wrapper1, Wrapper2, Wrapper3, Wrapper4, Wrapper5, Wrapper6, Wrapper7>
         properties;
     ttk::OutportDataTypeFunc outportDataTypeFunc = ttk::getOutportDataType;
+    ttk::ExecutionScopeFunc executionScopeFunc = ttk::threadBudgetScope;
     static constexpr std::string_view doc =
         R"ivw(This module generates a 1D, 2D or 3D point cloud by randomly
 casting samples from a Gaussian distribution.)ivw";
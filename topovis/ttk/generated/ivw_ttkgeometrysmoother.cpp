@@ -176,6 +176,7 @@ struct VTKTraits<ttkGeometrySmoother> {
                Wrapper8>
         properties;
     ttk::OutportDataTypeFunc outportDataTypeFunc = ttk::getOutportDataType;
+    ttk::ExecutionScopeFunc executionScopeFunc = ttk::threadBudgetScope;
     static constexpr std::string_view doc =
         R"ivw(This filter is a dummy example for the development of TTK packages. It
 smooths an input mesh by average the vertex locations on the link of each
@@ -175,6 +175,7 @@ struct VTKTraits<ttkGridLayout> {
                Wrapper8, Wrapper9>
         properties;
     ttk::OutportDataTypeFunc outportDataTypeFunc = ttk::getOutportDataType;
+    ttk::ExecutionScopeFunc executionScopeFunc = ttk::threadBudgetScope;
     static constexpr std::string_view doc =
         R"ivw(This filter computes a grid layout for the blocks of a vtkMultiBlockDataSet.
 
@@ -238,6 +238,7 @@ struct VTKTraits<ttkHarmonicField> {
                Wrapper8, Wrapper9, Wrapper10, Wrapper11>
         properties;
     ttk::OutportDataTypeFunc outportDataTypeFunc = ttk::getOutportDataType;
+    ttk::ExecutionScopeFunc executionScopeFunc = ttk::threadBudgetScope;
     static constexpr std::string_view doc =
         R"ivw(This plugin takes a list of sources (a set of points with
 their global identifiers attached to them) with a scalar
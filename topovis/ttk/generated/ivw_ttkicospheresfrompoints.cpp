@@ -158,6 +158,7 @@ struct VTKTraits<ttkIcospheresFromPoints> {
                Wrapper8>
         properties;
     ttk::OutportDataTypeFunc outportDataTypeFunc = ttk::getOutportDataType;
+    ttk::ExecutionScopeFunc executionScopeFunc = ttk::threadBudgetScope;
     static constexpr std::string_view doc =
         R"ivw(This filter creates for every vertex of an input vtkPointSet an IcoSphere with a specified number of subdivisions and radius.
 
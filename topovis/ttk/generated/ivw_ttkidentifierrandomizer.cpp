@@ -162,6 +162,7 @@ struct VTKTraits<ttkIdentifierRandomizer> {
     std::tuple<Wrapper0, Wrapper1, Wrapper2, Wrapper3, Wrapper4, Wrapper5, Wrapper6, Wrapper7>
         properties;
     ttk::OutportDataTypeFunc outportDataTypeFunc = ttk::getOutportDataType;
+    ttk::ExecutionScopeFunc executionScopeFunc = ttk::threadBudgetScope;
     static constexpr std::string_view doc =
         R"ivw(TTK filter to shuflle ids randomly. Useful to reduce the number of neighbor
 regions with close ids.
@@ -251,6 +251,7 @@ struct VTKTraits<ttkIntegralLines> {
                Wrapper8, Wrapper9, Wrapper10, Wrapper11>
         properties;
     ttk::OutportDataTypeFunc outportDataTypeFunc = ttk::getOutportDataType;
+    ttk::ExecutionScopeFunc executionScopeFunc = ttk::threadBudgetScope;
     static constexpr std::string_view doc =
         R"ivw(The filter takes on its input a scalar field attached as point data to an
 input geometry (either 2D or 3D, either regular grids or triangulations)
@@ -255,6 +255,7 @@ struct VTKTraits<ttkJacobiSet> {
                Wrapper8, Wrapper9, Wrapper10, Wrapper11>
         properties;
     ttk::OutportDataTypeFunc outportDataTypeFunc = ttk::getOutportDataType;
+    ttk::ExecutionScopeFunc executionScopeFunc = ttk::threadBudgetScope;
     static constexpr std::string_view doc =
         R"ivw(Given a bivariate scalar field defined on a PL 3-manifold, this filter
 produces the list of Jacobi edges.
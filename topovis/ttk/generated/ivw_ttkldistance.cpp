@@ -188,6 +188,7 @@ struct VTKTraits<ttkLDistance> {
                Wrapper8>
         properties;
     ttk::OutportDataTypeFunc outportDataTypeFunc = ttk::getOutportDataType;
+    ttk::ExecutionScopeFunc executionScopeFunc = ttk::threadBudgetScope;
     static constexpr std::string_view doc = R"ivw(TTK lDistance plugin documentation.)ivw";
 };
 
@@ -289,6 +289,7 @@ struct VTKTraits<ttkMandatoryCriticalPoints> {
                Wrapper8, Wrapper9, Wrapper10, Wrapper11, Wrapper12, Wrapper13, Wrapper14, Wrapper15>
         properties;
     ttk::OutportDataTypeFunc outportDataTypeFunc = ttk::getOutportDataType;
+    ttk::ExecutionScopeFunc executionScopeFunc = ttk::threadBudgetScope;
     static constexpr std::string_view doc =
         R"ivw(This filter computes the mandatory critical points of uncertain scalar
 fields defined on triangulations. The input uncertain data is represented
@@ -248,6 +248,7 @@ If it's not the case, you can use the filter "Connectivity" (and select "Extract
                Wrapper8, Wrapper9, Wrapper10, Wrapper11, Wrapper12>
         properties;
     ttk::OutportDataTypeFunc outportDataTypeFunc = ttk::getOutportDataType;
+    ttk::ExecutionScopeFunc executionScopeFunc = ttk::threadBudgetScope;
     static constexpr std::string_view doc =
         R"ivw(This plugin takes a scalar field attached as point data to a geometry
 (either 2D or 3D, either regular grids or triangulations) and computes
@@ -118,6 +118,7 @@ struct VTKTraits<ttkMergeTreeAutoencoderDecoding> {
                "CompactTriangulationCacheSize", "Debug_Execute"}}};
     std::tuple<Wrapper0, Wrapper1, Wrapper2, Wrapper3, Wrapper4> properties;
     ttk::OutportDataTypeFunc outportDataTypeFunc = ttk::getOutportDataType;
+    ttk::ExecutionScopeFunc executionScopeFunc = ttk::threadBudgetScope;
     static constexpr std::string_view doc =
         R"ivw(This VTK filter uses the ttk::MergeTreeAutoencoderDecoding module to compute a decoding of merge trees or persistence diagrams given the parameters of a Wasserstein Auto-Encoder.
 
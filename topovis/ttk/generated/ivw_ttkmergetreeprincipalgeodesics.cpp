@@ -235,6 +235,7 @@ If input are persistence diagrams, then this has no effect to use this input.)"}
                Wrapper8, Wrapper9, Wrapper10, Wrapper11, Wrapper12, Wrapper13>
         properties;
     ttk::OutportDataTypeFunc outportDataTypeFunc = ttk::getOutportDataType;
+    ttk::ExecutionScopeFunc executionScopeFunc = ttk::threadBudgetScope;
     static constexpr std::string_view doc =
         R"ivw(This filter computes Principal Geodesic Analysis on the space of merge trees or persistence diagrams, that is, a set of orthogonal geodesic axes defining an optimized basis with the barycenter as origin.
 
@@ -262,6 +262,7 @@ struct VTKTraits<ttkMergeTreePrincipalGeodesicsDecoding> {
                Wrapper16, Wrapper17, Wrapper18>
         properties;
     ttk::OutportDataTypeFunc outportDataTypeFunc = ttk::getOutportDataType;
+    ttk::ExecutionScopeFunc executionScopeFunc = ttk::threadBudgetScope;
     static constexpr std::string_view doc =
         R"ivw(This filter reconstructs merge trees (or persistence diagrams) given their coordinates in a basis computed via Principal Geodesic Analysis.
 
@@ -165,6 +165,7 @@ struct VTKTraits<ttkMergeTreeTemporalReduction> {
                Wrapper8>
         properties;
     ttk::OutportDataTypeFunc outportDataTypeFunc = ttk::getOutportDataType;
+    ttk::ExecutionScopeFunc executionScopeFunc = ttk::threadBudgetScope;
     static constexpr std::string_view doc =
         R"ivw(This filter allows to compute a temporal reduction of a sequence of merge trees.
 
@@ -176,6 +176,7 @@ struct VTKTraits<ttkMergeTreeTemporalReductionDecoding> {
                Wrapper8, Wrapper9>
         properties;
     ttk::OutportDataTypeFunc outportDataTypeFunc = ttk::getOutportDataType;
+    ttk::ExecutionScopeFunc executionScopeFunc = ttk::threadBudgetScope;
     static constexpr std::string_view doc =
         R"ivw(This filter allows to compute the reconstruction of a reduced sequence of merge trees.
 
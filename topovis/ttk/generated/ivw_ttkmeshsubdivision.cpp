@@ -122,6 +122,7 @@ struct VTKTraits<ttkMeshSubdivision> {
         Group{"Input options", {"IterationNumber"}}};
     std::tuple<Wrapper0, Wrapper1, Wrapper2, Wrapper3, Wrapper4, Wrapper5> properties;
     ttk::OutportDataTypeFunc outportDataTypeFunc = ttk::getOutportDataType;
+    ttk::ExecutionScopeFunc executionScopeFunc = ttk::threadBudgetScope;
     static constexpr std::string_view doc =
         R"ivw(This filter subdivides an input mesh with a strategy inspired by
 Discrete Morse theory. It does not modify the position of the original
@@ -110,6 +110,7 @@ struct VTKTraits<ttkMetricDistortion> {
                "CompactTriangulationCacheSize", "Debug_Execute"}}};
     std::tuple<Wrapper0, Wrapper1, Wrapper2, Wrapper3, Wrapper4> properties;
     ttk::OutportDataTypeFunc outportDataTypeFunc = ttk::getOutportDataType;
+    ttk::ExecutionScopeFunc executionScopeFunc = ttk::threadBudgetScope;
     static constexpr std::string_view doc =
         R"ivw(This filter computes distance, area and curvature information about a surface and an optional distance matrix (giving the distance between the points of the surface in a metric space).)ivw";
 };
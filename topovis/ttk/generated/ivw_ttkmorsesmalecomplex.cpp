@@ -322,6 +322,7 @@ If it's not the case, you can use the filter "Connectivity" (and select "Extract
                Wrapper16, Wrapper17, Wrapper18, Wrapper19, Wrapper20>
         properties;
     ttk::OutportDataTypeFunc outportDataTypeFunc = ttk::getOutportDataType;
+    ttk::ExecutionScopeFunc executionScopeFunc = ttk::threadBudgetScope;
     static constexpr std::string_view doc =
         R"ivw(TTK plugin for the computation of Morse-Smale complexes.
 
@@ -136,6 +136,7 @@ struct VTKTraits<ttkMorseSmaleQuadrangulation> {
         Group{"Input Options", {"DualQuadrangulation"}}};
     std::tuple<Wrapper0, Wrapper1, Wrapper2, Wrapper3, Wrapper4, Wrapper5, Wrapper6> properties;
     ttk::OutportDataTypeFunc outportDataTypeFunc = ttk::getOutportDataType;
+    ttk::ExecutionScopeFunc executionScopeFunc = ttk::threadBudgetScope;
     static constexpr std::string_view doc =
         R"ivw(This plugin outputs a very raw quadrangulation from a
 Morse-Smale Complex of a triangular surfacic mesh.
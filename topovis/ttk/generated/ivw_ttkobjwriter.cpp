@@ -54,6 +54,7 @@ struct VTKTraits<ttkOBJWriter> {
     inline static std::array<Group, 0> groups = {};
     std::tuple<Wrapper0> properties;
     ttk::OutportDataTypeFunc outportDataTypeFunc = ttk::getOutportDataType;
+    ttk::ExecutionScopeFunc executionScopeFunc = ttk::threadBudgetScope;
     static constexpr std::string_view doc =
         R"ivw(Export a VTK Unstructured Grid into a Wavefront OBJ file.)ivw";
 };
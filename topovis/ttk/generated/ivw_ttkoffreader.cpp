@@ -53,6 +53,7 @@ struct VTKTraits<ttkOFFReader> {
     inline static std::array<Group, 0> groups = {};
     std::tuple<Wrapper0> properties;
     ttk::OutportDataTypeFunc outportDataTypeFunc = ttk::getOutportDataType;
+    ttk::ExecutionScopeFunc executionScopeFunc = ttk::threadBudgetScope;
     static constexpr std::string_view doc =
         R"ivw(Import an Object File Format mesh into a VTK Unstructured Grid.)ivw";
 };
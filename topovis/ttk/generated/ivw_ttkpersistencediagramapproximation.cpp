@@ -211,6 +211,7 @@ Input should be a regular grid (.vti).)"}};
                Wrapper8, Wrapper9>
         properties;
     ttk::OutportDataTypeFunc outportDataTypeFunc = ttk::getOutportDataType;
+    ttk::ExecutionScopeFunc executionScopeFunc = ttk::threadBudgetScope;
     static constexpr std::string_view doc =
         R"ivw(TTK plugin for the computation of apprroximations of persistence diagrams.
 
@@ -156,6 +156,7 @@ struct VTKTraits<ttkPointDataSelector> {
                Wrapper8>
         properties;
     ttk::OutportDataTypeFunc outportDataTypeFunc = ttk::getOutportDataType;
+    ttk::ExecutionScopeFunc executionScopeFunc = ttk::threadBudgetScope;
     static constexpr std::string_view doc = R"ivw(TTK fieldSelector plugin documentation.
 
 Online examples:
@@ -131,6 +131,7 @@ struct VTKTraits<ttkPointMerger> {
         Group{"Input options", {"BoundaryOnly", "DistanceThreshold"}}};
     std::tuple<Wrapper0, Wrapper1, Wrapper2, Wrapper3, Wrapper4, Wrapper5, Wrapper6> properties;
     ttk::OutportDataTypeFunc outportDataTypeFunc = ttk::getOutportDataType;
+    ttk::ExecutionScopeFunc executionScopeFunc = ttk::threadBudgetScope;
     static constexpr std::string_view doc =
         R"ivw(This plugin merges the points of a mesh whose distance is lower than
 a user defined threshold.)ivw";
@@ -84,6 +84,7 @@ struct VTKTraits<ttkPointSetToCurve> {
     inline static std::array<Group, 1> groups = {Group{"Input options", {"InputOrderingArray"}}};
     std::tuple<Wrapper0, Wrapper1> properties;
     ttk::OutportDataTypeFunc outportDataTypeFunc = ttk::getOutportDataType;
+    ttk::ExecutionScopeFunc executionScopeFunc = ttk::threadBudgetScope;
     static constexpr std::string_view doc =
         R"ivw(This filter generates lines between points in a Point Set
 according to the ordering of a given Point Data.
@@ -102,6 +102,7 @@ struct VTKTraits<ttkPointSetToSurface> {
         Group{"Input options", {"InputOrderingXArray", "InputOrderingYArray"}}};
     std::tuple<Wrapper0, Wrapper1> properties;
     ttk::OutportDataTypeFunc outportDataTypeFunc = ttk::getOutportDataType;
+    ttk::ExecutionScopeFunc executionScopeFunc = ttk::threadBudgetScope;
     static constexpr std::string_view doc =
         R"ivw(This filter generates a surface between points in a Point Set
 according to the ordering of two given Point Data arrays.
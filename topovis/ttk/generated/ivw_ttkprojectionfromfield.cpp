@@ -223,6 +223,7 @@ struct VTKTraits<ttkProjectionFromField> {
                Wrapper8, Wrapper9, Wrapper10>
         properties;
     ttk::OutportDataTypeFunc outportDataTypeFunc = ttk::getOutportDataType;
+    ttk::ExecutionScopeFunc executionScopeFunc = ttk::threadBudgetScope;
     static constexpr std::string_view doc =
         R"ivw(TTK plugin which projects a data-set to 2D given two
 point-data scalar fields to be used as 2D coordinates.
@@ -197,6 +197,7 @@ struct VTKTraits<ttkQuadrangulationSubdivision> {
                Wrapper8, Wrapper9, Wrapper10, Wrapper11>
         properties;
     ttk::OutportDataTypeFunc outportDataTypeFunc = ttk::getOutportDataType;
+    ttk::ExecutionScopeFunc executionScopeFunc = ttk::threadBudgetScope;
     static constexpr std::string_view doc =
         R"ivw(This plugin outputs a very raw quadrangulation from a
 Morse-Smale Complex of a triangular surfacic mesh.
@@ -132,6 +132,7 @@ struct VTKTraits<ttkRangePolygon> {
         Group{"Input options", {"ClosePolygon", "NumberOfIterations"}}};
     std::tuple<Wrapper0, Wrapper1, Wrapper2, Wrapper3, Wrapper4, Wrapper5, Wrapper6> properties;
     ttk::OutportDataTypeFunc outportDataTypeFunc = ttk::getOutportDataType;
+    ttk::ExecutionScopeFunc executionScopeFunc = ttk::threadBudgetScope;
     static constexpr std::string_view doc =
         R"ivw(Given an input 2D selection, this plugin produces a polygon to be used as
 an input to vtkFiberSurface. Typically, users generate a 2D selection from
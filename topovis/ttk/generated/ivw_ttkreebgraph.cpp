@@ -210,6 +210,7 @@ struct VTKTraits<ttkReebGraph> {
                Wrapper8, Wrapper9>
         properties;
     ttk::OutportDataTypeFunc outportDataTypeFunc = ttk::getOutportDataType;
+    ttk::ExecutionScopeFunc executionScopeFunc = ttk::threadBudgetScope;
     static constexpr std::string_view doc =
         R"ivw(TTK filter to compute the Reeb graph of a manifold data set.
 This filter is based on a parallel algorithm.
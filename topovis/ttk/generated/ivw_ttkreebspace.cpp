@@ -519,6 +519,7 @@ struct VTKTraits<ttkReebSpace> {
                Wrapper30, Wrapper31, Wrapper32, Wrapper33, Wrapper34, Wrapper35>
         properties;
     ttk::OutportDataTypeFunc outportDataTypeFunc = ttk::getOutportDataType;
+    ttk::ExecutionScopeFunc executionScopeFunc = ttk::threadBudgetScope;
     static constexpr std::string_view doc =
         R"ivw(The Reeb space is a useful topological abstraction of bivariate scalar
 fields for data segmentation purposes. Intuitively, it allows the automatic
@@ -176,6 +176,7 @@ struct VTKTraits<ttkRipsPersistenceGenerators> {
                Wrapper8, Wrapper9>
         properties;
     ttk::OutportDataTypeFunc outportDataTypeFunc = ttk::getOutportDataType;
+    ttk::ExecutionScopeFunc executionScopeFunc = ttk::threadBudgetScope;
     static constexpr std::string_view doc =
         R"ivw(TTK plugin for the computation of the persistence generators of Rips complexes.)ivw";
 };
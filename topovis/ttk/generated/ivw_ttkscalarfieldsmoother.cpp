@@ -193,6 +193,7 @@ struct VTKTraits<ttkScalarFieldSmoother> {
                Wrapper8>
         properties;
     ttk::OutportDataTypeFunc outportDataTypeFunc = ttk::getOutportDataType;
+    ttk::ExecutionScopeFunc executionScopeFunc = ttk::threadBudgetScope;
     static constexpr std::string_view doc =
         R"ivw(This class is a dummy example for the development of TTK filters. It
 smooths an input scalar field by averaging the scalar values on the link
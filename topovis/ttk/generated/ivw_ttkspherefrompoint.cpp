@@ -201,6 +201,7 @@ struct VTKTraits<ttkSphereFromPoint> {
                Wrapper8, Wrapper9, Wrapper10, Wrapper11>
         properties;
     ttk::OutportDataTypeFunc outportDataTypeFunc = ttk::getOutportDataType;
+    ttk::ExecutionScopeFunc executionScopeFunc = ttk::threadBudgetScope;
     static constexpr std::string_view doc = R"ivw(TTK plugin that produces sphere-only glyphs.)ivw";
 };
 
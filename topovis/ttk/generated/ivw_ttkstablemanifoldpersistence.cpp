@@ -136,6 +136,7 @@ module.)"}};
         Group{"Input options", {"Unstable manifold"}}};
     std::tuple<Wrapper0, Wrapper1, Wrapper2, Wrapper3, Wrapper4, Wrapper5> properties;
     ttk::OutportDataTypeFunc outportDataTypeFunc = ttk::getOutportDataType;
+    ttk::ExecutionScopeFunc executionScopeFunc = ttk::threadBudgetScope;
     static constexpr std::string_view doc =
         R"ivw(Given an input stable manifold (1D, 2D or 3D) computed by the
 Morse-Smale complex, this module attaches to it the persistence (and
@@ -73,6 +73,7 @@ struct VTKTraits<ttkStringArrayConverter> {
     inline static std::array<Group, 1> groups = {Group{"Input options", {"Input String Array"}}};
     std::tuple<Wrapper0> properties;
     ttk::OutportDataTypeFunc outportDataTypeFunc = ttk::getOutportDataType;
+    ttk::ExecutionScopeFunc executionScopeFunc = ttk::threadBudgetScope;
     static constexpr std::string_view doc =
         R"ivw(This filter converts an input vtkStringArray into an
 vtkIntArray to make it easier to apply Threshold on the data
@@ -218,6 +218,7 @@ struct VTKTraits<ttkSurfaceGeometrySmoother> {
                Wrapper8, Wrapper9, Wrapper10>
         properties;
     ttk::OutportDataTypeFunc outportDataTypeFunc = ttk::getOutportDataType;
+    ttk::ExecutionScopeFunc executionScopeFunc = ttk::threadBudgetScope;
     static constexpr std::string_view doc = R"ivw(GeometrySmoother with a twist!
 
 This class smoothes and projects a 1D or a 2D mesh onto a 2D
@@ -206,6 +206,7 @@ struct VTKTraits<ttkTextureMapFromField> {
                Wrapper8, Wrapper9, Wrapper10>
         properties;
     ttk::OutportDataTypeFunc outportDataTypeFunc = ttk::getOutportDataType;
+    ttk::ExecutionScopeFunc executionScopeFunc = ttk::threadBudgetScope;
     static constexpr std::string_view doc =
         R"ivw(This plugin is useful to convert scalar fields to texture coordinates
 or to generate texture-based level lines out of a single scalar fields.)ivw";
@@ -203,6 +203,7 @@ struct VTKTraits<ttkTopologicalCompression> {
                Wrapper8, Wrapper9, Wrapper10>
         properties;
     ttk::OutportDataTypeFunc outportDataTypeFunc = ttk::getOutportDataType;
+    ttk::ExecutionScopeFunc executionScopeFunc = ttk::threadBudgetScope;
     static constexpr std::string_view doc = R"ivw(TTK topologicalCompression plugin documentation.
 
 Online examples:
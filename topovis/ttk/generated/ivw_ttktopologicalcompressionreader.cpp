@@ -53,6 +53,7 @@ struct VTKTraits<ttkTopologicalCompressionReader> {
     inline static std::array<Group, 1> groups = {Group{"Select file", {"FileName"}}};
     std::tuple<Wrapper0> properties;
     ttk::OutportDataTypeFunc outportDataTypeFunc = ttk::getOutportDataType;
+    ttk::ExecutionScopeFunc executionScopeFunc = ttk::threadBudgetScope;
     static constexpr std::string_view doc =
         R"ivw(This plugin specifies the file name for the TTK reader.
 
@@ -503,6 +503,7 @@ struct VTKTraits<ttkTopologicalSimplification> {
                Wrapper30>
         properties;
     ttk::OutportDataTypeFunc outportDataTypeFunc = ttk::getOutportDataType;
+    ttk::ExecutionScopeFunc executionScopeFunc = ttk::threadBudgetScope;
     static constexpr std::string_view doc =
         R"ivw(Given an input scalar field and a list of critical points to remove,
 this plugin minimally edits the scalar field such that the listed critical
@@ -194,6 +194,7 @@ struct VTKTraits<ttkTopologicalSimplificationByPersistence> {
                Wrapper8, Wrapper9>
         properties;
     ttk::OutportDataTypeFunc outportDataTypeFunc = ttk::getOutportDataType;
+    ttk::ExecutionScopeFunc executionScopeFunc = ttk::threadBudgetScope;
     static constexpr std::string_view doc =
         R"ivw(Given an input scalar field and a persistence threshold (either as an absolute value or a fraction of the scalar range), this filter modifies the scalar field such that it no longer exhibits persistence pairs below the given threshold. All other pairs are unaffected. To this end the filter uses the persistence-sensitive specialization of localized topological simplification (PLTS). Note that this filter will also compute an unambiguous global vertex order that can be used in subsequent topological data analysis.
 
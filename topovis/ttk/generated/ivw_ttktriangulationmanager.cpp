@@ -153,6 +153,7 @@ struct VTKTraits<ttkTriangulationManager> {
     std::tuple<Wrapper0, Wrapper1, Wrapper2, Wrapper3, Wrapper4, Wrapper5, Wrapper6, Wrapper7>
         properties;
     ttk::OutportDataTypeFunc outportDataTypeFunc = ttk::getOutportDataType;
+    ttk::ExecutionScopeFunc executionScopeFunc = ttk::threadBudgetScope;
     static constexpr std::string_view doc =
         R"ivw(This filter converts a regular grid (vtkImageData) into a
 periodic regular grid (vtkImageData), in all dimensions OR compacts an
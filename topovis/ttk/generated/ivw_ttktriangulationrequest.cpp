@@ -162,6 +162,7 @@ struct VTKTraits<ttkTriangulationRequest> {
                Wrapper8>
         properties;
     ttk::OutportDataTypeFunc outportDataTypeFunc = ttk::getOutportDataType;
+    ttk::ExecutionScopeFunc executionScopeFunc = ttk::threadBudgetScope;
     static constexpr std::string_view doc =
         R"ivw(TTK triangulationRequest plugin documentation.)ivw";
 };
@@ -141,6 +141,7 @@ struct VTKTraits<ttkUncertainDataEstimator> {
         Group{"Input options", {"Bound to Compute"}}};
     std::tuple<Wrapper0, Wrapper1, Wrapper2, Wrapper3, Wrapper4, Wrapper5, Wrapper6> properties;
     ttk::OutportDataTypeFunc outportDataTypeFunc = ttk::getOutportDataType;
+    ttk::ExecutionScopeFunc executionScopeFunc = ttk::threadBudgetScope;
     static constexpr std::string_view doc =
         R"ivw(TTK plugin that takes an input ensemble data set (represented
 by a list of scalar fields) and which computes various vertexwise statistics
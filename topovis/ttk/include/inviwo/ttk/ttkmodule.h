@@ -32,6 +32,8 @@
 #include <inviwo/core/common/inviwomodule.h>
 #include <inviwo/core/io/serialization/ticpp.h>
 #include <inviwo/core/io/serialization/versionconverter.h>
+#include <inviwo/ttk/util/threadbudget.h>
+#include <inviwo/ttk/util/ttksettings.h>
 
 namespace inviwo {
 
@@ -43,6 +45,10 @@ public:
     virtual int getVersion() const override;
     virtual std::unique_ptr<VersionConverter> getConverter(int version) const override;
 
+    TTKSettings settings;
+    /// Threads shared by all running TTK filters, see ttk::threadBudgetScope
+    ttk::ThreadBudget threadBudget;
+
 private:
     class Converter : public VersionConverter {
     public:
@@ -0,0 +1,143 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+#pragma once
+
+#include <inviwo/ttk/ttkmoduledefine.h>
+
+#include <chrono>
+#include <cstddef>
+#include <map>
+#include <mutex>
+#include <string>
+#include <string_view>
+
+namespace inviwo {
+
+namespace ttk {
+
+/**
+ * A module wide budget of threads shared by concurrently running TTK filters, and any other task
+ * that leases threads from it. Each task acquires a Lease for the number of threads it would like
+ * to use and gets a number of threads according to the Policy. The number of threads is fixed
+ * when the lease is granted, a running filter cannot change its thread number safely, so later
+ * tasks only see fewer free threads. The lease records the wall time and thread usage of the task
+ * when it is released. All functions are thread safe.
+ */
+class IVW_MODULE_TTK_API ThreadBudget {
+public:
+    enum class Policy {
+        Unrestricted,  //!< grant the requested number of threads
+        FairShare,     //!< an even share of the budget, or all free threads if that is more
+        Available,     //!< grant at most the threads not leased by other running tasks
+    };
+
+    /**
+     * Threads leased from a ThreadBudget, returned to the budget on destruction.
+     */
+    class IVW_MODULE_TTK_API Lease {
+    public:
+        Lease() = default;
+        Lease(const Lease&) = delete;
+        Lease(Lease&& rhs) noexcept;
+        Lease& operator=(const Lease&) = delete;
+        Lease& operator=(Lease&& rhs) noexcept;
+        ~Lease();
+
+        /// Number of threads granted, 0 if released
+        int threads() const;
+        void release();
+
+    private:
+        friend ThreadBudget;
+        Lease(ThreadBudget* budget, size_t id);
+
+        ThreadBudget* budget_ = nullptr;
+        size_t id_ = 0;
+    };
+
+    /**
+     * Usage statistics of all tasks with the same name
+     */
+    struct Stats {
+        size_t runs = 0;
+        std::chrono::duration<double> totalTime{0.0};
+        std::chrono::duration<double> lastTime{0.0};
+        int lastThreads = 0;
+        int maxThreads = 0;
+        /// Sum of wall time times threads, i.e. the thread time leased
+        std::chrono::duration<double> threadTime{0.0};
+
+        std::string toString() const;
+    };
+
+    explicit ThreadBudget(int threads, Policy policy = Policy::FairShare);
+
+    /**
+     * Lease threads for task @p name wanting to use @p requested threads. At least one thread is
+     * always granted.
+     */
+    Lease acquire(std::string_view name, int requested);
+
+    void setThreads(int threads);
+    int getThreads() const;
+
+    void setPolicy(Policy policy);
+    Policy getPolicy() const;
+
+    /// Number of threads currently leased
+    int getThreadsInUse() const;
+    /// Number of currently running tasks
+    int getActiveTasks() const;
+
+    std::map<std::string, Stats, std::less<>> getStats() const;
+    void clearStats();
+
+private:
+    struct Task {
+        std::string name;
+        int requested = 1;
+        int threads = 0;
+        std::chrono::steady_clock::time_point start;
+    };
+
+    void release(size_t id);
+    int threads(size_t id) const;
+
+    mutable std::mutex mutex_;
+    int threads_;
+    Policy policy_;
+    int inUse_ = 0;
+    size_t nextId_ = 1;
+    std::map<size_t, Task> tasks_;  //!< running tasks ordered by start
+    std::map<std::string, Stats, std::less<>> stats_;
+};
+
+}  // namespace ttk
+
+}  // namespace inviwo
@@ -33,7 +33,9 @@
 
 #include <optional>
 #include <string>
+#include <string_view>
 #include <functional>
+#include <memory>
 
 class vtkInformation;
 class vtkAlgorithm;
@@ -68,6 +70,33 @@ using OutportDataTypeFunc = std::function<std::optional<std::string>(vtkAlgorith
 IVW_MODULE_TTK_API std::optional<std::string> getOutportDataType(vtkAlgorithm* filter,
                                                                  int portNumber);
 
+/**
+ * To be used in conjunction with VTKGenericProcessor. If the VTKTraits struct has a member
+ * <tt>executionScopeFunc</tt> of this type, the function is called right before the filter is
+ * updated and the returned object is kept alive until the update has finished.
+ *
+ * \code{.cpp} template <> struct VTKTraits<ttkDistanceField> {
+ *     ...
+ *     ttk::ExecutionScopeFunc executionScopeFunc = ttk::threadBudgetScope;
+ *     ...
+ * };
+ * \endcode
+ *
+ * \see threadBudgetScope
+ */
+using ExecutionScopeFunc = std::function<std::shared_ptr<void>(vtkAlgorithm*, std::string_view)>;
+
+/**
+ * Lease threads for the TTK filter \p filter from the ThreadBudget of the ttkModule. The filter
+ * asks for the number of threads given by its "Use All Cores" and "Thread Number" settings and is
+ * set to use the number of threads granted by the budget for the whole execution. The settings of
+ * the filter are left untouched. The threads are returned to the
+ * budget and the previous thread number of the filter is restored when the returned object is
+ * destroyed. Does nothing for filters not derived from ttkAlgorithm.
+ */
+IVW_MODULE_TTK_API std::shared_ptr<void> threadBudgetScope(vtkAlgorithm* filter,
+                                                           std::string_view name);
+
 }  // namespace ttk
 
 }  // namespace inviwo
@@ -31,16 +31,32 @@
 
 #include <registerfilters.h>
 
+#include <inviwo/core/util/logcentral.h>
+
 namespace inviwo {
 
-ttkModule::ttkModule(InviwoApplication* app) : InviwoModule(app, "ttk") {
+ttkModule::ttkModule(InviwoApplication* app)
+    : InviwoModule(app, "ttk")
+    , settings{}
+    , threadBudget{settings.threads.get(), settings.threadPolicy.getSelectedValue()} {
     // Add a directory to the search path of the Shadermanager
     // ShaderManager::getPtr()->addShaderSearchPath(getPath(ModulePath::GLSL));
 
     // Register objects that can be shared with the rest of inviwo here:
 
+    settings.threads.onChange([this]() { threadBudget.setThreads(settings.threads.get()); });
+    settings.threadPolicy.onChange(
+        [this]() { threadBudget.setPolicy(settings.threadPolicy.getSelectedValue()); });
+    settings.logStatistics.onChange([this]() {
+        for (const auto& [name, stats] : threadBudget.getStats()) {
+            log::info("{}: {}", name, stats.toString());
+        }
+    });
+
     // Processors
     vtkwrapper::registerVTKFilters(this);
+
+    registerSettings(&settings);
 }
 
 int ttkModule::getVersion() const { return 1; }
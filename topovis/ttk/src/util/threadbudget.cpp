@@ -0,0 +1,175 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/ttk/util/threadbudget.h>
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <utility>
+
+namespace inviwo {
+
+namespace ttk {
+
+ThreadBudget::Lease::Lease(ThreadBudget* budget, size_t id) : budget_{budget}, id_{id} {}
+
+ThreadBudget::Lease::Lease(Lease&& rhs) noexcept
+    : budget_{std::exchange(rhs.budget_, nullptr)}, id_{rhs.id_} {}
+
+ThreadBudget::Lease& ThreadBudget::Lease::operator=(Lease&& rhs) noexcept {
+    if (this != &rhs) {
+        release();
+        budget_ = std::exchange(rhs.budget_, nullptr);
+        id_ = rhs.id_;
+    }
+    return *this;
+}
+
+ThreadBudget::Lease::~Lease() { release(); }
+
+int ThreadBudget::Lease::threads() const { return budget_ ? budget_->threads(id_) : 0; }
+
+void ThreadBudget::Lease::release() {
+    if (budget_) {
+        budget_->release(id_);
+        budget_ = nullptr;
+    }
+}
+
+std::string ThreadBudget::Stats::toString() const {
+    return fmt::format("{} runs, {:.3f} s total, {:.3f} s last run using {} threads (max {}), "
+                       "{:.3f} thread seconds",
+                       runs, totalTime.count(), lastTime.count(), lastThreads, maxThreads,
+                       threadTime.count());
+}
+
+ThreadBudget::ThreadBudget(int threads, Policy policy)
+    : threads_{std::max(1, threads)}, policy_{policy} {}
+
+ThreadBudget::Lease ThreadBudget::acquire(std::string_view name, int requested) {
+    const std::scoped_lock lock{mutex_};
+
+    const auto id = nextId_++;
+    auto& task = tasks_[id];
+    task.name = name;
+    task.requested = std::max(1, requested);
+    task.start = std::chrono::steady_clock::now();
+
+    const int free = threads_ - inUse_;
+    switch (policy_) {
+        case Policy::FairShare: {
+            const int share = threads_ / static_cast<int>(tasks_.size());
+            task.threads = std::max(1, std::min(task.requested, std::max(share, free)));
+            break;
+        }
+        case Policy::Available:
+            task.threads = std::max(1, std::min(task.requested, free));
+            break;
+        case Policy::Unrestricted:
+        default:
+            task.threads = task.requested;
+            break;
+    }
+    inUse_ += task.threads;
+
+    return Lease{this, id};
+}
+
+void ThreadBudget::release(size_t id) {
+    const std::scoped_lock lock{mutex_};
+
+    auto taskIt = tasks_.find(id);
+    if (taskIt == tasks_.end()) return;
+    const auto& task = taskIt->second;
+    inUse_ -= task.threads;
+
+    auto it = stats_.find(task.name);
+    if (it == stats_.end()) it = stats_.try_emplace(task.name).first;
+    auto& stats = it->second;
+    const std::chrono::duration<double> time = std::chrono::steady_clock::now() - task.start;
+    ++stats.runs;
+    stats.totalTime += time;
+    stats.lastTime = time;
+    stats.lastThreads = task.threads;
+    stats.maxThreads = std::max(stats.maxThreads, task.threads);
+    stats.threadTime += time * task.threads;
+
+    tasks_.erase(taskIt);
+}
+
+int ThreadBudget::threads(size_t id) const {
+    const std::scoped_lock lock{mutex_};
+    auto it = tasks_.find(id);
+    return it != tasks_.end() ? it->second.threads : 0;
+}
+
+void ThreadBudget::setThreads(int threads) {
+    const std::scoped_lock lock{mutex_};
+    threads_ = std::max(1, threads);
+}
+
+int ThreadBudget::getThreads() const {
+    const std::scoped_lock lock{mutex_};
+    return threads_;
+}
+
+void ThreadBudget::setPolicy(Policy policy) {
+    const std::scoped_lock lock{mutex_};
+    policy_ = policy;
+}
+
+ThreadBudget::Policy ThreadBudget::getPolicy() const {
+    const std::scoped_lock lock{mutex_};
+    return policy_;
+}
+
+int ThreadBudget::getThreadsInUse() const {
+    const std::scoped_lock lock{mutex_};
+    return inUse_;
+}
+
+int ThreadBudget::getActiveTasks() const {
+    const std::scoped_lock lock{mutex_};
+    return static_cast<int>(tasks_.size());
+}
+
+std::map<std::string, ThreadBudget::Stats, std::less<>> ThreadBudget::getStats() const {
+    const std::scoped_lock lock{mutex_};
+    return stats_;
+}
+
+void ThreadBudget::clearStats() {
+    const std::scoped_lock lock{mutex_};
+    stats_.clear();
+}
+
+}  // namespace ttk
+
+}  // namespace inviwo
@@ -28,6 +28,9 @@
  *********************************************************************************/
 
 #include <inviwo/vtk/processors/vtkgenericprocessor.h>
+#include <inviwo/ttk/ttkmodule.h>
+#include <inviwo/ttk/util/threadbudget.h>
+#include <inviwo/core/util/moduleutils.h>
 
 #include <ttk/vtk/ttkAlgorithm.h>
 #include <vtkInformation.h>
@@ -56,6 +59,30 @@ std::optional<std::string> getOutportDataType(vtkAlgorithm* filter, int portNumb
     return dataType;
 }
 
+std::shared_ptr<void> threadBudgetScope(vtkAlgorithm* filter, std::string_view name) {
+    auto* algorithm = ttkAlgorithm::SafeDownCast(filter);
+    if (!algorithm) return nullptr;
+
+    auto* module = util::getModuleByType<ttkModule>();
+    if (!module) return nullptr;
+
+    // The thread number reflects both the "Use All Cores" and "Thread Number" settings. Only the
+    // thread number used for the execution is changed, not the settings, to not modify the filter.
+    // The filter copies the thread number when it starts executing, so it is only set here, before
+    // the execution, and never while the filter is running.
+    const int previous = algorithm->getThreadNumber();
+    auto lease = module->threadBudget.acquire(name, previous);
+    algorithm->setThreadNumber(lease.threads());
+
+    return std::shared_ptr<ThreadBudget::Lease>(
+        new ThreadBudget::Lease(std::move(lease)),
+        [algorithm, previous](ThreadBudget::Lease* lease) {
+            lease->release();
+            algorithm->setThreadNumber(previous);
+            delete lease;
+        });
+}
+
 }  // namespace ttk
 
 }  // namespace inviwo
@@ -0,0 +1,62 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/ttk/util/ttksettings.h>
+
+#include <algorithm>
+#include <thread>
+
+namespace inviwo {
+
+TTKSettings::TTKSettings()
+    : Settings("TTK Thread Budget")
+    , threadPolicy{"threadPolicy",
+                   "Thread Policy",
+                   "How the thread budget is divided between concurrently running TTK filters. "
+                   "'Unrestricted' uses the thread settings of each filter, 'Fair Share' grants "
+                   "an even share of the budget or all free threads if that is more, and "
+                   "'Available' grants at most the threads not used by other filters. The "
+                   "threads of a filter are fixed when it starts executing"_help,
+                   {{"unrestricted", "Unrestricted", ttk::ThreadBudget::Policy::Unrestricted},
+                    {"fairShare", "Fair Share", ttk::ThreadBudget::Policy::FairShare},
+                    {"available", "Available", ttk::ThreadBudget::Policy::Available}},
+                   1}
+    , threads{"threads",
+              "Thread Budget",
+              "Total number of threads shared by all running TTK filters"_help,
+              static_cast<int>(std::max(1u, std::thread::hardware_concurrency())),
+              {1, ConstraintBehavior::Immutable},
+              {256, ConstraintBehavior::Ignore}}
+    , logStatistics{"logStatistics", "Log Statistics"} {
+
+    addProperties(threadPolicy, threads, logStatistics);
+    load();
+}
+
+}  // namespace inviwo
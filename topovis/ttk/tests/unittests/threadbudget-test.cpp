@@ -0,0 +1,121 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/ttk/util/threadbudget.h>
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <utility>
+
+namespace inviwo {
+
+TEST(ThreadBudgetTest, Unrestricted) {
+    ttk::ThreadBudget budget{4, ttk::ThreadBudget::Policy::Unrestricted};
+
+    auto a = budget.acquire("a", 8);
+    auto b = budget.acquire("b", 3);
+    EXPECT_EQ(a.threads(), 8);
+    EXPECT_EQ(b.threads(), 3);
+    EXPECT_EQ(budget.getThreadsInUse(), 11);
+    EXPECT_EQ(budget.getActiveTasks(), 2);
+}
+
+TEST(ThreadBudgetTest, FairShare) {
+    ttk::ThreadBudget budget{8, ttk::ThreadBudget::Policy::FairShare};
+
+    auto a = budget.acquire("a", 16);
+    EXPECT_EQ(a.threads(), 8);
+    auto b = budget.acquire("b", 16);
+    EXPECT_EQ(b.threads(), 4);
+    EXPECT_EQ(a.threads(), 8) << "The grant of a running task never changes";
+    auto c = budget.acquire("c", 2);
+    EXPECT_EQ(c.threads(), 2);
+    auto d = budget.acquire("d", 0);
+    EXPECT_EQ(d.threads(), 1) << "At least one thread is always granted";
+    EXPECT_EQ(budget.getThreadsInUse(), 15);
+
+    c.release();
+    d.release();
+    b.release();
+    auto e = budget.acquire("e", 16);
+    EXPECT_EQ(e.threads(), 4);
+    a.release();
+    auto f = budget.acquire("f", 16);
+    EXPECT_EQ(f.threads(), 4) << "All free threads are granted if more than the share";
+
+    budget.setThreads(2);
+    EXPECT_EQ(e.threads(), 4) << "The budget applies to leases acquired afterwards";
+    EXPECT_EQ(budget.acquire("g", 16).threads(), 1);
+}
+
+TEST(ThreadBudgetTest, Available) {
+    ttk::ThreadBudget budget{8, ttk::ThreadBudget::Policy::Available};
+
+    auto a = budget.acquire("a", 6);
+    EXPECT_EQ(a.threads(), 6);
+    auto b = budget.acquire("b", 6);
+    EXPECT_EQ(b.threads(), 2);
+    auto c = budget.acquire("c", 6);
+    EXPECT_EQ(c.threads(), 1) << "At least one thread is always granted";
+
+    a.release();
+    EXPECT_EQ(budget.getThreadsInUse(), 3);
+    auto d = budget.acquire("d", 6);
+    EXPECT_EQ(d.threads(), 5);
+}
+
+TEST(ThreadBudgetTest, LeaseRelease) {
+    ttk::ThreadBudget budget{4};
+    {
+        auto a = budget.acquire("filter", 2);
+        auto b = std::move(a);
+        EXPECT_EQ(budget.getActiveTasks(), 1);
+        a.release();
+        EXPECT_EQ(budget.getActiveTasks(), 1) << "A moved from lease does not own any threads";
+    }
+    EXPECT_EQ(budget.getActiveTasks(), 0);
+    EXPECT_EQ(budget.getThreadsInUse(), 0);
+
+    { auto c = budget.acquire("filter", 3); }
+
+    const auto stats = budget.getStats();
+    ASSERT_EQ(stats.size(), size_t{1});
+    const auto& filter = stats.at("filter");
+    EXPECT_EQ(filter.runs, size_t{2});
+    EXPECT_EQ(filter.lastThreads, 3);
+    EXPECT_EQ(filter.maxThreads, 3);
+
+    budget.clearStats();
+    EXPECT_TRUE(budget.getStats().empty());
+}
+
+}  // namespace inviwo
@@ -0,0 +1,150 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <inviwo/integrallinefiltering/integrallinefilteringmoduledefine.h>
+#include <inviwo/core/common/inviwo.h>
+#include <inviwo/core/util/glm.h>
+
+#include <inviwo/integrallinefiltering/algorithm/uniformspherepartitioning.h>
+
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+namespace inviwo {
+
+/**
+ * \brief Trig-free lookup of the patches of a UniformSpherePartitioning
+ * OctahedralSpherePartitioning partitions the sphere into the same N patches of equal area as
+ * UniformSpherePartitioning but replaces the per lookup atan2/acos with an octahedral mapping of
+ * the direction onto a square grid. The grid is precomputed at construction by assigning each cell
+ * center to its patch in the equal-area partitioning, hence a lookup is a few additions, one
+ * division and a table read. Directions within half a grid cell of a patch boundary might end up in
+ * a neighbouring patch, increase the resolution to reduce that error.
+ *
+ * @see UniformSpherePartitioning
+ */
+template <typename T>
+class OctahedralSpherePartitioning {
+    static_assert(std::is_floating_point_v<T>);
+
+public:
+    /**
+     * Returns a grid resolution giving roughly 1000 grid cells per patch, which keeps the
+     * fraction of directions assigned to a neighbouring patch below 2%.
+     */
+    static size_t defaultResolution(const size_t segments) {
+        return std::max(size_t(64),
+                        static_cast<size_t>(std::ceil(std::sqrt(static_cast<T>(segments)) * 32)));
+    }
+
+    /**
+     * Create a sphere partition with given number of patches using a lookup grid of
+     * \p resolution x \p resolution cells. If \p resolution is zero defaultResolution() is used.
+     */
+    OctahedralSpherePartitioning(const size_t segments = 20, const size_t resolution = 0)
+        : segments_{segments}
+        , resolution_{resolution == 0 ? defaultResolution(segments) : resolution}
+        , lut_(resolution_ * resolution_) {
+
+        const UniformSpherePartitioning<T> partitioning(segments);
+        const T cellSize = T(1) / static_cast<T>(resolution_);
+        for (size_t y = 0; y < resolution_; ++y) {
+            for (size_t x = 0; x < resolution_; ++x) {
+                const glm::vec<2, T> uv{(x + T(0.5)) * cellSize, (y + T(0.5)) * cellSize};
+                lut_[x + y * resolution_] = static_cast<std::uint32_t>(
+                    partitioning.getRegionForDirection(toDirection(uv)));
+            }
+        }
+    }
+
+    OctahedralSpherePartitioning(const OctahedralSpherePartitioning&) = default;
+    OctahedralSpherePartitioning(OctahedralSpherePartitioning&&) = default;
+    OctahedralSpherePartitioning& operator=(const OctahedralSpherePartitioning&) = default;
+    OctahedralSpherePartitioning& operator=(OctahedralSpherePartitioning&&) = default;
+
+    /**
+     * Returns the number of partitions.
+     */
+    size_t numberOfPatches() const { return segments_; }
+
+    /**
+     * Returns the resolution of the lookup grid.
+     */
+    size_t resolution() const { return resolution_; }
+
+    /**
+     * Return the index of the partition for the given direction. The direction does not have to be
+     * normalized.
+     */
+    size_t getRegionForDirection(const glm::vec<3, T>& dir) const {
+        const auto uv = toOctahedral(dir);
+        const auto max = static_cast<T>(resolution_ - 1);
+        const auto x = static_cast<size_t>(std::min(uv.x * resolution_, max));
+        const auto y = static_cast<size_t>(std::min(uv.y * resolution_, max));
+        return lut_[x + y * resolution_];
+    }
+
+    /**
+     * Maps a direction onto the unit square [0 1]^2 by projecting it onto the octahedron
+     * |x|+|y|+|z|=1 and unfolding the lower half. A zero vector maps to the center of the square.
+     */
+    static glm::vec<2, T> toOctahedral(const glm::vec<3, T>& dir) {
+        const T l1 = std::abs(dir.x) + std::abs(dir.y) + std::abs(dir.z);
+        if (l1 == T(0)) return glm::vec<2, T>{T(0.5)};
+        glm::vec<2, T> p{dir.x / l1, dir.y / l1};
+        if (dir.z < T(0)) {
+            p = glm::vec<2, T>{(T(1) - std::abs(p.y)) * (p.x >= T(0) ? T(1) : T(-1)),
+                               (T(1) - std::abs(p.x)) * (p.y >= T(0) ? T(1) : T(-1))};
+        }
+        return glm::clamp(p * T(0.5) + T(0.5), glm::vec<2, T>{T(0)}, glm::vec<2, T>{T(1)});
+    }
+
+    /**
+     * Inverse of toOctahedral(), returns a normalized direction.
+     */
+    static glm::vec<3, T> toDirection(const glm::vec<2, T>& uv) {
+        const glm::vec<2, T> p = uv * T(2) - T(1);
+        glm::vec<3, T> dir{p.x, p.y, T(1) - std::abs(p.x) - std::abs(p.y)};
+        if (dir.z < T(0)) {
+            dir.x = (T(1) - std::abs(p.y)) * (p.x >= T(0) ? T(1) : T(-1));
+            dir.y = (T(1) - std::abs(p.x)) * (p.y >= T(0) ? T(1) : T(-1));
+        }
+        return glm::normalize(dir);
+    }
+
+private:
+    size_t segments_;
+    size_t resolution_;
+    std::vector<std::uint32_t> lut_;
+};
+
+}  // namespace inviwo
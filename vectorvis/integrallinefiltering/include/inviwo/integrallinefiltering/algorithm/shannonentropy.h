@@ -41,6 +41,7 @@
 #include <inviwo/core/datastructures/histogram.h>
 
 #include <inviwo/integrallinefiltering/datastructures/sparsehistogram.h>
+#include <inviwo/integrallinefiltering/datastructures/densehistogram.h>
 #include <inviwo/integrallinefiltering/datastructures/directionalhistogram.h>
 
 namespace inviwo {
@@ -102,6 +103,28 @@ double shannonEntropy(const Histogram& histogram) {
     return -ent;
 }
 
+/**
+ * Calculates the entropy for a DenseHistogram. Uses the identity
+ * $H = log2(n) - 1/n * sum(c_i * log2(c_i))$ where n is the total count, which turns the
+ * calculation into a single branch-free reduction over the flat array of counts that the compiler
+ * can vectorize.
+ */
+inline double shannonEntropy(const DenseHistogram& histogram) {
+    const size_t* counts = histogram.data();
+    const size_t numBins = histogram.numberOfBins();
+
+    double total = 0.0;
+    double sum = 0.0;
+    for (size_t i = 0; i < numBins; ++i) {
+        const double c = static_cast<double>(counts[i]);
+        // std::max avoids log2(0), the product is zero for empty bins anyway
+        sum += c * std::log2(std::max(c, 1.0));
+        total += c;
+    }
+    if (total == 0.0) return 0.0;
+    return std::max(0.0, std::log2(total) - sum / total);
+}
+
 /**
  * Calculates the entropy of the given input dataset. Bins the data into an histogram of \p numBins
  * @param data the input data
@@ -155,6 +178,29 @@ double shannonEntropyDirectional(const std::vector<glm::vec<Dims, T>>& data, con
     }
 }
 
+/**
+ * Calculates the entropy of the given input dataset of directional vectors using an existing
+ * partitioning of the sphere, see UniformSpherePartitioning or OctahedralSpherePartitioning.
+ * Prefer this overload when calculating the entropy of many datasets since the partitioning is
+ * only created once.
+ * @param data the input data
+ * @param partitioning partitioning of the sphere used to bin the directions
+ * @param histogram histogram used for binning, reused between calls to avoid allocations
+ * @param normalize wether to use normalization or not, if normalization the output will be on the
+ * range [0 1], if not, the range will be on [0 log2(numBins)]
+ */
+template <typename T, typename Partitioning>
+double shannonEntropyDirectional(const std::vector<glm::vec<3, T>>& data,
+                                 const Partitioning& partitioning, DenseHistogram& histogram,
+                                 PerformNormalization normalize = PerformNormalization::Yes) {
+    histogram::calculateDirectionalHistogram(data, partitioning, histogram);
+    if (normalize == PerformNormalization::Yes) {
+        return shannonEntropy(histogram) / shannonEntropyMax(histogram.numberOfBins());
+    } else {
+        return shannonEntropy(histogram);
+    }
+}
+
 /**
  * Calculates the entropy of the given input dataset of points.
  * Bins the data into an histogram of with bins of size \p binSize.
@@ -0,0 +1,91 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+#pragma once
+
+#include <inviwo/integrallinefiltering/integrallinefilteringmoduledefine.h>
+#include <inviwo/core/common/inviwo.h>
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+namespace inviwo {
+
+/*
+ * A histogram stored as a flat array of counts, intended for a small, known number of bins where
+ * SparseHistogram would spend most of its time hashing. Bins are addressed by [0 numberOfBins).
+ * The histogram can be cleared and refilled without reallocating which makes it suitable to reuse
+ * when computing one histogram per line in a set of lines.
+ * @see SparseHistogram
+ */
+class IVW_MODULE_INTEGRALLINEFILTERING_API DenseHistogram {
+public:
+    using index_type = size_t;
+
+    DenseHistogram(size_t numberOfBins = 0) : bins_(numberOfBins, 0) {}
+    DenseHistogram(const DenseHistogram&) = default;
+    DenseHistogram(DenseHistogram&&) noexcept = default;
+    DenseHistogram& operator=(const DenseHistogram&) = default;
+    DenseHistogram& operator=(DenseHistogram&&) noexcept = default;
+
+    size_t operator[](index_type binId) const { return bins_[binId]; }
+    size_t& operator[](index_type binId) { return bins_[binId]; }
+
+    auto begin() { return bins_.begin(); }
+    auto end() { return bins_.end(); }
+    auto begin() const { return bins_.begin(); }
+    auto end() const { return bins_.end(); }
+
+    const size_t* data() const { return bins_.data(); }
+
+    /*
+     * Returns the number of bins, including empty ones.
+     */
+    size_t numberOfBins() const { return bins_.size(); }
+
+    /*
+     * Returns the sum of all bins.
+     */
+    size_t total() const { return std::accumulate(bins_.begin(), bins_.end(), size_t(0)); }
+
+    /*
+     * Sets all bins to zero, keeps the number of bins.
+     */
+    void clear() { std::fill(bins_.begin(), bins_.end(), size_t(0)); }
+
+    /*
+     * Changes the number of bins and sets all of them to zero.
+     */
+    void reset(size_t numberOfBins) { bins_.assign(numberOfBins, 0); }
+
+private:
+    std::vector<size_t> bins_;
+};
+
+}  // namespace inviwo
@@ -33,6 +33,7 @@
 #include <inviwo/core/util/foreach.h>
 
 #include <inviwo/integrallinefiltering/algorithm/uniformspherepartitioning.h>
+#include <inviwo/integrallinefiltering/datastructures/densehistogram.h>
 
 namespace inviwo {
 
@@ -75,6 +76,29 @@ const std::vector<size_t> calculateDirectionalHistogram(
     return bins;
 }
 
+/**
+ * Funcion to compute a histgram of a set of 3D vectors using an existing partitioning of the
+ * sphere, for example UniformSpherePartitioning or OctahedralSpherePartitioning. The \p histogram
+ * is resized to the number of patches of the partitioning and cleared before binning, reusing the
+ * same partitioning and histogram avoids rebuilding them for each set of directions.
+ * @see UniformSpherePartitioning
+ * @see OctahedralSpherePartitioning
+ */
+template <typename T, typename Partitioning>
+void calculateDirectionalHistogram(const std::vector<glm::vec<3, T>>& directions,
+                                   const Partitioning& partitioning, DenseHistogram& histogram) {
+    static_assert(std::is_floating_point_v<T>);
+
+    if (histogram.numberOfBins() != partitioning.numberOfPatches()) {
+        histogram.reset(partitioning.numberOfPatches());
+    } else {
+        histogram.clear();
+    }
+    for (const auto& dir : directions) {
+        histogram[partitioning.getRegionForDirection(dir)]++;
+    }
+}
+
 }  // namespace histogram
 
 }  // namespace inviwo
@@ -33,6 +33,7 @@
 #include <inviwo/core/common/inviwo.h>
 #include <inviwo/core/processors/processor.h>
 #include <inviwo/core/properties/ordinalproperty.h>
+#include <inviwo/core/properties/optionproperty.h>
 #include <inviwo/core/properties/stringproperty.h>
 #include <inviwo/core/ports/imageport.h>
 #include <modules/vectorfieldvisualization/datastructures/integrallineset.h>
@@ -68,6 +69,10 @@ namespace inviwo {
  *   * __Include Termination Reasons__ Check to include each lines termination reason as a
  * parameter.
  *   * __Include Entropy__ Check to include each lines entropy as a parameter.
+ *   * __Entropy Bins__ Number of direction bins used when calculating the entropy.
+ *   * __Entropy Binning__ How directions are binned when calculating the entropy. _Uniform
+ * Sphere_ evaluates the equal-area partitioning directly, _Octahedral Lookup_ uses a precomputed
+ * octahedral grid of the same partitioning which avoids trigonometric functions per sample.
  *   * __Include Line Start Coordinates__ Check to include the {x,y,z} of the first vertex as a
  * parameter.
  *   * __Include Line End Coordinates__ Check to include {x,y,z} of the last vertex as a parameter.
@@ -77,6 +82,8 @@ namespace inviwo {
  */
 class IVW_MODULE_INTEGRALLINEFILTERING_API IntegralLinesToDataFrame : public Processor {
 public:
+    enum class EntropyBinning { UniformSphere, Octahedral };
+
     using MetricCalcFunction = std::function<void(const IntegralLine& line)>;
     class MetaDataSettings : public BoolCompositeProperty {
     public:
@@ -194,6 +201,8 @@ private:
     BoolProperty includeTortuosity_;
     BoolProperty includeTerminationReason_;
     BoolProperty includeEntropy_;
+    IntSizeTProperty entropyBins_;
+    OptionProperty<EntropyBinning> entropyBinning_;
     BoolProperty includeStartPositions_;
     BoolProperty includeEndPositions_;
 };
@@ -30,6 +30,7 @@
 #include <inviwo/integrallinefiltering/processors/integrallinestodataframe.h>
 
 #include <inviwo/integrallinefiltering/algorithm/shannonentropy.h>
+#include <inviwo/integrallinefiltering/algorithm/octahedralspherepartitioning.h>
 
 namespace inviwo {
 
@@ -190,6 +191,13 @@ IntegralLinesToDataFrame::IntegralLinesToDataFrame()
     , includeTortuosity_("includeTurtuosity", "Include Tortuosity", true)
     , includeTerminationReason_("includeTerminationReason", "Include Termination Reasons", true)
     , includeEntropy_("includeEntropy", "Include Entropy", true)
+    // at least two bins, the entropy is normalized by log2 of the bin count
+    , entropyBins_("entropyBins", "Entropy Bins", 33, {2, ConstraintBehavior::Immutable},
+                   {1000, ConstraintBehavior::Ignore})
+    , entropyBinning_("entropyBinning", "Entropy Binning",
+                      {{"uniformSphere", "Uniform Sphere", EntropyBinning::UniformSphere},
+                       {"octahedral", "Octahedral Lookup", EntropyBinning::Octahedral}},
+                      0)
     , includeStartPositions_("includeStartPositions", "Include Line Start Coordinates", false)
     , includeEndPositions_("includeEndPositions", "Include Line End Coordinates", false) {
 
@@ -197,8 +205,11 @@ IntegralLinesToDataFrame::IntegralLinesToDataFrame()
     addPort(dataframe_);
 
     addProperties(includeLineID_, includeNumberOfPoints_, includeLineLength_, includeTortuosity_,
-                  includeTerminationReason_, includeEntropy_, includeStartPositions_,
-                  includeEndPositions_, metaDataSettings_);
+                  includeTerminationReason_, includeEntropy_, entropyBins_, entropyBinning_,
+                  includeStartPositions_, includeEndPositions_, metaDataSettings_);
+
+    entropyBins_.visibilityDependsOn(includeEntropy_, [](const auto& p) { return p.get(); });
+    entropyBinning_.visibilityDependsOn(includeEntropy_, [](const auto& p) { return p.get(); });
 
     lines_.onChange([this]() {
         if (auto lines = lines_.getData()) {
@@ -299,10 +310,25 @@ void IntegralLinesToDataFrame::process() {
         if (includeEntropy_.get()) {
             if (firstLine.hasMetaData("velocity")) {
                 auto& entropies = detail::createColumn<float>(*df, "Entropy");
-                funcs.push_back([&](const IntegralLine& line) {
-                    entropies.push_back(static_cast<float>(entropy::shannonEntropyDirectional(
-                        line.getMetaData<dvec3>("velocity"), 33)));
-                });
+                // The partitioning and histogram are created once and shared by all lines
+                auto entropyFunc = [&entropies](auto partitioning) -> MetricCalcFunction {
+                    return [&entropies, partitioning = std::move(partitioning),
+                            histogram = DenseHistogram{}](const IntegralLine& line) mutable {
+                        entropies.push_back(static_cast<float>(entropy::shannonEntropyDirectional(
+                            line.getMetaData<dvec3>("velocity"), partitioning, histogram)));
+                    };
+                };
+                switch (entropyBinning_.get()) {
+                    case EntropyBinning::Octahedral:
+                        funcs.push_back(
+                            entropyFunc(OctahedralSpherePartitioning<double>(entropyBins_.get())));
+                        break;
+                    case EntropyBinning::UniformSphere:
+                    default:
+                        funcs.push_back(
+                            entropyFunc(UniformSpherePartitioning<double>(entropyBins_.get())));
+                        break;
+                }
             }
         }
 
@@ -0,0 +1,173 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/integrallinefiltering/algorithm/shannonentropy.h>
+#include <inviwo/integrallinefiltering/algorithm/octahedralspherepartitioning.h>
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <fmt/format.h>
+
+#include <chrono>
+#include <iostream>
+#include <random>
+
+namespace inviwo {
+
+namespace {
+
+std::vector<dvec3> randomDirections(size_t N) {
+    std::vector<dvec3> dirs;
+    dirs.reserve(N);
+    std::mt19937 rand;
+    std::uniform_real_distribution<double> dist(-1, 1);
+    while (dirs.size() < N) {
+        dvec3 p{dist(rand), dist(rand), dist(rand)};
+        const auto l2 = glm::length2(p);
+        if (l2 <= 1 && l2 > 0) {
+            dirs.push_back(p);
+        }
+    }
+    return dirs;
+}
+
+}  // namespace
+
+TEST(DirectionalBinningTest, OctahedralRoundTrip) {
+    for (const auto& dir : randomDirections(1000)) {
+        const auto uv = OctahedralSpherePartitioning<double>::toOctahedral(dir);
+        EXPECT_GE(uv.x, 0.0);
+        EXPECT_LE(uv.x, 1.0);
+        EXPECT_GE(uv.y, 0.0);
+        EXPECT_LE(uv.y, 1.0);
+
+        const auto back = OctahedralSpherePartitioning<double>::toDirection(uv);
+        const auto n = glm::normalize(dir);
+        EXPECT_NEAR(back.x, n.x, 1e-9);
+        EXPECT_NEAR(back.y, n.y, 1e-9);
+        EXPECT_NEAR(back.z, n.z, 1e-9);
+    }
+}
+
+TEST(DirectionalBinningTest, OctahedralMatchesUniformSphere) {
+    const auto dirs = randomDirections(100000);
+    for (size_t segments : {1, 2, 10, 33, 100, 1000}) {
+        const UniformSpherePartitioning<double> uniform(segments);
+        const OctahedralSpherePartitioning<double> octahedral(segments);
+        ASSERT_EQ(uniform.numberOfPatches(), octahedral.numberOfPatches());
+
+        size_t mismatches = 0;
+        for (const auto& dir : dirs) {
+            const auto region = octahedral.getRegionForDirection(dir);
+            ASSERT_LT(region, segments);
+            if (region != uniform.getRegionForDirection(dir)) ++mismatches;
+        }
+        // Only directions close to patch boundaries are allowed to differ
+        EXPECT_LT(static_cast<double>(mismatches) / dirs.size(), 0.02) << segments << " segments";
+    }
+}
+
+TEST(DirectionalBinningTest, DenseHistogramEntropy) {
+    DenseHistogram dense(10);
+    std::vector<size_t> reference(10, 0);
+    std::mt19937 rand;
+    std::uniform_int_distribution<size_t> dist(0, 6);
+    for (size_t i = 0; i < 1000; i++) {
+        const auto bin = dist(rand);
+        dense[bin]++;
+        reference[bin]++;
+    }
+    EXPECT_EQ(dense.total(), 1000);
+    EXPECT_NEAR(entropy::shannonEntropy(dense), entropy::shannonEntropy(reference), 1e-9);
+
+    dense.clear();
+    EXPECT_EQ(dense.numberOfBins(), 10);
+    EXPECT_EQ(entropy::shannonEntropy(dense), 0.0);
+}
+
+TEST(DirectionalBinningTest, DirectionalEntropy) {
+    const auto dirs = randomDirections(100000);
+    DenseHistogram histogram;
+    for (size_t segments : {10, 100, 1000}) {
+        const auto reference = entropy::shannonEntropyDirectional(dirs, segments);
+        const auto uniform = entropy::shannonEntropyDirectional(
+            dirs, UniformSpherePartitioning<double>(segments), histogram);
+        const auto octahedral = entropy::shannonEntropyDirectional(
+            dirs, OctahedralSpherePartitioning<double>(segments), histogram);
+
+        EXPECT_NEAR(uniform, reference, 1e-9);
+        EXPECT_NEAR(octahedral, reference, 0.0005);
+    }
+}
+
+/*
+ * Micro benchmark comparing the binning schemes, run with --gtest_also_run_disabled_tests
+ */
+TEST(DirectionalBinningTest, DISABLED_Benchmark) {
+    using clock = std::chrono::high_resolution_clock;
+    const size_t lines = 1000;
+    const size_t pointsPerLine = 1000;
+    const auto dirs = randomDirections(pointsPerLine);
+
+    auto measure = [&](auto&& func) {
+        const auto start = clock::now();
+        double sum = 0.0;
+        for (size_t i = 0; i < lines; i++) {
+            sum += func();
+        }
+        const auto ms = std::chrono::duration<double, std::milli>(clock::now() - start).count();
+        return std::make_pair(ms, sum / lines);
+    };
+
+    for (size_t segments : {33, 100, 1000}) {
+        DenseHistogram histogram;
+        const UniformSpherePartitioning<double> uniform(segments);
+        const OctahedralSpherePartitioning<double> octahedral(segments);
+
+        const auto perCall =
+            measure([&]() { return entropy::shannonEntropyDirectional(dirs, segments); });
+        const auto shared = measure(
+            [&]() { return entropy::shannonEntropyDirectional(dirs, uniform, histogram); });
+        const auto lookup = measure(
+            [&]() { return entropy::shannonEntropyDirectional(dirs, octahedral, histogram); });
+
+        std::cout << fmt::format(
+            "{:>5} bins, {} lines x {} points\n"
+            "  UniformSpherePartitioning per line: {:8.2f} ms (entropy {:.5f})\n"
+            "  UniformSpherePartitioning shared:   {:8.2f} ms (entropy {:.5f})\n"
+            "  OctahedralSpherePartitioning:       {:8.2f} ms (entropy {:.5f})\n",
+            segments, lines, pointsPerLine, perCall.first, perCall.second, shared.first,
+            shared.second, lookup.first, lookup.second);
+    }
+}
+
+}  // namespace inviwo